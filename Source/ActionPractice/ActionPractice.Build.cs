@@ -25,7 +25,7 @@ public class ActionPractice : ModuleRules
 			"UMG"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "NetCore", "Niagara", "NavigationSystem" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"ActionPractice",
@@ -1,18 +1,11 @@
 ﻿#include "AI/EnemyAIController.h"
 #include "AI/StateTree/GASStateTreeAIComponent.h"
+#include "AI/StateTree/EnemyBrainSubsystem.h"
 #include "Characters/ActionPracticeCharacter.h"
 #include "Characters/BossCharacter.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossAIController, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBossAIController, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 AEnemyAIController::AEnemyAIController()
 {
@@ -53,35 +46,39 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
 
-	DEBUG_LOG(TEXT("OnPossess: InPawn=%s"), *GetNameSafe(InPawn));
+	AP_DEBUG_LOG(LogAPAI, TEXT("OnPossess: InPawn=%s"), *GetNameSafe(InPawn));
+
+	//브레인 갱신이 이 폰의 이동 이후에 실행
+	UEnemyBrainSubsystem::RegisterAgentPawn(InPawn);
 
 	BossCharacter = Cast<ABossCharacter>(InPawn);
 	if (!BossCharacter.IsValid())
 	{
-		DEBUG_LOG(TEXT("OnPossess: Failed to cast Pawn to BossCharacter"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("OnPossess: Failed to cast Pawn to BossCharacter"));
 		return;
 	}
 
 	if (!GASStateTreeAIComponent)
 	{
-		DEBUG_LOG(TEXT("OnPossess: GASStateTreeAIComponent is nullptr"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("OnPossess: GASStateTreeAIComponent is nullptr"));
 		return;
 	}
 
-	DEBUG_LOG(TEXT("OnPossess: Restarting StateTree logic"));
+	AP_DEBUG_LOG(LogAPAI, TEXT("OnPossess: Restarting StateTree logic"));
 	GASStateTreeAIComponent->RestartLogic();
 }
 
 void AEnemyAIController::OnUnPossess()
 {
-	DEBUG_LOG(TEXT("OnUnPossess: Called. Pawn=%s"), *GetNameSafe(GetPawn()));
+	AP_DEBUG_LOG(LogAPAI, TEXT("OnUnPossess: Called. Pawn=%s"), *GetNameSafe(GetPawn()));
 
 	if (GASStateTreeAIComponent)
 	{
-		DEBUG_LOG(TEXT("OnUnPossess: Stopping StateTree logic"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("OnUnPossess: Stopping StateTree logic"));
 		GASStateTreeAIComponent->StopLogic("Unpossessed");
 	}
 
+	UEnemyBrainSubsystem::UnregisterAgentPawn(GetPawn());
 	BossCharacter.Reset();
 
 	Super::OnUnPossess();
@@ -101,7 +98,7 @@ void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus St
 			if (Player)
 			{
 				CurrentTarget.Actor = Player;
-				DEBUG_LOG(TEXT("Target Detected: %s"), *Actor->GetName());
+				AP_DEBUG_LOG(LogAPAI, TEXT("Target Detected: %s"), *Actor->GetName());
 			}
 		}
 		else
@@ -109,7 +106,7 @@ void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus St
 			if (Player)
 			{
 				CurrentTarget.Reset();
-				DEBUG_LOG(TEXT("Target Lost: %s"), *Actor->GetName());
+				AP_DEBUG_LOG(LogAPAI, TEXT("Target Lost: %s"), *Actor->GetName());
 			}
 		}
 	}
@@ -0,0 +1,364 @@
+#include "AI/EnemyPathSubsystem.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavMesh/NavMeshPath.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace EnemyPath
+{
+	static int32 MaxQueriesPerFrame = 4;
+	static FAutoConsoleVariableRef CVarMaxQueriesPerFrame(
+		TEXT("ap.AI.Path.MaxQueriesPerFrame"),
+		MaxQueriesPerFrame,
+		TEXT("Maximum async path queries issued per frame for enemy moves. Groups over the limit wait for the next frame, oldest first."));
+
+	static float RepathDistance = 150.0f;
+	static FAutoConsoleVariableRef CVarRepathDistance(
+		TEXT("ap.AI.Path.RepathDistance"),
+		RepathDistance,
+		TEXT("An enemy path is recomputed only once its goal has moved this far from the goal the path was built for."));
+
+	static float ShareStartRadius = 300.0f;
+	static FAutoConsoleVariableRef CVarShareStartRadius(
+		TEXT("ap.AI.Path.ShareStartRadius"),
+		ShareStartRadius,
+		TEXT("Enemies whose start points are within this distance of a query leader share its path."));
+
+	static float ShareGoalRadius = 100.0f;
+	static FAutoConsoleVariableRef CVarShareGoalRadius(
+		TEXT("ap.AI.Path.ShareGoalRadius"),
+		ShareGoalRadius,
+		TEXT("Enemies whose goals are within this distance of a query leader's goal share its path."));
+
+	static float IdleRetryInterval = 0.5f;
+	static FAutoConsoleVariableRef CVarIdleRetryInterval(
+		TEXT("ap.AI.Path.IdleRetryInterval"),
+		IdleRetryInterval,
+		TEXT("Seconds after a move started before an enemy whose path following went idle short of its goal is queried again."));
+}
+
+#pragma region "Subsystem Functions"
+bool UEnemyPathSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPathSubsystem::Deinitialize()
+{
+	//진행 중인 쿼리 결과는 HandlePathFound에서 찾지 못하고 버려짐
+	Agents.Empty();
+	PendingQueries.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyPathSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && Agents.Num() > 0;
+}
+
+TStatId UEnemyPathSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPathSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyPathSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	Agents.RemoveAllSwap([](const FEnemyPathAgent& Agent)
+	{
+		return !Agent.Controller.IsValid();
+	});
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		IssueQueries(NavSys);
+	}
+}
+
+void UEnemyPathSubsystem::SetAgentGoal(AAIController* Controller, const AActor* GoalActor, const FVector& GoalLocation, float AcceptanceRadius)
+{
+	UWorld* World = Controller ? Controller->GetWorld() : nullptr;
+	UEnemyPathSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyPathSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	FEnemyPathAgent* Agent = Subsystem->FindAgent(Controller);
+	if (!Agent)
+	{
+		Agent = &Subsystem->Agents.AddDefaulted_GetRef();
+		Agent->Controller = Controller;
+	}
+
+	//목표가 바뀌면 다음 Tick에 새 경로 (진행 중인 쿼리 결과는 PathGoal 비교로 걸러짐)
+	Agent->GoalActor = GoalActor;
+	Agent->GoalLocation = GoalLocation;
+	Agent->AcceptanceRadius = AcceptanceRadius;
+	if (Agent->Status != EEnemyPathStatus::Pending)
+	{
+		Agent->Status = EEnemyPathStatus::None;
+	}
+}
+
+void UEnemyPathSubsystem::ClearAgentGoal(AAIController* Controller)
+{
+	UWorld* World = Controller ? Controller->GetWorld() : nullptr;
+	UEnemyPathSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyPathSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	Subsystem->Agents.RemoveAllSwap([Controller](const FEnemyPathAgent& Agent)
+	{
+		return Agent.Controller == Controller;
+	});
+}
+
+EEnemyPathStatus UEnemyPathSubsystem::GetAgentStatus(const AAIController* Controller)
+{
+	UWorld* World = Controller ? Controller->GetWorld() : nullptr;
+	UEnemyPathSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyPathSubsystem>() : nullptr;
+	const FEnemyPathAgent* Agent = Subsystem ? Subsystem->FindAgent(Controller) : nullptr;
+
+	return Agent ? Agent->Status : EEnemyPathStatus::None;
+}
+#pragma endregion
+
+#pragma region "Path Queries"
+FEnemyPathAgent* UEnemyPathSubsystem::FindAgent(const AAIController* Controller)
+{
+	return Agents.FindByPredicate([Controller](const FEnemyPathAgent& Agent)
+	{
+		return Agent.Controller.Get() == Controller;
+	});
+}
+
+FVector UEnemyPathSubsystem::GetAgentGoal(const FEnemyPathAgent& Agent)
+{
+	const AActor* GoalActor = Agent.GoalActor.Get();
+	return GoalActor ? GoalActor->GetActorLocation() : Agent.GoalLocation;
+}
+
+void UEnemyPathSubsystem::IssueQueries(UNavigationSystemV1* NavSys)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float RepathDistanceSq = FMath::Square(EnemyPath::RepathDistance);
+
+	//경로가 없거나 목표가 재경로 거리 이상 움직인 에이전트
+	TArray<int32, TInlineAllocator<32>> Waiting;
+	for (int32 Index = 0; Index < Agents.Num(); ++Index)
+	{
+		FEnemyPathAgent& Agent = Agents[Index];
+		if (Agent.Status == EEnemyPathStatus::Pending) continue;
+
+		const bool bHasResult = Agent.Status == EEnemyPathStatus::Following || Agent.Status == EEnemyPathStatus::Failed;
+		if (bHasResult && FVector::DistSquared(GetAgentGoal(Agent), Agent.PathGoal) <= RepathDistanceSq && !IsStalled(Agent, Now)) continue;
+
+		if (Agent.WaitingSince < 0.0)
+		{
+			Agent.WaitingSince = Now;
+		}
+		Waiting.Add(Index);
+	}
+
+	if (Waiting.Num() == 0) return;
+
+	Waiting.Sort([this](int32 A, int32 B)
+	{
+		return Agents[A].WaitingSince < Agents[B].WaitingSince;
+	});
+
+	const float ShareStartSq = FMath::Square(EnemyPath::ShareStartRadius);
+	const float ShareGoalSq = FMath::Square(EnemyPath::ShareGoalRadius);
+	const int32 MaxQueries = FMath::Max(EnemyPath::MaxQueriesPerFrame, 1);
+
+	TArray<bool, TInlineAllocator<32>> Grouped;
+	Grouped.SetNumZeroed(Waiting.Num());
+
+	int32 NumIssued = 0;
+	for (int32 LeaderSlot = 0; LeaderSlot < Waiting.Num(); ++LeaderSlot)
+	{
+		if (Grouped[LeaderSlot]) continue;
+
+		if (NumIssued >= MaxQueries)
+		{
+			INC_DWORD_STAT(STAT_CombatPathDeferred);
+			continue;
+		}
+
+		FEnemyPathAgent& Leader = Agents[Waiting[LeaderSlot]];
+		AAIController* LeaderController = Leader.Controller.Get();
+		const APawn* LeaderPawn = LeaderController ? LeaderController->GetPawn() : nullptr;
+		if (!LeaderPawn) continue;
+
+		const FVector Start = LeaderPawn->GetActorLocation();
+		const FVector Goal = GetAgentGoal(Leader);
+
+		const FNavAgentProperties& AgentProperties = LeaderController->GetNavAgentPropertiesRef();
+		const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProperties, Start);
+		if (!NavData)
+		{
+			Leader.Status = EEnemyPathStatus::Failed;
+			Leader.PathGoal = Goal;
+			Leader.WaitingSince = -1.0;
+			continue;
+		}
+
+		FEnemyPathQuery Query;
+		Query.Goal = Goal;
+		Query.Members.Add(LeaderController);
+		Grouped[LeaderSlot] = true;
+
+		//시작점과 목표가 모두 가까운 에이전트는 같은 쿼리 결과 사용
+		for (int32 MemberSlot = LeaderSlot + 1; MemberSlot < Waiting.Num(); ++MemberSlot)
+		{
+			if (Grouped[MemberSlot]) continue;
+
+			const FEnemyPathAgent& Member = Agents[Waiting[MemberSlot]];
+			if (Member.bNeedsOwnQuery) continue;
+
+			const APawn* MemberPawn = Member.Controller.IsValid() ? Member.Controller->GetPawn() : nullptr;
+			if (!MemberPawn) continue;
+
+			if (FVector::DistSquared(MemberPawn->GetActorLocation(), Start) > ShareStartSq) continue;
+			if (FVector::DistSquared(GetAgentGoal(Member), Goal) > ShareGoalSq) continue;
+
+			Query.Members.Add(Member.Controller);
+			Grouped[MemberSlot] = true;
+		}
+
+		FSharedConstNavQueryFilter Filter = UNavigationQueryFilter::GetQueryFilter(*NavData, LeaderController, LeaderController->GetDefaultNavigationFilterClass());
+		FPathFindingQuery PathQuery(LeaderController, *NavData, Start, Goal, Filter);
+		PathQuery.SetAllowPartialPaths(true);
+
+		const uint32 QueryId = NavSys->FindPathAsync(AgentProperties, PathQuery,
+			FNavPathQueryDelegate::CreateUObject(this, &UEnemyPathSubsystem::HandlePathFound), EPathFindingMode::Regular);
+		if (QueryId == INVALID_NAVQUERYID)
+		{
+			Leader.Status = EEnemyPathStatus::Failed;
+			Leader.PathGoal = Goal;
+			Leader.WaitingSince = -1.0;
+			continue;
+		}
+
+		for (const TWeakObjectPtr<AAIController>& MemberController : Query.Members)
+		{
+			if (FEnemyPathAgent* Member = FindAgent(MemberController.Get()))
+			{
+				Member->Status = EEnemyPathStatus::Pending;
+				Member->bNeedsOwnQuery = false;
+			}
+		}
+
+		INC_DWORD_STAT(STAT_CombatPathQueries);
+		++FCombatQueryCounters::PathQueries;
+		INC_DWORD_STAT_BY(STAT_CombatPathShared, Query.Members.Num() - 1);
+		AP_DEBUG_LOG(LogAPAI, TEXT("Path: query %u for %d agents"), QueryId, Query.Members.Num());
+
+		PendingQueries.Add(QueryId, MoveTemp(Query));
+		++NumIssued;
+	}
+}
+
+void UEnemyPathSubsystem::HandlePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FEnemyPathQuery Query;
+	if (!PendingQueries.RemoveAndCopyValue(QueryId, Query)) return;
+
+	const bool bSuccess = Result == ENavigationQueryResult::Success && Path.IsValid() && Path->IsValid();
+
+	for (int32 MemberIndex = 0; MemberIndex < Query.Members.Num(); ++MemberIndex)
+	{
+		FEnemyPathAgent* Agent = FindAgent(Query.Members[MemberIndex].Get());
+		if (!Agent || Agent->Status != EEnemyPathStatus::Pending) continue;
+
+		Agent->PathGoal = Query.Goal;
+
+		const APawn* Pawn = Agent->Controller->GetPawn();
+		if (!bSuccess || !Pawn)
+		{
+			Agent->Status = EEnemyPathStatus::Failed;
+			Agent->WaitingSince = -1.0;
+			continue;
+		}
+
+		//PathFollowing이 경로에 옵저버를 등록하므로 리더 외에는 사본
+		const FNavPathSharedPtr AgentPath = MemberIndex == 0 ? Path : MakeMemberPath(Path, Agent->Controller.Get(), Pawn->GetActorLocation());
+		if (!AgentPath.IsValid())
+		{
+			//리더 경로로 바로 갈 수 없는 멤버 (벽 너머 등), 대기 시각은 유지해서 다음 Tick에 우선 처리
+			Agent->Status = EEnemyPathStatus::None;
+			Agent->bNeedsOwnQuery = true;
+			INC_DWORD_STAT(STAT_CombatPathDeferred);
+			continue;
+		}
+
+		Agent->WaitingSince = -1.0;
+		FollowPath(*Agent, AgentPath);
+	}
+
+	AP_DEBUG_LOG(LogAPAI, TEXT("Path: query %u %s for %d agents"), QueryId, bSuccess ? TEXT("succeeded") : TEXT("failed"), Query.Members.Num());
+}
+
+FNavPathSharedPtr UEnemyPathSubsystem::MakeMemberPath(const FNavPathSharedPtr& SourcePath, const AAIController* Controller, const FVector& Start)
+{
+	//리더 시작점 대신 멤버 위치에서 다음 점으로 직선 이동이 가능해야 공유
+	const TArray<FNavPathPoint>& SourcePoints = SourcePath->GetPathPoints();
+	const ANavigationData* NavData = SourcePath->GetNavigationDataUsed();
+	if (!NavData || !Controller || SourcePoints.Num() < 2) return nullptr;
+
+	FSharedConstNavQueryFilter Filter = UNavigationQueryFilter::GetQueryFilter(*NavData, Controller, Controller->GetDefaultNavigationFilterClass());
+	FVector HitLocation;
+	if (NavData->Raycast(Start, SourcePoints[1].Location, HitLocation, Filter, Controller))
+	{
+		AP_DEBUG_LOG(LogAPAI, TEXT("Path: shared path blocked for %s"), *Controller->GetName());
+		return nullptr;
+	}
+
+	FNavPathSharedPtr MemberPath = MakeShared<FNavMeshPath, ESPMode::ThreadSafe>();
+	MemberPath->GetPathPoints() = SourcePath->GetPathPoints();
+	MemberPath->GetPathPoints()[0].Location = Start;
+	MemberPath->SetNavigationDataUsed(SourcePath->GetNavigationDataUsed());
+	MemberPath->SetQuerier(SourcePath->GetQuerier());
+	MemberPath->SetIsPartial(SourcePath->IsPartial());
+	MemberPath->SetTimeStamp(SourcePath->GetTimeStamp());
+	MemberPath->MarkReady();
+	return MemberPath;
+}
+
+void UEnemyPathSubsystem::FollowPath(FEnemyPathAgent& Agent, const FNavPathSharedPtr& Path) const
+{
+	AAIController* Controller = Agent.Controller.Get();
+
+	//목표 액터 관찰(경로 추적 중 동기 재경로)은 쓰지 않고 위치 목표로 이동, 재경로는 RepathDistance 기준
+	FAIMoveRequest MoveRequest(Agent.PathGoal);
+	MoveRequest.SetAcceptanceRadius(Agent.AcceptanceRadius);
+	MoveRequest.SetAllowPartialPath(true);
+	MoveRequest.SetUsePathfinding(true);
+
+	const FAIRequestID RequestId = Controller->RequestMove(MoveRequest, Path);
+	Agent.Status = RequestId.IsValid() ? EEnemyPathStatus::Following : EEnemyPathStatus::Failed;
+	Agent.FollowStartTime = GetWorld()->GetTimeSeconds();
+}
+
+bool UEnemyPathSubsystem::IsStalled(const FEnemyPathAgent& Agent, double Now) const
+{
+	if (Agent.Status != EEnemyPathStatus::Following) return false;
+
+	//경로를 막 받은 직후나 도달 불가(부분 경로 끝)에서 매 프레임 재쿼리하지 않도록 간격 제한
+	if (Now - Agent.FollowStartTime < EnemyPath::IdleRetryInterval) return false;
+
+	const AAIController* Controller = Agent.Controller.Get();
+	const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+	if (!Pawn || Controller->GetMoveStatus() != EPathFollowingStatus::Idle) return false;
+
+	//현재 목표 기준 도착 판정 (이동 요청과 같이 에이전트 반경 포함), 이전 목표에 도착했거나 StopMovement로 멈춘 경우 재쿼리
+	const float ReachRadius = Agent.AcceptanceRadius + Pawn->GetSimpleCollisionRadius();
+	return FVector::DistSquared2D(Pawn->GetActorLocation(), GetAgentGoal(Agent)) > FMath::Square(ReachRadius);
+}
+#pragma endregion
@@ -0,0 +1,405 @@
+#include "AI/StateTree/EnemyBrainSubsystem.h"
+#include "AI/StateTree/GASStateTreeAIComponent.h"
+#include "AI/EnemyAIController.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "GAS/AttributeSet/BaseAttributeSet.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace EnemyBrain
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.AI.Brain.Batch"),
+		bEnabled,
+		TEXT("Gather, evaluate and apply enemy StateTree evaluator inputs for all agents once per frame, before the trees tick. When off, evaluators read actors directly."));
+}
+
+#pragma region "Update Tick Function"
+void FEnemyBrainUpdateTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->UpdateBrains();
+	}
+}
+
+FString FEnemyBrainUpdateTickFunction::DiagnosticMessage()
+{
+	return TEXT("FEnemyBrainUpdateTickFunction");
+}
+#pragma endregion
+
+#pragma region "Subsystem Functions"
+bool UEnemyBrainSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyBrainSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	UpdateTickFunction.Subsystem = this;
+	UpdateTickFunction.TickGroup = TG_PrePhysics;
+	UpdateTickFunction.bCanEverTick = true;
+	UpdateTickFunction.bStartWithTickEnabled = true;
+	UpdateTickFunction.bRunOnAnyThread = false;
+	UpdateTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UEnemyBrainSubsystem::Deinitialize()
+{
+	if (bBenchmarking)
+	{
+		EnemyBrain::bEnabled = bBatchBeforeBench;
+		bBenchmarking = false;
+	}
+
+	if (UpdateTickFunction.IsTickFunctionRegistered())
+	{
+		UpdateTickFunction.UnRegisterTickFunction();
+	}
+	UpdateTickFunction.Subsystem = nullptr;
+
+	Agents.Empty();
+	Snapshots.Empty();
+	Results.Empty();
+	SnapshotValid.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UEnemyBrainSubsystem::IsTickable() const
+{
+	//브레인 갱신은 UpdateTickFunction, 프레임 끝 Tick은 벤치마크 집계만
+	return Super::IsTickable() && bBenchmarking;
+}
+
+TStatId UEnemyBrainSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyBrainSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyBrainSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//시작 프레임은 명령 실행 이전 구간이 섞여 있으므로 버림
+	if (bBenchSkipFrame)
+	{
+		bBenchSkipFrame = false;
+		FrameBrainSeconds = 0.0;
+		FrameTreeSeconds = 0.0;
+		return;
+	}
+
+	FEnemyBrainBenchPhase& Phase = BenchPhases[BenchPhaseIndex];
+	++Phase.Frames;
+	Phase.AgentFrames += Agents.Num();
+	Phase.BrainSeconds += FrameBrainSeconds;
+	Phase.TreeSeconds += FrameTreeSeconds;
+	FrameBrainSeconds = 0.0;
+	FrameTreeSeconds = 0.0;
+
+	if (Phase.Frames < BenchFrames) return;
+
+	if (BenchPhaseIndex == 0)
+	{
+		//다음 프레임부터 일괄 갱신 켬
+		BenchPhaseIndex = 1;
+		EnemyBrain::bEnabled = true;
+		return;
+	}
+
+	FinishTreeTickBenchmark();
+}
+
+void UEnemyBrainSubsystem::RegisterAgent(UGASStateTreeAIComponent* Component)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	UEnemyBrainSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyBrainSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	Subsystem->Agents.AddUnique(Component);
+
+	//Evaluator가 같은 프레임 결과를 읽도록
+	Component->PrimaryComponentTick.AddPrerequisite(Subsystem, Subsystem->UpdateTickFunction);
+}
+
+void UEnemyBrainSubsystem::UnregisterAgent(UGASStateTreeAIComponent* Component)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	UEnemyBrainSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyBrainSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	//RemoveSwap 대신 등록 순서 유지
+	Subsystem->Agents.Remove(Component);
+	Component->PrimaryComponentTick.RemovePrerequisite(Subsystem, Subsystem->UpdateTickFunction);
+}
+
+void UEnemyBrainSubsystem::RegisterAgentPawn(APawn* Pawn)
+{
+	UWorld* World = Pawn ? Pawn->GetWorld() : nullptr;
+	UEnemyBrainSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyBrainSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	//스냅샷이 이번 프레임 이동 결과를 읽도록, 이동 컴포넌트가 없으면 폰 Tick 이후
+	if (UPawnMovementComponent* MovementComponent = Pawn->GetMovementComponent())
+	{
+		Subsystem->UpdateTickFunction.AddPrerequisite(MovementComponent, MovementComponent->PrimaryComponentTick);
+	}
+	else
+	{
+		Subsystem->UpdateTickFunction.AddPrerequisite(Pawn, Pawn->PrimaryActorTick);
+	}
+}
+
+void UEnemyBrainSubsystem::UnregisterAgentPawn(APawn* Pawn)
+{
+	UWorld* World = Pawn ? Pawn->GetWorld() : nullptr;
+	UEnemyBrainSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyBrainSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	if (UPawnMovementComponent* MovementComponent = Pawn->GetMovementComponent())
+	{
+		Subsystem->UpdateTickFunction.RemovePrerequisite(MovementComponent, MovementComponent->PrimaryComponentTick);
+	}
+	else
+	{
+		Subsystem->UpdateTickFunction.RemovePrerequisite(Pawn, Pawn->PrimaryActorTick);
+	}
+}
+
+bool UEnemyBrainSubsystem::IsBatchUpdateEnabled()
+{
+	return EnemyBrain::bEnabled;
+}
+#pragma endregion
+
+#pragma region "Brain Update"
+bool UEnemyBrainSubsystem::GatherSnapshot(const AEnemyAIController* AIController, FEnemyBrainSnapshot& OutSnapshot)
+{
+	OutSnapshot = FEnemyBrainSnapshot();
+
+	const APawn* Pawn = AIController ? AIController->GetPawn() : nullptr;
+	if (!Pawn) return false;
+
+	OutSnapshot.SourceLocation = Pawn->GetActorLocation();
+	OutSnapshot.SourceForward = Pawn->GetActorForwardVector();
+
+	if (const AActor* TargetActor = AIController->GetCurrentTargetActor())
+	{
+		OutSnapshot.TargetLocation = TargetActor->GetActorLocation();
+		OutSnapshot.bHasTarget = true;
+	}
+
+	const IAbilitySystemInterface* ASInterface = Cast<IAbilitySystemInterface>(Pawn);
+	const UAbilitySystemComponent* ASC = ASInterface ? ASInterface->GetAbilitySystemComponent() : nullptr;
+	if (const UBaseAttributeSet* AttributeSet = ASC ? ASC->GetSet<UBaseAttributeSet>() : nullptr)
+	{
+		OutSnapshot.Health = AttributeSet->GetHealth();
+		OutSnapshot.MaxHealth = AttributeSet->GetMaxHealth();
+		OutSnapshot.bHasHealth = true;
+	}
+
+	return true;
+}
+
+void UEnemyBrainSubsystem::EvaluateSnapshot(const FEnemyBrainSnapshot& Snapshot, FEnemyBrainResult& OutResult)
+{
+	OutResult = FEnemyBrainResult();
+
+	if (Snapshot.bHasHealth)
+	{
+		OutResult.HealthRate = Snapshot.MaxHealth > 0.0f ? Snapshot.Health / Snapshot.MaxHealth : 0.0f;
+	}
+
+	if (!Snapshot.bHasTarget) return;
+
+	//거리
+	OutResult.DistanceToTarget = FVector::Dist(Snapshot.SourceLocation, Snapshot.TargetLocation);
+
+	//정면 기준 Yaw 각도, 내적으로 크기(0~180도), 외적 Z로 좌우(음수면 왼쪽)
+	const FVector DirectionToTarget = (Snapshot.TargetLocation - Snapshot.SourceLocation).GetSafeNormal();
+	const float DotProduct = FVector::DotProduct(Snapshot.SourceForward, DirectionToTarget);
+	const float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(DotProduct));
+	const FVector CrossProduct = FVector::CrossProduct(Snapshot.SourceForward, DirectionToTarget);
+
+	OutResult.AngleToTarget = (CrossProduct.Z < 0.0f) ? -AngleDegrees : AngleDegrees;
+	OutResult.bTargetDetected = true;
+}
+
+void UEnemyBrainSubsystem::EvaluateSnapshots(TConstArrayView<FEnemyBrainSnapshot> InSnapshots, TArrayView<FEnemyBrainResult> OutResults)
+{
+	check(InSnapshots.Num() == OutResults.Num());
+
+	for (int32 Index = 0; Index < InSnapshots.Num(); ++Index)
+	{
+		EvaluateSnapshot(InSnapshots[Index], OutResults[Index]);
+	}
+}
+
+void UEnemyBrainSubsystem::UpdateBrains()
+{
+	if (!EnemyBrain::bEnabled || Agents.IsEmpty()) return;
+
+	const double StartTime = bBenchmarking ? FPlatformTime::Seconds() : 0.0;
+
+	//에이전트 폰 이동 이후, 트리 Tick 이전 (RegisterAgent/RegisterAgentPawn의 선행 조건)
+	GatherSnapshots();
+
+	{
+		COMBAT_SCOPE(STAT_CombatBrainEvaluate);
+		EvaluateSnapshots(Snapshots, Results);
+	}
+
+	ApplyResults();
+
+	if (bBenchmarking)
+	{
+		FrameBrainSeconds += FPlatformTime::Seconds() - StartTime;
+	}
+}
+
+void UEnemyBrainSubsystem::GatherSnapshots()
+{
+	COMBAT_SCOPE(STAT_CombatBrainGather);
+
+	Agents.RemoveAll([](const TWeakObjectPtr<UGASStateTreeAIComponent>& Agent)
+	{
+		return !Agent.IsValid();
+	});
+
+	Snapshots.SetNum(Agents.Num(), EAllowShrinking::No);
+	Results.SetNum(Agents.Num(), EAllowShrinking::No);
+	SnapshotValid.SetNum(Agents.Num(), EAllowShrinking::No);
+
+	for (int32 Index = 0; Index < Agents.Num(); ++Index)
+	{
+		const UGASStateTreeAIComponent* Component = Agents[Index].Get();
+		const AEnemyAIController* AIController = Cast<AEnemyAIController>(Component->GetAIOwner());
+		SnapshotValid[Index] = Component->IsRunning() && GatherSnapshot(AIController, Snapshots[Index]);
+	}
+
+	INC_DWORD_STAT_BY(STAT_CombatBrainAgents, Agents.Num());
+}
+
+void UEnemyBrainSubsystem::ApplyResults()
+{
+	COMBAT_SCOPE(STAT_CombatBrainApply);
+
+	//등록 순서대로 적용
+	for (int32 Index = 0; Index < Agents.Num(); ++Index)
+	{
+		if (!SnapshotValid[Index]) continue;
+
+		UGASStateTreeAIComponent* Component = Agents[Index].Get();
+		AEnemyAIController* AIController = Cast<AEnemyAIController>(Component->GetAIOwner());
+		if (!AIController) continue;
+
+		//수집 이후 타겟이 바뀌지 않으므로(같은 게임 스레드 구간) 현재 타겟이 스냅샷 타겟
+		const FEnemyBrainResult& Result = Results[Index];
+		Component->SetBrainResult(Result, AIController->GetCurrentTargetActor());
+
+		if (Result.bTargetDetected && AIController->CurrentTarget.IsValid())
+		{
+			AIController->CurrentTarget.Distance = Result.DistanceToTarget;
+			AIController->CurrentTarget.AngleToTarget = Result.AngleToTarget;
+		}
+	}
+}
+#pragma endregion
+
+#pragma region "Benchmark"
+bool UEnemyBrainSubsystem::StartTreeTickBenchmark(int32 Frames)
+{
+	if (bBenchmarking)
+	{
+		UE_LOG(LogAPAI, Warning, TEXT("Brain benchmark already running"));
+		return false;
+	}
+
+	if (Agents.IsEmpty())
+	{
+		UE_LOG(LogAPAI, Warning, TEXT("Brain benchmark needs at least one enemy StateTree agent in the world"));
+		return false;
+	}
+
+	bBenchmarking = true;
+	bBenchSkipFrame = true;
+	bBatchBeforeBench = EnemyBrain::bEnabled;
+	BenchFrames = FMath::Max(Frames, 1);
+	BenchPhaseIndex = 0;
+	BenchPhases[0] = FEnemyBrainBenchPhase();
+	BenchPhases[1] = FEnemyBrainBenchPhase();
+	FrameBrainSeconds = 0.0;
+	FrameTreeSeconds = 0.0;
+
+	//1구간: Evaluator가 액터를 직접 읽음
+	EnemyBrain::bEnabled = false;
+
+	UE_LOG(LogAPAI, Display, TEXT("Brain benchmark started: %d agents, %d frames per mode"), Agents.Num(), BenchFrames);
+	return true;
+}
+
+void UEnemyBrainSubsystem::FinishTreeTickBenchmark()
+{
+	bBenchmarking = false;
+	EnemyBrain::bEnabled = bBatchBeforeBench;
+
+	FString Csv = TEXT("Batch,Agents,Frames,BrainUs,TreeUs,TotalUs,TotalUsPerAgent\n");
+	double TotalUs[2] = {};
+
+	for (int32 PhaseIndex = 0; PhaseIndex < 2; ++PhaseIndex)
+	{
+		const FEnemyBrainBenchPhase& Phase = BenchPhases[PhaseIndex];
+		const int32 Frames = FMath::Max(Phase.Frames, 1);
+		const double AvgAgents = static_cast<double>(Phase.AgentFrames) / Frames;
+		const double BrainUs = Phase.BrainSeconds * 1e6 / Frames;
+		const double TreeUs = Phase.TreeSeconds * 1e6 / Frames;
+		TotalUs[PhaseIndex] = BrainUs + TreeUs;
+		const double PerAgentUs = AvgAgents > 0.0 ? TotalUs[PhaseIndex] / AvgAgents : 0.0;
+
+		UE_LOG(LogAPAI, Display, TEXT("Batch %s: %.1f agents, brain %8.2f us + trees %8.2f us = %8.2f us/frame (%.2f us/agent)"),
+			PhaseIndex == 1 ? TEXT("on ") : TEXT("off"), AvgAgents, BrainUs, TreeUs, TotalUs[PhaseIndex], PerAgentUs);
+		Csv += FString::Printf(TEXT("%d,%.1f,%d,%.3f,%.3f,%.3f,%.3f\n"), PhaseIndex, AvgAgents, Phase.Frames, BrainUs, TreeUs, TotalUs[PhaseIndex], PerAgentUs);
+	}
+
+	//1 미만이면 일괄 갱신이 트리 Tick 비용을 늘림
+	const double Speedup = TotalUs[1] > 0.0 ? TotalUs[0] / TotalUs[1] : 0.0;
+	UE_LOG(LogAPAI, Display, TEXT("Brain batch speedup x%.2f"), Speedup);
+
+	const FString CsvPath = FPaths::ProfilingDir() / TEXT("BrainBench") / FString::Printf(TEXT("BrainBench_%s.csv"), *FDateTime::Now().ToString());
+	FFileHelper::SaveStringToFile(Csv, *CsvPath);
+	UE_LOG(LogAPAI, Display, TEXT("Brain benchmark written to %s"), *CsvPath);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace EnemyBrain
+{
+	static FAutoConsoleCommandWithWorldAndArgs CmdBenchmark(
+		TEXT("ap.AI.BrainBench"),
+		TEXT("Times the real StateTree ticks of every enemy agent in the current world, first with ap.AI.Brain.Batch off and then on, including the batched brain update. Args: Frames=300 (per mode)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			int32 Frames = 300;
+			FParse::Value(*FString::Join(Args, TEXT(" ")), TEXT("Frames="), Frames);
+
+			if (UEnemyBrainSubsystem* Subsystem = World ? World->GetSubsystem<UEnemyBrainSubsystem>() : nullptr)
+			{
+				Subsystem->StartTreeTickBenchmark(Frames);
+			}
+		}));
+}
+#endif
+#pragma endregion
@@ -2,17 +2,11 @@
 
 #include "AI/StateTree/Evaluators/HealthRateEvaluator.h"
 #include "AbilitySystemComponent.h"
+#include "AI/EnemyAIController.h"
+#include "AI/StateTree/GASStateTreeAIComponent.h"
 #include "GAS/AttributeSet/BaseAttributeSet.h"
 #include "StateTreeExecutionContext.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogHealthRateEvaluator, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogHealthRateEvaluator, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 void FHealthRateEvaluator::TreeStart(FStateTreeExecutionContext& Context) const
 {
@@ -20,14 +14,14 @@ void FHealthRateEvaluator::TreeStart(FStateTreeExecutionContext& Context) const
 
 	if (!InstanceData.AbilitySystemComponent)
 	{
-		DEBUG_LOG(TEXT("AbilitySystemComponent is not valid in HealthRateEvaluator"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("AbilitySystemComponent is not valid in HealthRateEvaluator"));
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("AbilitySystemComponent Bind Successfully"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("AbilitySystemComponent Bind Successfully"));
 	}
 
-	DEBUG_LOG(TEXT("HealthRateEvaluator TreeStart"));
+	AP_DEBUG_LOG(LogAPAI, TEXT("HealthRateEvaluator TreeStart"));
 }
 
 void FHealthRateEvaluator::TreeStop(FStateTreeExecutionContext& Context) const
@@ -36,7 +30,7 @@ void FHealthRateEvaluator::TreeStop(FStateTreeExecutionContext& Context) const
 
 	InstanceData.HealthRate = 1.0f;
 
-	DEBUG_LOG(TEXT("HealthRateEvaluator TreeStop"));
+	AP_DEBUG_LOG(LogAPAI, TEXT("HealthRateEvaluator TreeStop"));
 }
 
 void FHealthRateEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
@@ -48,6 +42,12 @@ void FHealthRateEvaluator::UpdateHealthRate(FStateTreeExecutionContext& Context)
 {
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
+	if (const UGASStateTreeAIComponent* StateTreeComponent = InstanceData.AIController ? InstanceData.AIController->GetStateTreeComponent() : nullptr)
+	{
+		InstanceData.HealthRate = StateTreeComponent->GetBrainResult().HealthRate;
+		return;
+	}
+
 	if (!InstanceData.AbilitySystemComponent)
 	{
 		InstanceData.HealthRate = 1.0f;
@@ -57,7 +57,7 @@ void FHealthRateEvaluator::UpdateHealthRate(FStateTreeExecutionContext& Context)
 	const UBaseAttributeSet* AttributeSet = InstanceData.AbilitySystemComponent->GetSet<UBaseAttributeSet>();
 	if (!AttributeSet)
 	{
-		DEBUG_LOG(TEXT("BaseAttributeSet is not valid in HealthRateEvaluator"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("BaseAttributeSet is not valid in HealthRateEvaluator"));
 		InstanceData.HealthRate = 1.0f;
 		return;
 	}
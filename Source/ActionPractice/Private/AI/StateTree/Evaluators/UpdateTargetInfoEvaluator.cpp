@@ -1,16 +1,9 @@
 ﻿#include "AI/StateTree/Evaluators/UpdateTargetInfoEvaluator.h"
 #include "AI/EnemyAIController.h"
+#include "AI/StateTree/GASStateTreeAIComponent.h"
 #include "Characters/ActionPracticeCharacter.h"
 #include "StateTreeExecutionContext.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogUpdateTargetInfoEvaluator, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogUpdateTargetInfoEvaluator, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 void FUpdateTargetInfoEvaluator::TreeStart(FStateTreeExecutionContext& Context) const
 {
@@ -18,17 +11,17 @@ void FUpdateTargetInfoEvaluator::TreeStart(FStateTreeExecutionContext& Context)
 
 	if (!InstanceData.SourceActor)
 	{
-		DEBUG_LOG(TEXT("SourceActor is not valid in UpdateTargetInfoEvaluator"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("SourceActor is not valid in UpdateTargetInfoEvaluator"));
 		return;
 	}
 
 	if (!InstanceData.AIController)
 	{
-		DEBUG_LOG(TEXT("AIController is not valid in UpdateTargetInfoEvaluator"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("AIController is not valid in UpdateTargetInfoEvaluator"));
 		return;
 	}
 
-	DEBUG_LOG(TEXT("UpdateTargetInfoEvaluator TreeStart"));
+	AP_DEBUG_LOG(LogAPAI, TEXT("UpdateTargetInfoEvaluator TreeStart"));
 }
 
 void FUpdateTargetInfoEvaluator::TreeStop(FStateTreeExecutionContext& Context) const
@@ -40,7 +33,7 @@ void FUpdateTargetInfoEvaluator::TreeStop(FStateTreeExecutionContext& Context) c
 	InstanceData.AngleToTarget = 0.0f;
 	InstanceData.bTargetDetected = false;
 
-	DEBUG_LOG(TEXT("UpdateTargetInfoEvaluator TreeStop"));
+	AP_DEBUG_LOG(LogAPAI, TEXT("UpdateTargetInfoEvaluator TreeStop"));
 }
 
 void FUpdateTargetInfoEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
@@ -71,28 +64,23 @@ void FUpdateTargetInfoEvaluator::UpdateTargetInfo(FStateTreeExecutionContext& Co
 		return;
 	}
 
-	InstanceData.DetectedTarget = TargetActor;
+	//거리/각도는 EnemyBrainSubsystem에서 일괄 계산한 결과 사용
+	const UGASStateTreeAIComponent* StateTreeComponent = InstanceData.AIController->GetStateTreeComponent();
+	const FEnemyBrainResult Result = StateTreeComponent ? StateTreeComponent->GetBrainResult() : FEnemyBrainResult();
+	if (!Result.bTargetDetected)
+	{
+		InstanceData.DetectedTarget = nullptr;
+		InstanceData.DistanceToTarget = -1.0f;
+		InstanceData.AngleToTarget = 0.0f;
+		InstanceData.bTargetDetected = false;
+		return;
+	}
 
-	const FVector SourceLocation = InstanceData.SourceActor->GetActorLocation();
-	const FVector TargetLocation = TargetActor->GetActorLocation();
+	InstanceData.DetectedTarget = TargetActor;
 
-	//거리 계산
-	const float Distance = FVector::Dist(SourceLocation, TargetLocation);
+	const float Distance = Result.DistanceToTarget;
+	const float SignedAngle = Result.AngleToTarget;
 	InstanceData.DistanceToTarget = Distance;
-
-	//각도 계산 (Enemy의 정면 기준 Target과의 Yaw 각도)
-	const FVector DirectionToTarget = (TargetLocation - SourceLocation).GetSafeNormal();
-	const FVector ForwardVector = InstanceData.SourceActor->GetActorForwardVector();
-
-	//내적을 이용한 각도 계산 (0~180도)
-	const float DotProduct = FVector::DotProduct(ForwardVector, DirectionToTarget);
-	const float AngleRadians = FMath::Acos(DotProduct);
-	const float AngleDegrees = FMath::RadiansToDegrees(AngleRadians);
-
-	//외적을 이용하여 좌우 방향 판별 (음수면 왼쪽, 양수면 오른쪽)
-	const FVector CrossProduct = FVector::CrossProduct(ForwardVector, DirectionToTarget);
-	const float SignedAngle = (CrossProduct.Z < 0.0f) ? -AngleDegrees : AngleDegrees;
-
 	InstanceData.AngleToTarget = SignedAngle;
 	InstanceData.bTargetDetected = true;
 
@@ -100,5 +88,5 @@ void FUpdateTargetInfoEvaluator::UpdateTargetInfo(FStateTreeExecutionContext& Co
 	InstanceData.AIController->CurrentTarget.Distance = Distance;
 	InstanceData.AIController->CurrentTarget.AngleToTarget = SignedAngle;
 
-	DEBUG_LOG(TEXT("Target Info Updated - Distance: %.2f, Angle: %.2f"), Distance, SignedAngle);
+	AP_DEBUG_LOG(LogAPAI, TEXT("Target Info Updated - Distance: %.2f, Angle: %.2f"), Distance, SignedAngle);
 }
@@ -1,6 +1,66 @@
 #include "AI/StateTree/GASStateTreeAIComponent.h"
+#include "AI/EnemyAIController.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
 
 TSubclassOf<UStateTreeSchema> UGASStateTreeAIComponent::GetSchema() const
 {
 	return UGASStateTreeAIComponentSchema::StaticClass();
 }
+
+void UGASStateTreeAIComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	BrainSubsystem = GetWorld()->GetSubsystem<UEnemyBrainSubsystem>();
+	UEnemyBrainSubsystem::RegisterAgent(this);
+}
+
+void UGASStateTreeAIComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UEnemyBrainSubsystem::UnregisterAgent(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGASStateTreeAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	UEnemyBrainSubsystem* Subsystem = BrainSubsystem.Get();
+	if (!Subsystem || !Subsystem->IsBenchmarking())
+	{
+		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Subsystem->AddTreeTickTime(FPlatformTime::Seconds() - StartTime);
+}
+
+void UGASStateTreeAIComponent::SetBrainResult(const FEnemyBrainResult& InResult, const AActor* InTarget)
+{
+	BrainResult = InResult;
+	BrainResultFrame = GFrameCounter;
+	BrainResultTarget = InTarget;
+}
+
+FEnemyBrainResult UGASStateTreeAIComponent::GetBrainResult() const
+{
+	const AEnemyAIController* AIController = Cast<AEnemyAIController>(GetAIOwner());
+	const AActor* CurrentTarget = AIController ? AIController->GetCurrentTargetActor() : nullptr;
+
+	//브레인 갱신 Tick이 이 컴포넌트 Tick의 선행 조건이므로 같은 프레임 결과만 사용
+	const bool bFresh = BrainResultFrame != 0 && BrainResultFrame == GFrameCounter;
+	if (UEnemyBrainSubsystem::IsBatchUpdateEnabled() && bFresh && BrainResultTarget.Get() == CurrentTarget)
+	{
+		return BrainResult;
+	}
+
+	FEnemyBrainResult Result;
+	FEnemyBrainSnapshot Snapshot;
+	if (UEnemyBrainSubsystem::GatherSnapshot(AIController, Snapshot))
+	{
+		UEnemyBrainSubsystem::EvaluateSnapshot(Snapshot, Result);
+	}
+	return Result;
+}
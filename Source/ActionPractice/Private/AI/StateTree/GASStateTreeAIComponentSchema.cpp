@@ -10,16 +10,9 @@
 #include "Characters/BossCharacter.h"
 #include "GAS/AbilitySystemComponent/BossAbilitySystemComponent.h"
 #include "AbilitySystemComponent.h"
+#include "Games/ActionPracticeLog.h"
 
 
-#define ENABLE_DEBUG_LOG 0
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossStateTreeSchema, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBossStateTreeSchema, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
-
 bool UGASStateTreeAIComponentSchema::IsStructAllowed(const UScriptStruct* InScriptStruct) const
 {
 	//Task, Evaluator, Condition 허용
@@ -96,7 +89,7 @@ void UGASStateTreeAIComponentSchema::SetContextData(FContextDataSetter& ContextD
 
 	if (ASC != LastASC)
 	{
-		DEBUG_LOG(TEXT("Schema::SetContextData: ASC Changed! Old=%p, New=%p, Actor=%s"),
+		AP_DEBUG_LOG(LogAPAI, TEXT("Schema::SetContextData: ASC Changed! Old=%p, New=%p, Actor=%s"),
 			LastASC,
 			ASC,
 			*GetNameSafe(OwnerActor ? OwnerActor : FallbackOwner));
@@ -107,10 +100,10 @@ void UGASStateTreeAIComponentSchema::SetContextData(FContextDataSetter& ContextD
 	//ASC를 Context에 설정
 	if (!ContextDataSetter.SetContextDataByName(TEXT("AbilitySystemComponent"), FStateTreeDataView(ASC)))
 	{
-		DEBUG_LOG(TEXT("Schema::SetContextData: FAILED to set ASC in context. ASC=%p"), ASC);
+		AP_DEBUG_LOG(LogAPAI, TEXT("Schema::SetContextData: FAILED to set ASC in context. ASC=%p"), ASC);
 		if (bLogErrors && !ASC)
 		{
-			DEBUG_LOG(TEXT("Schema::SetContextData: bLogErrors=true and ASC is nullptr"));
+			AP_DEBUG_LOG(LogAPAI, TEXT("Schema::SetContextData: bLogErrors=true and ASC is nullptr"));
 		}
 	}
 }
@@ -2,35 +2,29 @@
 #include "AbilitySystemComponent.h"
 #include "StateTreeAsyncExecutionContext.h"
 #include "StateTreeExecutionContext.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-    DEFINE_LOG_CATEGORY_STATIC(LogActivateAbilityTask, Log, All);
-    #define DEBUG_LOG(Format, ...) UE_LOG(LogActivateAbilityTask, Warning, Format, ##__VA_ARGS__)
-#else
-    #define DEBUG_LOG(Format, ...)
-#endif
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Games/ActionPracticeLog.h"
 
 EStateTreeRunStatus FActivateAbilityTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
 {
     FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-    DEBUG_LOG(TEXT("EnterState: AbilityTask started. InstanceData=%p"), &InstanceData);
+    AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: AbilityTask started. InstanceData=%p"), &InstanceData);
 
     InstanceData.bAbilityEnded = false;
     InstanceData.bAbilityCancelled = false;
-    InstanceData.ElapsedEndDelay = 0.0f;
+    InstanceData.bWaitingForEnd = false;
 
     if (!InstanceData.AbilitySystemComponent)
     {
-        DEBUG_LOG(TEXT("EnterState: ASC is nullptr"));
+        AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: ASC is nullptr"));
         return EStateTreeRunStatus::Failed;
     }
 
     if (!InstanceData.AbilityToActivate)
     {
-        DEBUG_LOG(TEXT("EnterState: AbilityToActivate is nullptr"));
+        AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: AbilityToActivate is nullptr"));
         return EStateTreeRunStatus::Failed;
     }
     
@@ -38,7 +32,7 @@ EStateTreeRunStatus FActivateAbilityTask::EnterState(FStateTreeExecutionContext&
 
     if (!Spec)
     {
-        DEBUG_LOG(TEXT("EnterState: No AbilitySpec. Ability=%s, ASC=%p"),
+        AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: No AbilitySpec. Ability=%s, ASC=%p"),
             *GetNameSafe(InstanceData.AbilityToActivate),
             InstanceData.AbilitySystemComponent.Get());
         return EStateTreeRunStatus::Failed;
@@ -46,91 +40,122 @@ EStateTreeRunStatus FActivateAbilityTask::EnterState(FStateTreeExecutionContext&
 
     InstanceData.AbilityHandle = Spec->Handle;
 
-    DEBUG_LOG(TEXT("EnterState: Using Ability=%s, Handle=%s, ASC=%p"),
+    AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: Using Ability=%s, Handle=%s, ASC=%p"),
         *GetNameSafe(InstanceData.AbilityToActivate),
         *InstanceData.AbilityHandle.ToString(),
         InstanceData.AbilitySystemComponent.Get());
 
+    //활성화 중 즉시 종료되는 어빌리티도 놓치지 않도록 활성화 전에 종료 이벤트 구독
+    FStateTreeWeakExecutionContext WeakContext = Context.MakeWeakExecutionContext();
+    InstanceData.AbilityEndedHandle = InstanceData.AbilitySystemComponent->OnAbilityEnded.AddLambda(
+        [this, WeakContext](const FAbilityEndedData& EndedData)
+        {
+            FInstanceDataType* Data = WeakContext.GetInstanceDataPtr<FInstanceDataType>(*this);
+            if (!Data || Data->bAbilityEnded || EndedData.AbilitySpecHandle != Data->AbilityHandle)
+            {
+                return;
+            }
+
+            Data->bAbilityEnded = true;
+            Data->bAbilityCancelled = EndedData.bWasCancelled;
+
+            AP_DEBUG_LOG(LogAPAI, TEXT("OnAbilityEnded: Ability=%s, Cancelled=%d"), *GetNameSafe(EndedData.AbilityThatEnded), EndedData.bWasCancelled);
+
+            //EnterState 진행 중이면 EnterState에서 결과 처리
+            if (Data->bWaitingForEnd)
+            {
+                HandleAbilityEnded(WeakContext, *Data);
+            }
+        });
+
     //어빌리티 활성화
     const bool bSuccess = InstanceData.AbilitySystemComponent->TryActivateAbility(InstanceData.AbilityHandle, true);
 
     if (!bSuccess)
     {
-        DEBUG_LOG(TEXT("EnterState: TryActivateAbility FAILED. Ability=%s, Handle=%s"),
+        AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: TryActivateAbility FAILED. Ability=%s, Handle=%s"),
             *GetNameSafe(InstanceData.AbilityToActivate),
             *InstanceData.AbilityHandle.ToString());
+        InstanceData.AbilitySystemComponent->OnAbilityEnded.Remove(InstanceData.AbilityEndedHandle);
+        InstanceData.AbilityEndedHandle.Reset();
         return EStateTreeRunStatus::Failed;
     }
 
-    DEBUG_LOG(TEXT("EnterState: TryActivateAbility SUCCEEDED. Ability=%s, Handle=%s"),
+    AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: TryActivateAbility SUCCEEDED. Ability=%s, Handle=%s"),
         *GetNameSafe(InstanceData.AbilityToActivate),
         *InstanceData.AbilityHandle.ToString());
 
+    //활성화 도중 이미 종료된 경우
+    if (InstanceData.bAbilityEnded)
+    {
+        if (InstanceData.EndDelay <= 0.0f)
+        {
+            AP_DEBUG_LOG(LogAPAI, TEXT("EnterState: Ability ended during activation - Task SUCCEEDED"));
+            return EStateTreeRunStatus::Succeeded;
+        }
+
+        HandleAbilityEnded(WeakContext, InstanceData);
+        return EStateTreeRunStatus::Running;
+    }
+
+    InstanceData.bWaitingForEnd = true;
     return EStateTreeRunStatus::Running;
 }
 
-EStateTreeRunStatus FActivateAbilityTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+void FActivateAbilityTask::HandleAbilityEnded(const FStateTreeWeakExecutionContext& WeakContext, FInstanceDataType& InstanceData) const
 {
-    FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+    UWorld* World = InstanceData.AbilitySystemComponent ? InstanceData.AbilitySystemComponent->GetWorld() : nullptr;
 
-    if (!InstanceData.AbilitySystemComponent || !InstanceData.AbilityHandle.IsValid())
+    //EndDelay가 없으면 어빌리티가 끝난 프레임에 바로 종료
+    if (InstanceData.EndDelay <= 0.0f || !World)
     {
-        DEBUG_LOG(TEXT("Tick: ASC or Handle invalid - Task FAILED"));
-        return EStateTreeRunStatus::Failed;
+        AP_DEBUG_LOG(LogAPAI, TEXT("HandleAbilityEnded: Ability is no longer active - Task SUCCEEDED"));
+        WeakContext.FinishTask(*this, EStateTreeFinishTaskType::Succeeded);
+        return;
     }
 
-    //Spec 상태를 직접 확인
-    const FGameplayAbilitySpec* Spec = InstanceData.AbilitySystemComponent->FindAbilitySpecFromHandle(InstanceData.AbilityHandle);
-
-    if (!Spec)
-    {
-        DEBUG_LOG(TEXT("Tick: Spec is nullptr - Ability removed - Task FAILED"));
-        return EStateTreeRunStatus::Failed;
-    }
-
-    //IsActive가 false이면 어빌리티가 끝난 것
-    if (!Spec->IsActive())
-    {
-        //EndDelay 적용
-        if (InstanceData.EndDelay > 0.0f)
+    //EndDelay 이후 한 번만 깨어나서 종료
+    AP_DEBUG_LOG(LogAPAI, TEXT("HandleAbilityEnded: Ability completed. Waiting for EndDelay (%.2fs)"), InstanceData.EndDelay);
+    World->GetTimerManager().SetTimer(
+        InstanceData.EndDelayTimerHandle,
+        FTimerDelegate::CreateLambda([this, WeakContext]()
         {
-            InstanceData.ElapsedEndDelay += DeltaTime;
-
-            if (InstanceData.ElapsedEndDelay >= InstanceData.EndDelay)
-            {
-                DEBUG_LOG(TEXT("Tick: Ability completed. EndDelay finished (%.2fs) - Task SUCCEEDED"), InstanceData.EndDelay);
-                return EStateTreeRunStatus::Succeeded;
-            }
-
-            DEBUG_LOG(TEXT("Tick: Ability completed. Waiting for EndDelay (%.2f / %.2fs)"), InstanceData.ElapsedEndDelay, InstanceData.EndDelay);
-            return EStateTreeRunStatus::Running;
-        }
-        else
-        {
-            DEBUG_LOG(TEXT("Tick: Ability is no longer active - Task SUCCEEDED"));
-            return EStateTreeRunStatus::Succeeded;
-        }
-    }
-
-    //아직 실행 중
-    return EStateTreeRunStatus::Running;
+            AP_DEBUG_LOG(LogAPAI, TEXT("EndDelay finished - Task SUCCEEDED"));
+            WeakContext.FinishTask(*this, EStateTreeFinishTaskType::Succeeded);
+        }),
+        InstanceData.EndDelay,
+        false);
 }
 
 void FActivateAbilityTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
 {
     FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-    DEBUG_LOG(TEXT("ExitState: Called. Ability=%s, Handle=%s, ASC=%p"),
+    AP_DEBUG_LOG(LogAPAI, TEXT("ExitState: Called. Ability=%s, Handle=%s, ASC=%p"),
         *GetNameSafe(InstanceData.AbilityToActivate),
         *InstanceData.AbilityHandle.ToString(),
         InstanceData.AbilitySystemComponent.Get());
 
-    if (InstanceData.AbilitySystemComponent && InstanceData.AbilityHandle.IsValid())
+    InstanceData.bWaitingForEnd = false;
+
+    if (InstanceData.AbilitySystemComponent)
     {
-        //아직 활성화 중이면 취소
-        InstanceData.AbilitySystemComponent->CancelAbilityHandle(InstanceData.AbilityHandle);
-        DEBUG_LOG(TEXT("ExitState: Cancelled ability via CancelAbilityHandle"));
+        //취소로 인한 종료 이벤트가 다시 들어오지 않도록 먼저 구독 해제
+        InstanceData.AbilitySystemComponent->OnAbilityEnded.Remove(InstanceData.AbilityEndedHandle);
+        InstanceData.AbilityEndedHandle.Reset();
+
+        if (UWorld* World = InstanceData.AbilitySystemComponent->GetWorld())
+        {
+            World->GetTimerManager().ClearTimer(InstanceData.EndDelayTimerHandle);
+        }
+
+        if (InstanceData.AbilityHandle.IsValid() && !InstanceData.bAbilityEnded)
+        {
+            //아직 활성화 중이면 취소
+            InstanceData.AbilitySystemComponent->CancelAbilityHandle(InstanceData.AbilityHandle);
+            AP_DEBUG_LOG(LogAPAI, TEXT("ExitState: Cancelled ability via CancelAbilityHandle"));
+        }
     }
 
-    DEBUG_LOG(TEXT("ExitState: Finished."));
+    AP_DEBUG_LOG(LogAPAI, TEXT("ExitState: Finished."));
 }
@@ -0,0 +1,69 @@
+#include "AI/StateTree/Tasks/SquadMoveToTask.h"
+#include "AI/EnemyPathSubsystem.h"
+#include "AIController.h"
+#include "GameFramework/Pawn.h"
+#include "StateTreeExecutionContext.h"
+#include "Games/ActionPracticeLog.h"
+
+EStateTreeRunStatus FSquadMoveToTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	if (!InstanceData.AIController || !InstanceData.AIController->GetPawn())
+	{
+		AP_DEBUG_LOG(LogAPAI, TEXT("SquadMoveToTask: AIController or Pawn is not valid"));
+		return EStateTreeRunStatus::Failed;
+	}
+
+	if (HasArrived(InstanceData))
+	{
+		return EStateTreeRunStatus::Succeeded;
+	}
+
+	UEnemyPathSubsystem::SetAgentGoal(InstanceData.AIController, InstanceData.TargetActor, InstanceData.TargetLocation, InstanceData.AcceptanceRadius);
+
+	return EStateTreeRunStatus::Running;
+}
+
+EStateTreeRunStatus FSquadMoveToTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	if (!InstanceData.AIController || !InstanceData.AIController->GetPawn())
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	if (HasArrived(InstanceData))
+	{
+		return EStateTreeRunStatus::Succeeded;
+	}
+
+	if (UEnemyPathSubsystem::GetAgentStatus(InstanceData.AIController) == EEnemyPathStatus::Failed)
+	{
+		AP_DEBUG_LOG(LogAPAI, TEXT("SquadMoveToTask: No path to goal"));
+		return EStateTreeRunStatus::Failed;
+	}
+
+	return EStateTreeRunStatus::Running;
+}
+
+void FSquadMoveToTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	if (!InstanceData.AIController) return;
+
+	UEnemyPathSubsystem::ClearAgentGoal(InstanceData.AIController);
+	InstanceData.AIController->StopMovement();
+}
+
+bool FSquadMoveToTask::HasArrived(const FInstanceDataType& InstanceData) const
+{
+	const FVector Goal = InstanceData.TargetActor ? InstanceData.TargetActor->GetActorLocation() : InstanceData.TargetLocation;
+	const APawn* Pawn = InstanceData.AIController->GetPawn();
+
+	//이동 요청/EnemyPathSubsystem의 도착 판정과 같이 폰 충돌 반경 포함
+	const float ReachRadius = InstanceData.AcceptanceRadius + Pawn->GetSimpleCollisionRadius();
+	return FVector::DistSquared2D(Pawn->GetActorLocation(), Goal) <= FMath::Square(ReachRadius);
+}
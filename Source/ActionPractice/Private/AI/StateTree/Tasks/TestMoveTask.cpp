@@ -3,15 +3,7 @@
 #include "AI/StateTree/Tasks/TestMoveTask.h"
 #include "GameFramework/Actor.h"
 #include "StateTreeExecutionContext.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogTestMoveTask, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogTestMoveTask, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 EStateTreeRunStatus FTestMoveTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
 {
@@ -19,13 +11,13 @@ EStateTreeRunStatus FTestMoveTask::EnterState(FStateTreeExecutionContext& Contex
 
 	if (!InstanceData.Actor)
 	{
-		DEBUG_LOG(TEXT("TestMoveTask: Actor is not valid"));
+		AP_DEBUG_LOG(LogAPAI, TEXT("TestMoveTask: Actor is not valid"));
 		return EStateTreeRunStatus::Failed;
 	}
 
 	InstanceData.ElapsedTime = 0.0f;
 
-	DEBUG_LOG(TEXT("TestMoveTask: Started moving forward for %.1f seconds at speed %.1f"), InstanceData.Duration, InstanceData.Speed);
+	AP_DEBUG_LOG(LogAPAI, TEXT("TestMoveTask: Started moving forward for %.1f seconds at speed %.1f"), InstanceData.Duration, InstanceData.Speed);
 
 	return EStateTreeRunStatus::Running;
 }
@@ -44,7 +36,7 @@ EStateTreeRunStatus FTestMoveTask::Tick(FStateTreeExecutionContext& Context, con
 	// Duration 경과 체크
 	if (InstanceData.ElapsedTime >= InstanceData.Duration)
 	{
-		DEBUG_LOG(TEXT("TestMoveTask: Completed after %.2f seconds"), InstanceData.ElapsedTime);
+		AP_DEBUG_LOG(LogAPAI, TEXT("TestMoveTask: Completed after %.2f seconds"), InstanceData.ElapsedTime);
 		return EStateTreeRunStatus::Succeeded;
 	}
 
@@ -62,5 +54,5 @@ void FTestMoveTask::ExitState(FStateTreeExecutionContext& Context, const FStateT
 {
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	DEBUG_LOG(TEXT("TestMoveTask: Exited after %.2f seconds"), InstanceData.ElapsedTime);
+	AP_DEBUG_LOG(LogAPAI, TEXT("TestMoveTask: Exited after %.2f seconds"), InstanceData.ElapsedTime);
 }
@@ -4,6 +4,7 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "Characters/CameraProbeSpringArmComponent.h"
 #include "GameFramework/Controller.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
@@ -20,18 +21,11 @@
 #include "Input/InputActionDataAsset.h"
 #include "Items/Weapon.h"
 #include "Items/WeaponDataAsset.h"
+#include "Games/ActionPracticeLog.h"
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
 // 디버그 로그 활성화/비활성화 (0: 비활성화, 1: 활성화)
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogActionPracticeCharacter, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogActionPracticeCharacter, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
 
 AActionPracticeCharacter::AActionPracticeCharacter()
 {
@@ -54,8 +48,8 @@ AActionPracticeCharacter::AActionPracticeCharacter()
 	GetCharacterMovement()->BrakingDecelerationWalking = 2000.f;
 	GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
-	//Camera Boom Settings
-	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
+	//Camera Boom Settings, 카메라 충돌은 CameraQuerySubsystem 비동기 프로브
+	CameraBoom = CreateDefaultSubobject<UCameraProbeSpringArmComponent>(TEXT("CameraBoom"));
 	CameraBoom->SetupAttachment(RootComponent);
 	CameraBoom->TargetArmLength = 400.0f;
 	CameraBoom->bUsePawnControlRotation = true;
@@ -85,19 +79,19 @@ void AActionPracticeCharacter::BeginPlay()
 
 	if (!StateRecoveringTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateRecoveringTag is not valid"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("StateRecoveringTag is not valid"));
 	}
 	if (!StateAbilitySprintingTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateAbilitySprintingTag is not valid"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("StateAbilitySprintingTag is not valid"));
 	}
 	if (!StateAbilityAttackingTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateAbilityAttackingTag is not valid"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("StateAbilityAttackingTag is not valid"));
 	}
 	if (!AbilityAttackTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("AbilityAttackTag is not valid"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("AbilityAttackTag is not valid"));
 	}
 
 	InitializeAbilitySystem();
@@ -119,22 +113,22 @@ void AActionPracticeCharacter::BeginPlay()
 				if (AttributeSet)
 				{
 					PlayerStatsWidget->SetAttributeSet(GetAttributeSet());
-					DEBUG_LOG(TEXT("PlayerStatsWidget created and AttributeSet connected"));
+					AP_DEBUG_LOG(LogAPCharacter, TEXT("PlayerStatsWidget created and AttributeSet connected"));
 				}
 				else
 				{
-					DEBUG_LOG(TEXT("AttributeSet is nullptr!"));
+					AP_DEBUG_LOG(LogAPCharacter, TEXT("AttributeSet is nullptr!"));
 				}
 			}
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("PlayerController is nullptr!"));
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("PlayerController is nullptr!"));
 		}
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("PlayerStatsWidgetClass is not set!"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("PlayerStatsWidgetClass is not set!"));
 	}
 }
 
@@ -144,6 +138,12 @@ void AActionPracticeCharacter::Tick(float DeltaSeconds)
 	UpdateLockOnCamera();
 }
 
+bool AActionPracticeCharacter::HasTickWork() const
+{
+	//락온 중에는 카메라 갱신을 위해 Tick 유지
+	return Super::HasTickWork() || (bIsLockOn && LockedOnTarget);
+}
+
 void AActionPracticeCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	// Set up action bindings
@@ -153,6 +153,7 @@ void AActionPracticeCharacter::SetupPlayerInputComponent(UInputComponent* Player
 		if (IA_Move)
 		{
 			EnhancedInputComponent->BindAction(IA_Move, ETriggerEvent::Triggered, this, &AActionPracticeCharacter::Move);
+			EnhancedInputComponent->BindAction(IA_Move, ETriggerEvent::Completed, this, &AActionPracticeCharacter::MoveCompleted);
 		}
         
 		if (IA_Look)
@@ -283,6 +284,11 @@ void AActionPracticeCharacter::Move(const FInputActionValue& Value)
 	}
 }
 
+void AActionPracticeCharacter::MoveCompleted()
+{
+	OnMoveInputReleased.Broadcast();
+}
+
 FVector2D AActionPracticeCharacter::GetCurrentMovementInput() const
 {
 	APlayerController* PC = GetController<APlayerController>();
@@ -371,11 +377,11 @@ void AActionPracticeCharacter::CancelActionForMove()
 			FGameplayTagContainer CancelTags;
 			CancelTags.AddTag(AbilityAttackTag);
 			AbilitySystemComponent->CancelAbilities(&CancelTags);
-			DEBUG_LOG(TEXT("Attack Ability Cancelled by Move Input"));
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Attack Ability Cancelled by Move Input"));
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("Attack Ability is in Recovering state - cannot cancel"));
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Attack Ability is in Recovering state - cannot cancel"));
 		}
 	}
 }
@@ -409,7 +415,8 @@ void AActionPracticeCharacter::ToggleLockOn()
 			//필요하면 카메라 설정 복원
 		}
 
-		DEBUG_LOG(TEXT("Lock-On Released"));
+		RefreshTickEnabled();
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Lock-On Released"));
 	}
 	else
 	{
@@ -418,12 +425,13 @@ void AActionPracticeCharacter::ToggleLockOn()
 		{
 			bIsLockOn = true;
 			LockedOnTarget = NearestTarget;
+			RefreshTickEnabled();
 
-			DEBUG_LOG(TEXT("Lock-On Target: %s"), *NearestTarget->GetName());
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Lock-On Target: %s"), *NearestTarget->GetName());
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("No valid target found for Lock-On"));
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("No valid target found for Lock-On"));
 		}
 	}
 }
@@ -517,7 +525,7 @@ void AActionPracticeCharacter::EquipWeapon(TSubclassOf<AWeapon> NewWeaponClass,
 		}
 		
 		FName SocketName = FName(*SocketString);
-		DEBUG_LOG(TEXT("Equiped Weapon: %s"), *SocketString);
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Equiped Weapon: %s"), *SocketString);
 		NewWeapon->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
 
 		if(bIsTwoHanded)
@@ -562,7 +570,7 @@ TSubclassOf<AWeapon> AActionPracticeCharacter::LoadWeaponClassByName(const FStri
 		return TSubclassOf<AWeapon>(LoadedClass);
 	}
 
-	DEBUG_LOG(TEXT("Failed to load weapon class from path: %s"), *BlueprintPath);
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("Failed to load weapon class from path: %s"), *BlueprintPath);
 	return nullptr;
 }
 #pragma endregion
@@ -647,7 +655,7 @@ void AActionPracticeCharacter::GASInputPressed(const UInputAction* InputAction)
 	//다른 어빌리티가 수행중이고 입력 저장 가능할 때는 버퍼로 전달, Ability->InputPressed는 버퍼 이외의 구간에서만 사용
 	if (InputBufferComponent->bCanBufferInput)
 	{
-		DEBUG_LOG(TEXT("Character: Buffer"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Character: Buffer"));
 		InputBufferComponent->BufferNextAction(InputAction);
 	}
 
@@ -680,7 +688,7 @@ void AActionPracticeCharacter::GASInputReleased(const UInputAction* InputAction)
 	//다른 어빌리티가 수행중이고 입력 저장 가능할 때는 버퍼로 전달, Ability->InputPressed는 버퍼 이외의 구간에서만 사용
 	if (InputBufferComponent->bCanBufferInput)
 	{
-		DEBUG_LOG(TEXT("Character: UnBuffer"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Character: UnBuffer"));
 		InputBufferComponent->UnBufferHoldAction(InputAction);
 	}
 	
@@ -705,14 +713,14 @@ TArray<FGameplayAbilitySpec*> AActionPracticeCharacter::FindAbilitySpecsWithInpu
 	const FInputActionAbilityRule* Rule = InputActionData->FindRuleByAction(InputAction);
 	if (!Rule)
 	{
-		DEBUG_LOG(TEXT("FindAbilitySpecsWithInputAction: No Rule"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("FindAbilitySpecsWithInputAction: No Rule"));
 		return SameAssetSpecs;
 	}
 	
 	const FGameplayTagContainer* InputAssetTags = &Rule->AbilityAssetTags;
 	if (!InputAssetTags)
 	{
-		DEBUG_LOG(TEXT("FindAbilitySpecsWithInputAction: No InputAssetTags"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("FindAbilitySpecsWithInputAction: No InputAssetTags"));
 		return SameAssetSpecs;
 	}
     
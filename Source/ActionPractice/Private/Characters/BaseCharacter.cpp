@@ -3,33 +3,80 @@
 #include "GameplayAbilities/Public/Abilities/GameplayAbility.h"
 #include "GAS/AttributeSet/BaseAttributeSet.h"
 #include "Items/AttackData.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseCharacter, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseCharacter, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/TickAuditSubsystem.h"
+#include "Characters/HitDetection/LagCompensationSubsystem.h"
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "Notifies/NotifyEventSubsystem.h"
+#include "GAS/GameplayTagsSubsystem.h"
+#include "TimerManager.h"
+#include "Games/ActionPracticeLog.h"
 
 ABaseCharacter::ABaseCharacter()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void ABaseCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	ApplyAnimationUpdateRateSettings(false);
 	InitializeAbilitySystem();
+
+	//서버에서 랙 보상용 트랜스폼 기록 시작
+	ULagCompensationSubsystem::RegisterCharacter(this);
+
+	//피격 캡슐 판정 등록 (HurtboxSet이 있을 때만)
+	UHurtboxSubsystem::RegisterCharacter(this);
+
+	//노티파이 이벤트가 이 메시 애니메이션 직후 전달되도록
+	UNotifyEventSubsystem::RegisterAnimatedMesh(GetMesh());
+}
+
+void ABaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ULagCompensationSubsystem::UnregisterCharacter(this);
+	UHurtboxSubsystem::UnregisterCharacter(this);
+	UNotifyEventSubsystem::UnregisterAnimatedMesh(GetMesh());
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABaseCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
+
+	OnMovementModeChangedNative.Broadcast();
 }
 
 void ABaseCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (!HasTickWork())
+	{
+		UTickAuditSubsystem::ReportIdleTick(this);
+	}
+
 	UpdateActionRotation(DeltaTime);
+
+	//작업이 끝나면 Tick 비활성화
+	RefreshTickEnabled();
+}
+
+bool ABaseCharacter::HasTickWork() const
+{
+	return bIsRotatingForAction;
+}
+
+void ABaseCharacter::RefreshTickEnabled()
+{
+	const bool bNeedsTick = HasTickWork();
+	if (IsActorTickEnabled() != bNeedsTick)
+	{
+		SetActorTickEnabled(bNeedsTick);
+	}
 }
 
 UAbilitySystemComponent* ABaseCharacter::GetAbilitySystemComponent() const
@@ -94,7 +141,7 @@ void ABaseCharacter::RotateToRotation(const FRotator& TargetRotation, float Rota
 	{
 		SetActorRotation(TargetActionRotation);
 		bIsRotatingForAction = false;
-		DEBUG_LOG(TEXT("RotateToRotation: Instant rotation"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("RotateToRotation: Instant rotation"));
 		return;
 	}
 
@@ -109,7 +156,7 @@ void ABaseCharacter::RotateToRotation(const FRotator& TargetRotation, float Rota
 	{
 		SetActorRotation(TargetActionRotation);
 		bIsRotatingForAction = false;
-		DEBUG_LOG(TEXT("RotateToRotation: Minor rotation"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("RotateToRotation: Minor rotation"));
 		return;
 	}
 
@@ -118,7 +165,8 @@ void ABaseCharacter::RotateToRotation(const FRotator& TargetRotation, float Rota
 	CurrentRotationTime = 0.0f;
 	TotalRotationTime = RotateTime;
 	bIsRotatingForAction = true;
-	DEBUG_LOG(TEXT("RotateToRotation: Starting smooth rotation over %.2f seconds"), RotateTime);
+	RefreshTickEnabled();
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("RotateToRotation: Starting smooth rotation over %.2f seconds"), RotateTime);
 }
 
 void ABaseCharacter::RotateToPosition(const FVector& TargetLocation, float RotateTime)
@@ -157,6 +205,137 @@ void ABaseCharacter::UpdateActionRotation(float DeltaTime)
 		SetActorRotation(TargetActionRotation);
 		bIsRotatingForAction = false;
 		CurrentRotationTime = 0.0f;
-		DEBUG_LOG(TEXT("UpdateActionRotation: Rotation completed"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("UpdateActionRotation: Rotation completed"));
+	}
+}
+
+void ABaseCharacter::OpenHurtboxWindow(EHurtboxWindow Window, float Duration)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	HurtboxState.Open(Window, World->GetTimeSeconds(), Duration);
+
+	//태그는 서버에서만 부여, 구간이 끝나면 타이머로 제거 (다시 열면 타이머만 갱신)
+	if (!HasAuthority()) return;
+
+	SetHurtboxWindowTag(Window, true);
+
+	FTimerHandle& TagTimer = HurtboxWindowTagTimers[static_cast<uint8>(Window)];
+	if (Duration > 0.0f)
+	{
+		World->GetTimerManager().SetTimer(TagTimer, FTimerDelegate::CreateUObject(this, &ABaseCharacter::SetHurtboxWindowTag, Window, false), Duration, false);
 	}
-}
\ No newline at end of file
+	else
+	{
+		World->GetTimerManager().ClearTimer(TagTimer);
+	}
+}
+
+void ABaseCharacter::CloseHurtboxWindow(EHurtboxWindow Window)
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	HurtboxState.Close(Window, World->GetTimeSeconds());
+
+	if (!HasAuthority()) return;
+
+	World->GetTimerManager().ClearTimer(HurtboxWindowTagTimers[static_cast<uint8>(Window)]);
+	SetHurtboxWindowTag(Window, false);
+}
+
+FGameplayTag ABaseCharacter::GetHurtboxWindowTag(EHurtboxWindow Window)
+{
+	switch (Window)
+	{
+	case EHurtboxWindow::Invulnerable:
+		return UGameplayTagsSubsystem::GetStateInvincibleTag();
+	case EHurtboxWindow::JustRolled:
+		return UGameplayTagsSubsystem::GetStateAbilityJustRolledTag();
+	default:
+		return FGameplayTag();
+	}
+}
+
+void ABaseCharacter::SetHurtboxWindowTag(EHurtboxWindow Window, bool bGranted)
+{
+	bool& bTagGranted = HurtboxWindowTagGranted[static_cast<uint8>(Window)];
+	if (bTagGranted == bGranted) return;
+
+	const FGameplayTag Tag = GetHurtboxWindowTag(Window);
+	UAbilitySystemComponent* ASC = GetAbilitySystemComponent();
+	if (!Tag.IsValid() || !ASC) return;
+
+	//서버 태그 맵 + 클라이언트 복제용 (GE 없이 에셋/큐의 태그 조건 유지)
+	if (bGranted)
+	{
+		ASC->AddLooseGameplayTag(Tag);
+		ASC->AddReplicatedLooseGameplayTag(Tag);
+	}
+	else
+	{
+		ASC->RemoveLooseGameplayTag(Tag);
+		ASC->RemoveReplicatedLooseGameplayTag(Tag);
+	}
+	bTagGranted = bGranted;
+}
+
+bool ABaseCharacter::IsHurtboxWindowActive(EHurtboxWindow Window) const
+{
+	const UWorld* World = GetWorld();
+	return World && HurtboxState.IsActive(Window, World->GetTimeSeconds());
+}
+
+void ABaseCharacter::MulticastHitImpact_Implementation(const FHitImpactNetData& Impact)
+{
+	//예측 중인 소유 클라이언트는 자기 판정으로 이미 추가함
+	if (!HasAuthority() && IsLocallyControlled()) return;
+
+	UHitImpactSubsystem::QueueImpact(this, Impact);
+}
+
+void ABaseCharacter::PushFullRateAnimation()
+{
+	if (++FullRateAnimationRequestCount == 1)
+	{
+		ApplyAnimationUpdateRateSettings(true);
+	}
+}
+
+void ABaseCharacter::PopFullRateAnimation()
+{
+	if (FullRateAnimationRequestCount <= 0)
+	{
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("PopFullRateAnimation: Unbalanced pop"));
+		return;
+	}
+
+	if (--FullRateAnimationRequestCount == 0)
+	{
+		ApplyAnimationUpdateRateSettings(false);
+	}
+}
+
+void ABaseCharacter::ApplyAnimationUpdateRateSettings(bool bFullRate)
+{
+	USkeletalMeshComponent* MeshComp = GetMesh();
+	if (!MeshComp || !bUseAnimationUpdateRateOptimization)
+	{
+		return;
+	}
+
+	//판정 구간: 소켓 위치가 매 프레임 정확해야 하므로 URO 해제, 화면 밖에서도 본 갱신
+	if (bFullRate)
+	{
+		MeshComp->bEnableUpdateRateOptimizations = false;
+		MeshComp->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Animation: Full rate"));
+	}
+	else
+	{
+		MeshComp->bEnableUpdateRateOptimizations = true;
+		MeshComp->VisibilityBasedAnimTickOption = ReducedVisibilityTickOption;
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Animation: Reduced rate"));
+	}
+}
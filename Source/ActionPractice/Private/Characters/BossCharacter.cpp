@@ -13,19 +13,13 @@
 #include "Characters/Enemy/EnemyDataAsset.h"
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossCharacter, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBossCharacter, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 ABossCharacter::ABossCharacter()
 {
+	//회전 중에만 BaseCharacter에서 Tick 활성화
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
 
@@ -47,6 +41,9 @@ ABossCharacter::ABossCharacter()
 	GetCharacterMovement()->BrakingDecelerationWalking = 2000.f;
 	GetCharacterMovement()->BrakingDecelerationFalling = 1500.0f;
 
+	//평상시 애니메이션 갱신 빈도 감소, 판정 구간에서만 풀 레이트
+	bUseAnimationUpdateRateOptimization = true;
+
 	CreateAbilitySystemComponent();
 	CreateAttributeSet();
 
@@ -73,24 +70,24 @@ void ABossCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	DEBUG_LOG(TEXT("BossCharacter::BeginPlay: This=%p, ASC=%p, AttributeSet=%p"),
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("BossCharacter::BeginPlay: This=%p, ASC=%p, AttributeSet=%p"),
 		this,
 		AbilitySystemComponent.Get(),
 		AttributeSet.Get());
 
 	if (EnemyData)
 	{
-		DEBUG_LOG(TEXT("BossCharacter::BeginPlay: EnemyData=%s"), *GetNameSafe(EnemyData));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossCharacter::BeginPlay: EnemyData=%s"), *GetNameSafe(EnemyData));
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("BossCharacter::BeginPlay: EnemyData is nullptr"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossCharacter::BeginPlay: EnemyData is nullptr"));
 	}
 
-	DEBUG_LOG(TEXT("BossCharacter::BeginPlay: StartAbilities count=%d"), StartAbilities.Num());
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("BossCharacter::BeginPlay: StartAbilities count=%d"), StartAbilities.Num());
 	for (const TSubclassOf<UGameplayAbility>& AbilityClass : StartAbilities)
 	{
-		DEBUG_LOG(TEXT("  StartAbility: %s"), *GetNameSafe(AbilityClass));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("  StartAbility: %s"), *GetNameSafe(AbilityClass));
 	}
 
 	//EnemyData의 모든 몽타주 프리로드
@@ -107,7 +104,7 @@ void ABossCharacter::BeginPlay()
 		if (PerceptionComponent)
 		{
 			PerceptionComponent->OnTargetPerceptionUpdated.AddDynamic(this, &ABossCharacter::OnPlayerDetected);
-			DEBUG_LOG(TEXT("Perception delegate bound to BossCharacter"));
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Perception delegate bound to BossCharacter"));
 		}
 	}
 }
@@ -131,7 +128,7 @@ void ABossCharacter::OnPlayerDetected(AActor* Actor, FAIStimulus Stimulus)
 
 		if (Stimulus.WasSuccessfullySensed())
 		{
-			DEBUG_LOG(TEXT("Player detected by Boss: %s"), *Actor->GetName());
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Player detected by Boss: %s"), *Actor->GetName());
 
 			if (!bHealthWidgetActive)
 			{
@@ -142,7 +139,7 @@ void ABossCharacter::OnPlayerDetected(AActor* Actor, FAIStimulus Stimulus)
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("Player lost by Boss: %s"), *Actor->GetName());
+			AP_DEBUG_LOG(LogAPCharacter, TEXT("Player lost by Boss: %s"), *Actor->GetName());
 
 			if (Actor == DetectedPlayer.Get())
 			{
@@ -156,20 +153,20 @@ void ABossCharacter::CreateAndAttachHealthWidget()
 {
 	if (bHealthWidgetActive)
 	{
-		DEBUG_LOG(TEXT("BossHealthWidget already active"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossHealthWidget already active"));
 		return;
 	}
 
 	if (!BossHealthWidgetClass)
 	{
-		DEBUG_LOG(TEXT("BossHealthWidgetClass is not set"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossHealthWidgetClass is not set"));
 		return;
 	}
 	
 	BossHealthWidget = CreateWidget<UBossHealthWidget>(GetWorld(), BossHealthWidgetClass);
 	if (!BossHealthWidget)
 	{
-		DEBUG_LOG(TEXT("Failed to create BossHealthWidget"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("Failed to create BossHealthWidget"));
 		return;
 	}
 
@@ -185,7 +182,7 @@ void ABossCharacter::CreateAndAttachHealthWidget()
 	BossHealthWidget->AddToViewport();
 
 	bHealthWidgetActive = true;
-	DEBUG_LOG(TEXT("BossHealthWidget created and attached"));
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("BossHealthWidget created and attached"));
 }
 
 void ABossCharacter::RemoveHealthWidget()
@@ -199,7 +196,7 @@ void ABossCharacter::RemoveHealthWidget()
 	{
 		BossHealthWidget->RemoveFromParent();
 		BossHealthWidget = nullptr;
-		DEBUG_LOG(TEXT("BossHealthWidget removed"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossHealthWidget removed"));
 	}
 
 	StopBossBGM();
@@ -208,16 +205,11 @@ void ABossCharacter::RemoveHealthWidget()
 	bHealthWidgetActive = false;
 }
 
-void ABossCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-}
-
 void ABossCharacter::RotateToTarget(const AActor* TargetActor, float RotateTime)
 {
 	if (!TargetActor)
 	{
-		DEBUG_LOG(TEXT("RotateToTarget: TargetActor is null"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("RotateToTarget: TargetActor is null"));
 		return;
 	}
 
@@ -229,21 +221,21 @@ void ABossCharacter::PlayBossBGM()
 {
 	if (!BossBGM)
 	{
-		DEBUG_LOG(TEXT("BossBGM is not set"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossBGM is not set"));
 		return;
 	}
 
 	//이미 재생 중이면 리턴
 	if (BGMAudioComponent && BGMAudioComponent->IsPlaying())
 	{
-		DEBUG_LOG(TEXT("BossBGM is already playing"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossBGM is already playing"));
 		return;
 	}
 
 	BGMAudioComponent = UGameplayStatics::SpawnSound2D(this, BossBGM);
 	if (BGMAudioComponent)
 	{
-		DEBUG_LOG(TEXT("BossBGM started playing"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossBGM started playing"));
 	}
 }
 
@@ -252,6 +244,6 @@ void ABossCharacter::StopBossBGM()
 	if (BGMAudioComponent && BGMAudioComponent->IsPlaying())
 	{
 		BGMAudioComponent->Stop();
-		DEBUG_LOG(TEXT("BossBGM stopped"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BossBGM stopped"));
 	}
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "Characters/CameraProbeSpringArmComponent.h"
+#include "Games/CameraQuerySubsystem.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "Games/CombatStats.h"
+
+void UCameraProbeSpringArmComponent::UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime)
+{
+	if (!bUseAsyncProbe)
+	{
+		Super::UpdateDesiredArmLocation(bDoTrace, bDoLocationLag, bDoRotationLag, DeltaTime);
+		return;
+	}
+
+	//동기 스윕 없이 막히지 않은 소켓 위치 계산
+	Super::UpdateDesiredArmLocation(false, bDoLocationLag, bDoRotationLag, DeltaTime);
+
+	if (!bDoTrace || TargetArmLength == 0.0f)
+	{
+		ArmFraction = 1.0f;
+		LastDesiredLocation.Reset();
+		ProbedDesiredLocation.Reset();
+		return;
+	}
+
+	const FTransform& ComponentTransform = GetComponentTransform();
+	const FVector ArmOrigin = PreviousArmOrigin;
+	const FVector DesiredLocation = ComponentTransform.TransformPosition(RelativeSocketLocation);
+
+	FCameraProbeDesc Probe;
+	Probe.Start = ArmOrigin;
+	Probe.End = DesiredLocation;
+	Probe.Radius = ProbeSize;
+	Probe.Channel = ProbeChannel;
+	Probe.IgnoredActor = GetOwner();
+
+	//임계 거리는 암 길이와 프레임 시간에 비례, 프레임레이트와 암 길이가 달라도 같은 속도 기준
+	const float SyncThresholdSq = FMath::Square(SyncProbeMoveSpeed * TargetArmLength * DeltaTime);
+	const bool bMovedFast = SyncProbeMoveSpeed <= 0.0f || !LastDesiredLocation.IsSet()
+		|| FVector::DistSquared(DesiredLocation, LastDesiredLocation.GetValue()) > SyncThresholdSq;
+	LastDesiredLocation = DesiredLocation;
+
+	bool bHit = false;
+	float HitFraction = 1.0f;
+	bool bHasAsyncResult = false;
+	if (!bMovedFast)
+	{
+		//직전 결과는 제출했던 구간 기준, 그 구간에서 멀어졌으면 쓰지 않음 (빠른 이동 직후 첫 프레임)
+		bHasAsyncResult = UCameraQuerySubsystem::GetProbeResult(GetWorld(), ProbeId, bHit, HitFraction)
+			&& ProbedDesiredLocation.IsSet()
+			&& FVector::DistSquared(DesiredLocation, ProbedDesiredLocation.GetValue()) <= SyncThresholdSq;
+
+		UCameraQuerySubsystem::UpdateProbe(GetWorld(), ProbeId, Probe);
+		ProbedDesiredLocation = DesiredLocation;
+	}
+
+	//빠르게 움직인 프레임은 직전 결과가 새 구간을 대표하지 못하므로 동기 스윕 (엔진 기본 구현과 같은 쿼리), 이번 결과를 비동기로 다시 구하지 않음
+	if (!bHasAsyncResult)
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpringArm), false, GetOwner());
+		FHitResult Result;
+		bHit = GetWorld()->SweepSingleByChannel(Result, ArmOrigin, DesiredLocation, FQuat::Identity, ProbeChannel, FCollisionShape::MakeSphere(ProbeSize), QueryParams);
+		HitFraction = Result.Time;
+		INC_DWORD_STAT(STAT_CombatCameraProbesSync);
+		++FCombatQueryCounters::CameraProbesSync;
+	}
+
+	const float TargetFraction = bHit ? HitFraction : 1.0f;
+
+	ArmFraction = TargetFraction < ArmFraction ? TargetFraction : FMath::FInterpTo(ArmFraction, TargetFraction, DeltaTime, ProbeRecoverySpeed);
+
+	bIsCameraFixed = ArmFraction < 1.0f - KINDA_SMALL_NUMBER;
+	UnfixedCameraPosition = DesiredLocation;
+	if (!bIsCameraFixed) return;
+
+	const FVector ResultLocation = FMath::Lerp(ArmOrigin, DesiredLocation, ArmFraction);
+	RelativeSocketLocation = ComponentTransform.InverseTransformPosition(ResultLocation);
+	UpdateChildTransforms();
+}
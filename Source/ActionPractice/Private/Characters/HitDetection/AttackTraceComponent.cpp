@@ -3,18 +3,54 @@
 #include "Characters/HitDetection/AttackTraceComponent.h"
 #include "Items/AttackData.h"
 #include "Components/MeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 #include "DrawDebugHelpers.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Characters/BaseCharacter.h"
+#include "Characters/HitDetection/LagCompensationSubsystem.h"
+#include "Characters/HitDetection/HitTraceBudgetSubsystem.h"
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "Characters/HitDetection/HurtboxSetDataAsset.h"
+#include "Notifies/AnimNotifyState_HitDetection.h"
+#include "Notifies/NotifyEventSubsystem.h"
+#include "Games/CombatStats.h"
+#include "Games/TickAuditSubsystem.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "VisualLogger/VisualLogger.h"
+#include "Games/ActionPracticeLog.h"
+
+int64 UAttackTraceComponent::TotalSweepTraceCounter = 0;
+int64 UAttackTraceComponent::TotalTraceScratchGrowthCounter = 0;
+
+#if !UE_BUILD_SHIPPING
+namespace AttackTrace
+{
+	static bool bAllocationAudit = false;
+	static FAutoConsoleVariableRef CVarAllocationAudit(
+		TEXT("ap.HitDetection.AllocAudit"),
+		bAllocationAudit,
+		TEXT("Log a warning whenever a trace grows its member scratch containers (hit buffers, socket positions, hit validation map)."));
+}
+#endif
 
-#define ENABLE_DEBUG_LOG 1
+namespace MontageTimeTrace
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.HitDetection.MontageTime"),
+		bEnabled,
+		TEXT("Trace montage-driven hit windows on a fixed montage-time grid by sampling the montage directly, instead of sampling the rendered pose at tick time."));
+}
 
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogAttackTraceComponent, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogAttackTraceComponent, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
+#if COMBAT_TRACE_ENABLED
+TRACE_DECLARE_INT_COUNTER(CombatSweepsPerAttack, TEXT("Combat/SweepsPerAttack"));
 #endif
 
 UAttackTraceComponent::UAttackTraceComponent()
@@ -29,13 +65,50 @@ void UAttackTraceComponent::BeginPlay()
 
 	CachedASC = GetOwnerASC();
 	SetOwnerMesh();
+	HurtboxSubsystem = GetWorld()->GetSubsystem<UHurtboxSubsystem>();
+
+	//같은 프레임의 HitDetectionStart/End 이벤트를 받은 뒤 트레이스
+	UNotifyEventSubsystem::AddDispatchPrerequisite(this, PrimaryComponentTick);
 }
 
 void UAttackTraceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bIsTracing) return;
+	if (!bIsTracing)
+	{
+		UTickAuditSubsystem::ReportIdleTick(this);
+		return;
+	}
+
+	COMBAT_SCOPE(STAT_CombatTraceTick);
+
+	//몽타주 시간 격자로 트레이스, 프레임 간격/재생 속도와 무관하게 같은 시간에 샘플링
+	if (MontageWindow.bActive)
+	{
+		if (UpdateMontageWindow())
+		{
+			AdvanceMontageWindow(MontageWindow.CurrTickTime, false);
+		}
+		else
+		{
+			EndMontageWindow();
+		}
+
+		if (MontageWindow.bActive) return;
+
+		//샘플링을 이어갈 수 없으면 Tick 샘플링으로 전환, 렌더된 포즈에서 다시 시작
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Montage time window ended early, falling back to tick sampling"));
+		if (!UpdateSocketPositions()) return;
+
+		for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+		{
+			Pair.Value.PreviousSocketPositions = Pair.Value.CurrentSocketPositions;
+			Pair.Value.PrevTipSocketLocation = GetTipSocketLocation(Pair.Value);
+			Pair.Value.TraceAccumulator = 0.0f;
+		}
+		return;
+	}
 
 	//각 소켓 그룹별로 독립적으로 적응형 트레이스 처리
 	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
@@ -54,8 +127,19 @@ void UAttackTraceComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		//각 그룹의 TraceAccumulator가 임계값 넘으면 해당 그룹만 트레이스
 		if (SocketGroup.TraceAccumulator >= SocketGroup.CurrentSecondsPerTrace)
 		{
+			//프레임 예산 초과 시 누적 시간을 유지한 채 다음 프레임으로 미룸 (이전 소켓 위치부터 스윕하므로 빠지는 구간 없음)
+			if (!UHitTraceBudgetSubsystem::TryConsume(this, SocketGroup.TraceAccumulator))
+			{
+				continue;
+			}
+
+			const int32 SweepCountBefore = DebugSweepTraceCounter;
+			const double TraceStartTime = FPlatformTime::Seconds();
+
 			PerformTrace(SocketGroup.TraceAccumulator);
 			SocketGroup.TraceAccumulator = 0.0f;
+
+			UHitTraceBudgetSubsystem::ReportTraceTime(this, DebugSweepTraceCounter - SweepCountBefore, FPlatformTime::Seconds() - TraceStartTime);
 		}
 	}
 }
@@ -65,17 +149,17 @@ void UAttackTraceComponent::BindEventCallbacks()
 {
 	if (!CachedASC)
 	{
-		DEBUG_LOG(TEXT("No ASC found"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("No ASC found"));
 		return;
 	}
 
 	if (HitDetectionStartHandle.IsValid() || HitDetectionEndHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("BindEventCallbacks: Clearing previous handles before binding new"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("BindEventCallbacks: Clearing previous handles before binding new"));
 		UnbindEventCallbacks();
 	}
 
-	DEBUG_LOG(TEXT("BindEventCallbacks: Subscribing events"));
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("BindEventCallbacks: Subscribing events"));
 
 	//HitDetectionStart 노티파이 스테이트
 	HitDetectionStartHandle = CachedASC->GenericGameplayEventCallbacks
@@ -127,38 +211,63 @@ void UAttackTraceComponent::UnbindEventCallbacks()
 
 void UAttackTraceComponent::HandleHitDetectionStart(const FGameplayEventData& Payload)
 {
-	DEBUG_LOG(TEXT("HitDetectionStart: Received. bIsPrepared=%s"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetectionStart: Received. bIsPrepared=%s"),
 		bIsPrepared ? TEXT("true") : TEXT("false"));
 
 	if (!bIsPrepared)
 	{
-		DEBUG_LOG(TEXT("HitDetectionStart: NOT PREPARED. Ignoring."));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetectionStart: NOT PREPARED. Ignoring."));
 		return;
 	}
 
-	float Duration = Payload.EventMagnitude;
-
 	StartTrace();
+
+	//몽타주 구간을 찾지 못하면 Tick 샘플링으로 트레이스
+	if (bIsTracing && !BeginMontageWindow())
+	{
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetectionStart: tick sampling (Duration=%.3f)"), Payload.EventMagnitude);
+	}
 }
 
 void UAttackTraceComponent::HandleHitDetectionEnd(const FGameplayEventData& Payload)
 {
-	DEBUG_LOG(TEXT("HitDetectionEnd: Received. bIsTracing=%s"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetectionEnd: Received. bIsTracing=%s"),
 		bIsTracing ? TEXT("true") : TEXT("false"));
 
+	//남은 구간 마무리, 중단된 몽타주는 마지막으로 재생된 위치까지만
+	if (MontageWindow.bActive)
+	{
+		UpdateMontageWindow();
+		AdvanceMontageWindow(MontageWindow.CurrTickTime, true);
+	}
+
+	ResolvePendingStrikes();
 	StopTrace();
-	//프레임 드랍으로 HitDetectionEnd가 HitDetectionStart보다 먼저 도착할 수 있기 때문에
-	//bIsPrepared를 다음 PrepareHitDetection에서 초기화되도록 여기서 false로 설정하지 않음
+	//노티파이 이벤트 순서는 UNotifyEventSubsystem에서 보장 (이전 구간 End -> 새 구간 Start)
+	//콤보 전환 시 다음 구간이 같은 준비 상태를 쓰므로 bIsPrepared는 다음 PrepareHitDetection에서 초기화
+}
+
+void UAttackTraceComponent::CancelHitDetection()
+{
+	if (bIsTracing)
+	{
+		StopTrace();
+	}
+
+	UnbindEventCallbacks();
+	bIsPrepared = false;
 }
 #pragma endregion
 
 #pragma region "Trace Config Functions"
 void UAttackTraceComponent::PrepareHitDetection(const FGameplayTagContainer& AttackTags, const int32 ComboIndex)
 {
+	PeakSwingSpeed = 0.0f;
+
 	//자식 클래스에서 설정 로드
 	if (!LoadTraceConfig(AttackTags, ComboIndex))
 	{
-		DEBUG_LOG(TEXT("Failed to load trace config for attack tags"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Failed to load trace config for attack tags"));
 		return;
 	}
 
@@ -167,18 +276,20 @@ void UAttackTraceComponent::PrepareHitDetection(const FGameplayTagContainer& Att
 
 	bIsPrepared = true;
 
-	DEBUG_LOG(TEXT("PrepareHitDetection - Attack Tags Count: %d, Combo: %d"), AttackTags.Num(), ComboIndex);
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("PrepareHitDetection - Attack Tags Count: %d, Combo: %d"), AttackTags.Num(), ComboIndex);
 }
 
 void UAttackTraceComponent::PrepareHitDetection(const FName& AttackName, const int32 ComboIndex)
 {
-	DEBUG_LOG(TEXT("PrepareHitDetection: AttackName=%s, ComboIndex=%d"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("PrepareHitDetection: AttackName=%s, ComboIndex=%d"),
 		*AttackName.ToString(), ComboIndex);
 
+	PeakSwingSpeed = 0.0f;
+
 	//자식 클래스에서 설정 로드
 	if (!LoadTraceConfig(AttackName, ComboIndex))
 	{
-		DEBUG_LOG(TEXT("PrepareHitDetection: LoadTraceConfig FAILED"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PrepareHitDetection: LoadTraceConfig FAILED"));
 		bIsPrepared = false;
 		return;
 	}
@@ -187,7 +298,7 @@ void UAttackTraceComponent::PrepareHitDetection(const FName& AttackName, const i
 	BindEventCallbacks();
 
 	bIsPrepared = true;
-	DEBUG_LOG(TEXT("PrepareHitDetection: SUCCESS (bIsPrepared=true)"));
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("PrepareHitDetection: SUCCESS (bIsPrepared=true)"));
 }
 
 void UAttackTraceComponent::BuildSocketConfigs(const TArray<FHitSocketInfo>& SocketInfoArray)
@@ -215,7 +326,7 @@ void UAttackTraceComponent::BuildSocketConfigs(const TArray<FHitSocketInfo>& Soc
 		SocketConfig.CurrentSocketPositions.SetNum(SocketInfo.HitSocketCount);
 
 		PrebuiltSocketGroups.Add(SocketInfo.HitSocketName, SocketConfig);
-		DEBUG_LOG(TEXT("Prebuilt socket config: %s (Count: %d)"), *SocketInfo.HitSocketName.ToString(), SocketInfo.HitSocketCount);
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Prebuilt socket config: %s (Count: %d)"), *SocketInfo.HitSocketName.ToString(), SocketInfo.HitSocketCount);
 	}
 }
 #pragma endregion
@@ -225,14 +336,14 @@ void UAttackTraceComponent::StartTrace()
 {
 	if (bIsTracing)
 	{
-		DEBUG_LOG(TEXT("Already tracing, stopping previous trace"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Already tracing, stopping previous trace"));
 		StopTrace();
 	}
 
 	//초기 소켓 위치
 	if (!UpdateSocketPositions())
 	{
-		DEBUG_LOG(TEXT("Failed to update socket positions - no valid sockets found"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Failed to update socket positions - no valid sockets found"));
 		return;
 	}
 
@@ -242,67 +353,107 @@ void UAttackTraceComponent::StartTrace()
 		Pair.Value.PreviousSocketPositions = Pair.Value.CurrentSocketPositions;
 		Pair.Value.PrevTipSocketLocation = GetTipSocketLocation(Pair.Value);
 		Pair.Value.TraceAccumulator = 0.0f;
+		Pair.Value.StrikePeakSpeed = 0.0f;
+		Pair.Value.bStrikeResolved = false;
 	}
 
 	bIsTracing = true;
 	SetComponentTickEnabled(true);
+	SetFullRateAnimation(true);
+	UHitTraceBudgetSubsystem::RegisterTracer(this, FindAnimatedCharacter());
 
 	DebugSweepTraceCounter = 0;
-	DEBUG_LOG(TEXT("Started trace"));
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Started trace"));
 }
 
 void UAttackTraceComponent::StopTrace()
 {
 	bIsTracing = false;
+	EndMontageWindow();
 	SetComponentTickEnabled(false);
+	SetFullRateAnimation(false);
+	UHitTraceBudgetSubsystem::UnregisterTracer(this);
 	//UnbindEventCallbacks(); // 콤보 전환 시 다음 콤보용 바인딩이 지워지는 것을 방지하기 위해 제거
 	//이벤트 바인딩은 PrepareHitDetection()에서 관리, 언바인딩은 EndPlay()에서만 수행
 
-	DEBUG_LOG(TEXT("Stopped trace, counter: %d"), DebugSweepTraceCounter);
+#if COMBAT_TRACE_ENABLED
+	TRACE_COUNTER_SET(CombatSweepsPerAttack, DebugSweepTraceCounter);
+#endif
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Stopped trace, counter: %d"), DebugSweepTraceCounter);
 }
 
 void UAttackTraceComponent::PerformTrace(float DeltaTime)
 {
 	if (UsingHitSocketGroups.Num() == 0)
 	{
-		DEBUG_LOG(TEXT("PerformTrace - FAILED: No socket groups"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PerformTrace - FAILED: No socket groups"));
 		return;
 	}
 
 	if (!UpdateSocketPositions())
 	{
-		DEBUG_LOG(TEXT("PerformTrace - FAILED: cannot update socket positions during trace"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PerformTrace - FAILED: cannot update socket positions during trace"));
 		StopTrace();
 		return;
 	}
 
+	//트레이스 경로 전체 할당을 LLM/Memory Insights에서 따로 집계
+	LLM_SCOPE_BYNAME(TEXT("Combat/HitTrace"));
+
+	const SIZE_T ScratchSizeBefore = GetTraceScratchAllocatedSize();
+
+	//원격 플레이어 공격이면 서버에서 피격자를 공격자 시점으로 되감은 뒤 트레이스 (스코프 종료 시 복원)
+	FScopedLagCompensation LagCompensation(FindAnimatedCharacter(), LagCompensationRadius);
+
+	//쿼리 파라미터는 트레이스당 한 번만 생성 (무시 목록은 인라인 할당)
+	const FCollisionQueryParams Params = GetCollisionQueryParams();
+
 	//모든 소켓 그룹에 대해 트레이스 수행
 	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
 	{
-		switch (Pair.Value.AttackMotionType)
-		{
-		case EAttackDamageType::Slash:
-			PerformSlashTrace(Pair.Value);
-			break;
+		UE_VLOG(GetVisualLogOwner(), LogAPHitDetection, Log, TEXT("Trace %s: tier %d (%.0f cm/s), %d interpolation, %.3f s"),
+			*Pair.Key.ToString(), Pair.Value.CurrentAdaptiveTier, Pair.Value.CurrentSwingSpeed,
+			Pair.Value.CurrentInterpolationPerTrace, DeltaTime);
 
-		case EAttackDamageType::Pierce:
-			PerformPierceTrace(Pair.Value);
-			break;
+		PerformGroupTrace(Pair.Value, Params);
+	}
 
-		case EAttackDamageType::Strike:
-			PerformStrikeTrace(Pair.Value);
-			break;
+	//각 그룹의 이전 소켓위치를 현재 소켓위치로 변경, Current는 다음 UpdateSocketPositions에서 덮어쓰므로 복사 대신 Swap
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		Swap(Pair.Value.PreviousSocketPositions, Pair.Value.CurrentSocketPositions);
+	}
 
-		default:
-			DEBUG_LOG(TEXT("Unknown damage type: %d"), (int32)Pair.Value.AttackMotionType);
-			break;
-		}
+	if (GetTraceScratchAllocatedSize() > ScratchSizeBefore)
+	{
+		++TotalTraceScratchGrowthCounter;
+		INC_DWORD_STAT(STAT_CombatTraceScratchGrowth);
+#if !UE_BUILD_SHIPPING
+		UE_CLOG(AttackTrace::bAllocationAudit, LogAPHitDetection, Warning, TEXT("%s: trace scratch grew %llu -> %llu bytes (sweeps this attack: %d)"),
+			*GetNameSafe(GetOwner()), (uint64)ScratchSizeBefore, (uint64)GetTraceScratchAllocatedSize(), DebugSweepTraceCounter);
+#endif
 	}
+}
 
-	//각 그룹의 이전 소켓위치를 현재 소켓위치로 변경
-	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+void UAttackTraceComponent::PerformGroupTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params)
+{
+	switch (SocketGroup.AttackMotionType)
 	{
-		Pair.Value.PreviousSocketPositions = Pair.Value.CurrentSocketPositions;
+	case EAttackDamageType::Slash:
+		PerformSlashTrace(SocketGroup, Params);
+		break;
+
+	case EAttackDamageType::Pierce:
+		PerformPierceTrace(SocketGroup, Params);
+		break;
+
+	case EAttackDamageType::Strike:
+		PerformStrikeTrace(SocketGroup, Params);
+		break;
+
+	default:
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("Unknown damage type: %d"), (int32)SocketGroup.AttackMotionType);
+		break;
 	}
 }
 
@@ -313,64 +464,238 @@ bool UAttackTraceComponent::UpdateSocketPositions()
 		return false;
 	}
 
-	//모든 소켓 그룹의 위치 업데이트
+	//모든 소켓 그룹의 위치 업데이트, 기존 버퍼에 제자리 기록
 	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
 	{
-		Pair.Value.CurrentSocketPositions.Empty();
-		for (const FName& SocketName : Pair.Value.TraceSocketNames)
+		FHitSocketGroupConfig& SocketGroup = Pair.Value;
+		SocketGroup.CurrentSocketPositions.SetNumUninitialized(SocketGroup.TraceSocketNames.Num(), EAllowShrinking::No);
+
+		for (int32 i = 0; i < SocketGroup.TraceSocketNames.Num(); ++i)
 		{
-			if (OwnerMesh->DoesSocketExist(SocketName))
+			const FName& SocketName = SocketGroup.TraceSocketNames[i];
+			if (!OwnerMesh->DoesSocketExist(SocketName))
 			{
-				FVector SocketLocation = OwnerMesh->GetSocketLocation(SocketName);
-				Pair.Value.CurrentSocketPositions.Add(SocketLocation);
-			}
-			else
-			{
-				DEBUG_LOG(TEXT("Socket %s not found on mesh"), *SocketName.ToString());
-				Pair.Value.CurrentSocketPositions.Empty();
+				AP_DEBUG_LOG(LogAPHitDetection, TEXT("Socket %s not found on mesh"), *SocketName.ToString());
+				SocketGroup.CurrentSocketPositions.Reset();
 				return false;
 			}
+
+			SocketGroup.CurrentSocketPositions[i] = OwnerMesh->GetSocketLocation(SocketName);
 		}
 	}
 	return true;
 }
 
-void UAttackTraceComponent::PerformPierceTrace(FHitSocketGroupConfig& SocketGroup)
+void UAttackTraceComponent::PerformPierceTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params)
 {
+	if (SocketGroup.CurrentSocketPositions.Num() < 1)
+	{
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PerformPierceTrace - FAILED: No socket positions"));
+		return;
+	}
 
+	//찌르기는 끝점이 먼저 대상에 닿으므로 끝점(0번 소켓) 경로만 스윕, 경로가 직선에 가까워 보간 불필요
+	const FVector& TipPrev = SocketGroup.PreviousSocketPositions[0];
+	const FVector& TipCurr = SocketGroup.CurrentSocketPositions[0];
+	const float Radius = SocketGroup.TraceRadius;
+
+	SweepWeaponCapsule(TipPrev, TipCurr, Radius, FCollisionShape::MakeSphere(Radius), Params, SweepHitScratch);
+
+	const FVector ThrustDirection = (TipCurr - TipPrev).GetSafeNormal();
+	const float HalfHeight = (TipCurr - TipPrev).Size() * 0.5f + Radius;
+	UE_VLOG_CAPSULE(GetVisualLogOwner(), LogAPHitDetection, Log,
+		TipPrev - ThrustDirection * Radius,
+		HalfHeight,
+		Radius,
+		FQuat::FindBetweenNormals(FVector::UpVector, ThrustDirection),
+		SweepHitScratch.Num() > 0 ? FColor::Yellow : DebugTraceColor,
+		TEXT("Pierce"));
+
+	++DebugSweepTraceCounter;
+	++TotalSweepTraceCounter;
+	if (bDrawDebugTrace)
+	{
+		DrawDebugCapsule(GetWorld(),
+		                 (TipPrev + TipCurr) * 0.5f,
+		                 HalfHeight,
+		                 Radius,
+		                 FQuat::FindBetweenNormals(FVector::UpVector, ThrustDirection),
+		                 DebugTraceColor,
+		                 false,
+		                 DebugTraceDuration);
+	}
+
+	for (const FHitResult& Hit : SweepHitScratch)
+	{
+		if (ValidateHit(Hit.GetActor(), Hit, false))
+		{
+			ProcessHit(Hit.GetActor(), Hit);
+		}
+	}
 }
 
-void UAttackTraceComponent::PerformStrikeTrace(FHitSocketGroupConfig& SocketGroup)
+void UAttackTraceComponent::PerformStrikeTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params)
 {
+	if (SocketGroup.bStrikeResolved) return;
 
+	if (SocketGroup.CurrentSocketPositions.Num() < 1)
+	{
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PerformStrikeTrace - FAILED: No socket positions"));
+		return;
+	}
+
+	//타격부가 가속하는 동안은 최고 속도만 기록, 최고 속도 대비 충분히 감속한 트레이스를 임팩트 프레임으로 판정
+	const float SwingSpeed = SocketGroup.CurrentSwingSpeed;
+	if (SwingSpeed >= SocketGroup.StrikePeakSpeed)
+	{
+		SocketGroup.StrikePeakSpeed = SwingSpeed;
+		return;
+	}
+
+	if (SwingSpeed > SocketGroup.StrikePeakSpeed * StrikeImpactSpeedRatio) return;
+
+	PerformStrikeOverlap(SocketGroup, Params);
+}
+
+void UAttackTraceComponent::PerformStrikeOverlap(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params)
+{
+	SocketGroup.bStrikeResolved = true;
+
+	const FVector& Center = SocketGroup.CurrentSocketPositions[0];
+	const float Radius = SocketGroup.TraceRadius;
+
+	const bool bUseHurtboxes = HurtboxSubsystem && UHurtboxSubsystem::IsEnabled();
+
+	TraceHitScratch.Reset();
+	OverlapScratch.Reset();
+	{
+		COMBAT_SCOPE(STAT_CombatSweep);
+		INC_DWORD_STAT(STAT_CombatSweeps);
+		if (!bUseHurtboxes || UHurtboxSubsystem::ShouldSweepPhysics())
+		{
+			GetWorld()->OverlapMultiByChannel(
+				OverlapScratch,
+				Center,
+				FQuat::Identity,
+				GetTraceChannel(),
+				FCollisionShape::MakeSphere(Radius),
+				Params
+			);
+		}
+
+		//구체 오버랩 = 길이 0 캡슐
+		if (bUseHurtboxes)
+		{
+			HurtboxSubsystem->QueryCapsule(Center, Center, Radius, GetTraceChannel(), Params, TraceHitScratch);
+		}
+	}
+
+	UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, Center, Radius,
+		OverlapScratch.Num() + TraceHitScratch.Num() > 0 ? FColor::Yellow : DebugTraceColor,
+		TEXT("Strike (peak %.0f cm/s)"), SocketGroup.StrikePeakSpeed);
+
+	++DebugSweepTraceCounter;
+	++TotalSweepTraceCounter;
+	if (bDrawDebugTrace)
+	{
+		DrawDebugSphere(GetWorld(), Center, Radius, 12, DebugTraceColor, false, DebugTraceDuration);
+	}
+
+	for (const FOverlapResult& Overlap : OverlapScratch)
+	{
+		AActor* HitActor = Overlap.GetActor();
+		UPrimitiveComponent* HitComponent = Overlap.GetComponent();
+
+		//피격 캡슐이 있는 캐릭터는 캡슐 판정 결과 사용
+		if (bUseHurtboxes && HurtboxSubsystem->IsHurtboxActor(HitActor)) continue;
+
+		//오버랩은 접촉점이 없으므로 충돌체 표면의 최근접점을 임팩트 위치로 사용
+		FVector ImpactPoint = Center;
+		if (HitComponent && HitComponent->GetClosestPointOnCollision(Center, ImpactPoint) < 0.0f)
+		{
+			ImpactPoint = Center;
+		}
+
+		FHitResult Hit(HitActor, HitComponent, ImpactPoint, (Center - ImpactPoint).GetSafeNormal());
+		Hit.TraceStart = Center;
+		Hit.TraceEnd = Center;
+		Hit.bBlockingHit = Overlap.bBlockingHit;
+
+		if (ValidateHit(HitActor, Hit, false))
+		{
+			ProcessHit(HitActor, Hit);
+		}
+	}
+
+	for (const FHitResult& Hit : TraceHitScratch)
+	{
+		if (ValidateHit(Hit.GetActor(), Hit, false))
+		{
+			ProcessHit(Hit.GetActor(), Hit);
+		}
+	}
+}
+
+void UAttackTraceComponent::ResolvePendingStrikes()
+{
+	if (!bIsTracing) return;
+
+	bool bHasPendingStrike = false;
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		bHasPendingStrike |= Pair.Value.AttackMotionType == EAttackDamageType::Strike && !Pair.Value.bStrikeResolved;
+	}
+	if (!bHasPendingStrike) return;
+
+	//몽타주 샘플링은 구간 끝 샘플이 Swap 후 Previous에 남아 있음
+	if (MontageWindow.bActive)
+	{
+		for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+		{
+			Pair.Value.CurrentSocketPositions = Pair.Value.PreviousSocketPositions;
+		}
+	}
+	else if (!UpdateSocketPositions())
+	{
+		return;
+	}
+
+	FScopedLagCompensation LagCompensation(FindAnimatedCharacter(), LagCompensationRadius);
+	const FCollisionQueryParams Params = GetCollisionQueryParams();
+
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		if (Pair.Value.AttackMotionType == EAttackDamageType::Strike && !Pair.Value.bStrikeResolved)
+		{
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("ResolvePendingStrikes: %s reached window end without impact"), *Pair.Key.ToString());
+			PerformStrikeOverlap(Pair.Value, Params);
+		}
+	}
 }
 
-void UAttackTraceComponent::PerformSlashTrace(FHitSocketGroupConfig& SocketGroup)
+void UAttackTraceComponent::PerformSlashTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params)
 {
 	if (SocketGroup.CurrentSocketPositions.Num() < 2)
 	{
-		DEBUG_LOG(TEXT("PerformSlashTrace - FAILED: Not enough socket positions (need >= 2)"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("PerformSlashTrace - FAILED: Not enough socket positions (need >= 2)"));
 		return;
 	}
 
-	TArray<FHitResult> AllHits;
+	TraceHitScratch.Reset();
 
 	//소켓 이름 순서대로 트레이스 시작과 끝 설정 (0 ~ 1, 1 ~ 2, ...)
 	for (int32 i = 0; i < SocketGroup.CurrentSocketPositions.Num() - 1; i++)
 	{
-		FVector StartPrev = SocketGroup.PreviousSocketPositions[i];
-		FVector StartCurr = SocketGroup.CurrentSocketPositions[i];
-
-		FVector EndPrev = SocketGroup.PreviousSocketPositions[i + 1];
-		FVector EndCurr = SocketGroup.CurrentSocketPositions[i + 1];
+		const FVector& StartPrev = SocketGroup.PreviousSocketPositions[i];
+		const FVector& StartCurr = SocketGroup.CurrentSocketPositions[i];
 
-		TArray<FHitResult> SubHits;
+		const FVector& EndPrev = SocketGroup.PreviousSocketPositions[i + 1];
+		const FVector& EndCurr = SocketGroup.CurrentSocketPositions[i + 1];
 
-		PerformInterpolationTrace(StartPrev, StartCurr, EndPrev, EndCurr, SocketGroup.TraceRadius, SocketGroup.CurrentInterpolationPerTrace, SubHits);
-		AllHits.Append(SubHits);
+		PerformInterpolationTrace(StartPrev, StartCurr, EndPrev, EndCurr, SocketGroup.TraceRadius, SocketGroup.CurrentInterpolationPerTrace, Params, TraceHitScratch);
 	}
 
-	for (const FHitResult& Hit : AllHits)
+	for (const FHitResult& Hit : TraceHitScratch)
 	{
 		//일단 다단히트가 아닌 일반 공격으로 호출
 		if (ValidateHit(Hit.GetActor(), Hit, false))
@@ -384,24 +709,56 @@ void UAttackTraceComponent::PerformSlashTrace(FHitSocketGroupConfig& SocketGroup
 #pragma region "Hit Functions"
 bool UAttackTraceComponent::ValidateHit(AActor* HitActor, const FHitResult& HitResult, bool bIsMultiHit)
 {
+	COMBAT_SCOPE(STAT_CombatHitValidation);
+
 	if (!HitActor)
+	{
+		INC_DWORD_STAT(STAT_CombatHitsRejected);
+		COMBAT_TRACE_EVENT(TEXT("HitRejected: NoActor"));
+		UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 6.0f, FColor::Red, TEXT("Rejected: NoActor"));
 		return false;
+	}
 
 	//자기 자신과 소유자 제외
 	AActor* Owner = GetOwnerActor();
-	if (HitActor == Owner) return false;
+	if (HitActor == Owner)
+	{
+		INC_DWORD_STAT(STAT_CombatHitsRejected);
+		COMBAT_TRACE_EVENT(TEXT("HitRejected %s: Self"), *HitActor->GetName());
+		UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 6.0f, FColor::Red, TEXT("Rejected %s: Self"), *HitActor->GetName());
+		return false;
+	}
 
 	//필요 시 아군 제외 구현해야 함
 
+	//무적 구간이면 대미지 스펙을 만들기 전에 거부, 다음 판정에서 다시 맞을 수 있도록 히트 기록도 남기지 않음
+	const ABaseCharacter* HitCharacter = Cast<ABaseCharacter>(HitActor);
+	if (HitCharacter && HitCharacter->IsHurtboxWindowActive(EHurtboxWindow::Invulnerable))
+	{
+		INC_DWORD_STAT(STAT_CombatHitsRejected);
+		COMBAT_TRACE_EVENT(TEXT("HitRejected %s: Invulnerable"), *HitActor->GetName());
+		UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 6.0f, FColor::Cyan, TEXT("Rejected %s: Invulnerable"), *HitActor->GetName());
+		return false;
+	}
+
 	//중복 체크
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 	if (FHitValidationData* ValidationData = HitValidationMap.Find(HitActor))
 	{
 		//다단히트가 아닐 경우, 이미 있으면 리턴
-		if (!bIsMultiHit) return false;
+		if (!bIsMultiHit)
+		{
+			INC_DWORD_STAT(STAT_CombatHitsRejected);
+			COMBAT_TRACE_EVENT(TEXT("HitRejected %s: AlreadyHit"), *HitActor->GetName());
+			UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 6.0f, FColor::Orange, TEXT("Rejected %s: AlreadyHit"), *HitActor->GetName());
+			return false;
+		}
 
 		if (CurrentTime - ValidationData->LastHitTime < HitCooldownTime)
 		{
+			INC_DWORD_STAT(STAT_CombatHitsRejected);
+			COMBAT_TRACE_EVENT(TEXT("HitRejected %s: Cooldown"), *HitActor->GetName());
+			UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 6.0f, FColor::Orange, TEXT("Rejected %s: Cooldown"), *HitActor->GetName());
 			return false;
 		}
 
@@ -417,14 +774,27 @@ bool UAttackTraceComponent::ValidateHit(AActor* HitActor, const FHitResult& HitR
 		HitValidationMap.Add(HitActor, NewData);
 	}
 
+	INC_DWORD_STAT(STAT_CombatHitsValidated);
+	UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log, HitResult.ImpactPoint, 10.0f, FColor::Green, TEXT("Hit %s (%s)"), *HitActor->GetName(), *HitResult.BoneName.ToString());
 	return true;
 }
 
 void UAttackTraceComponent::ProcessHit(AActor* HitActor, const FHitResult& HitResult)
 {
-	float IncomingDamage = CurrentAttackData.FinalDamage;
+	COMBAT_SCOPE(STAT_CombatProcessHit);
+
+	//부위 배율 적용, 피격 캡슐 액터의 물리 히트는 스윕 단계에서 제외되므로 캡슐 판정 히트로 취급
+	FFinalAttackData HitAttackData = CurrentAttackData;
+	const ABaseCharacter* HitCharacter = Cast<ABaseCharacter>(HitActor);
+	if (const UHurtboxSetDataAsset* HurtboxSet = HitCharacter ? HitCharacter->GetHurtboxSet() : nullptr)
+	{
+		const bool bHurtboxHit = HurtboxSubsystem && UHurtboxSubsystem::IsEnabled() && HurtboxSubsystem->IsHurtboxActor(HitActor);
+		HitAttackData.FinalDamage *= HurtboxSet->GetDamageMultiplier(HitResult, bHurtboxHit);
+	}
+
+	float IncomingDamage = HitAttackData.FinalDamage;
 
-	DEBUG_LOG(TEXT("Hit %s, IncomingDamage: %.2f"), *HitActor->GetName(), IncomingDamage);
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Hit %s, IncomingDamage: %.2f"), *HitActor->GetName(), IncomingDamage);
 
 	//화면에 디버그 메시지 표시
 	if (GEngine)
@@ -444,13 +814,14 @@ void UAttackTraceComponent::ProcessHit(AActor* HitActor, const FHitResult& HitRe
 		);*/
 	}
 
-	OnHit.Broadcast(HitActor, HitResult, CurrentAttackData);
+	OnHit.Broadcast(HitActor, HitResult, HitAttackData);
 }
 
 void UAttackTraceComponent::ResetHitActors()
 {
-	HitValidationMap.Empty();
-	DEBUG_LOG(TEXT("Reset hit actors"));
+	//공격마다 재사용하므로 용량 유지
+	HitValidationMap.Reset();
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Reset hit actors"));
 }
 
 void UAttackTraceComponent::AddIgnoredActors(FCollisionQueryParams& Params) const
@@ -497,16 +868,18 @@ float UAttackTraceComponent::CalculateSwingSpeed(const FHitSocketGroupConfig& So
 
 void UAttackTraceComponent::UpdateAdaptiveTraceSettings(FHitSocketGroupConfig& SocketGroup)
 {
-	float SwingSpeed = CalculateSwingSpeed(SocketGroup);
+	ApplyAdaptiveTier(SocketGroup, CalculateSwingSpeed(SocketGroup));
+}
 
+void UAttackTraceComponent::ApplyAdaptiveTier(FHitSocketGroupConfig& SocketGroup, float SwingSpeed, float WorldTimeScale)
+{
 	//속도에 따른 설정 선택
-	FAdaptiveTraceConfig SelectedConfig = AdaptiveConfigs[0];
-	int32 i = 0;
-	for (i; i < AdaptiveConfigs.Num(); ++i)
+	int32 SelectedTier = 0;
+	for (int32 i = 0; i < AdaptiveConfigs.Num(); ++i)
 	{
 		if (SwingSpeed >= AdaptiveConfigs[i].SpeedThreshold)
 		{
-			SelectedConfig = AdaptiveConfigs[i];
+			SelectedTier = i;
 		}
 		else
 		{
@@ -514,20 +887,108 @@ void UAttackTraceComponent::UpdateAdaptiveTraceSettings(FHitSocketGroupConfig& S
 		}
 	}
 
+	//프레임 예산에 따라 더 거친 단계로 제한 (누적 시간은 유지되어 다음 트레이스가 더 긴 구간을 스윕)
+	SocketGroup.DesiredAdaptiveTier = SelectedTier;
+	SelectedTier = FMath::Min(SelectedTier, BudgetTierCap);
+
+	const FAdaptiveTraceConfig& SelectedConfig = AdaptiveConfigs[SelectedTier];
 	SocketGroup.CurrentSecondsPerTrace = SelectedConfig.SecondsPerTrace;
 	SocketGroup.CurrentInterpolationPerTrace = SelectedConfig.InterpolationPerTrace;
+	SocketGroup.CurrentAdaptiveTier = SelectedTier;
+	SocketGroup.CurrentSwingSpeed = SwingSpeed;
+	PeakSwingSpeed = FMath::Max(PeakSwingSpeed, SwingSpeed * WorldTimeScale);
+}
+
+int32 UAttackTraceComponent::GetDesiredAdaptiveTier() const
+{
+	int32 DesiredTier = 0;
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		DesiredTier = FMath::Max(DesiredTier, Pair.Value.DesiredAdaptiveTier);
+	}
+	return DesiredTier;
+}
+
+float UAttackTraceComponent::EstimateSweepsPerFrame(int32 Tier, float DeltaTime) const
+{
+	if (!AdaptiveConfigs.IsValidIndex(Tier)) return 0.0f;
+
+	const FAdaptiveTraceConfig& Config = AdaptiveConfigs[Tier];
+
+	int32 NumSweeps = 0;
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		NumSweeps += CountSweepsPerTrace(Pair.Value, Config.InterpolationPerTrace);
+	}
+
+	//트레이스는 Tick당 최대 한 번이므로 프레임당 1회로 제한
+	const float TracesPerFrame = FMath::Min(1.0f, DeltaTime / FMath::Max(Config.SecondsPerTrace, KINDA_SMALL_NUMBER));
+	return NumSweeps * TracesPerFrame;
+}
+
+int32 UAttackTraceComponent::EstimateSweepsPerTrace() const
+{
+	int32 NumSweeps = 0;
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		NumSweeps += CountSweepsPerTrace(Pair.Value, Pair.Value.CurrentInterpolationPerTrace);
+	}
+	return NumSweeps;
+}
+
+int32 UAttackTraceComponent::CountSweepsPerTrace(const FHitSocketGroupConfig& SocketGroup, int32 InterpolationPerTrace) const
+{
+	const int32 NumSockets = SocketGroup.TraceSocketNames.Num();
+
+	switch (SocketGroup.AttackMotionType)
+	{
+	case EAttackDamageType::Slash:
+		return FMath::Max(0, NumSockets - 1) * (InterpolationPerTrace + 1);
+
+	case EAttackDamageType::Pierce:
+		return NumSockets > 0 ? 1 : 0;
+
+	case EAttackDamageType::Strike:
+		return NumSockets > 0 && !SocketGroup.bStrikeResolved ? 1 : 0;
+
+	default:
+		return 0;
+	}
+}
+
+void UAttackTraceComponent::SweepWeaponCapsule(const FVector& Start, const FVector& End, float Radius, const FCollisionShape& PhysicsShape, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits)
+{
+	COMBAT_SCOPE(STAT_CombatSweep);
+	INC_DWORD_STAT(STAT_CombatSweeps);
+
+	OutHits.Reset();
+	const bool bUseHurtboxes = HurtboxSubsystem && UHurtboxSubsystem::IsEnabled();
+
+	if (!bUseHurtboxes || UHurtboxSubsystem::ShouldSweepPhysics())
+	{
+		GetWorld()->SweepMultiByChannel(OutHits, Start, End, FQuat::Identity, GetTraceChannel(), PhysicsShape, Params);
+
+		//피격 캡슐이 있는 캐릭터의 물리 히트는 캡슐 판정 결과로 대체
+		if (bUseHurtboxes)
+		{
+			OutHits.RemoveAll([this](const FHitResult& Hit) { return HurtboxSubsystem->IsHurtboxActor(Hit.GetActor()); });
+		}
+	}
+
+	if (bUseHurtboxes)
+	{
+		HurtboxSubsystem->QueryCapsule(Start, End, Radius, GetTraceChannel(), Params, OutHits);
+	}
 }
 
 void UAttackTraceComponent::PerformInterpolationTrace(
 	const FVector& StartPrev, const FVector& StartCurr,
 	const FVector& EndPrev, const FVector& EndCurr,
-	float Radius, int32 InterpolationPerTrace, TArray<FHitResult>& OutHits)
+	float Radius, int32 InterpolationPerTrace, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits)
 {
 	//이전 프레임 소켓 위치와 현재 프레임 소켓 위치 사이의 간극이 큰 것을 방지하기 위해
 	//보간으로 프레임 간 중간 지점을 찾아 스윕 포인트 추가
 
-	FCollisionQueryParams Params = GetCollisionQueryParams();
-
 	for (int32 i = 0; i <= InterpolationPerTrace; ++i)
 	{
 		float Alpha = static_cast<float>(i) / static_cast<float>(InterpolationPerTrace);
@@ -535,21 +996,21 @@ void UAttackTraceComponent::PerformInterpolationTrace(
 		FVector InterpStart = FMath::Lerp(StartPrev, StartCurr, Alpha);
 		FVector InterpEnd = FMath::Lerp(EndPrev, EndCurr, Alpha);
 
-		TArray<FHitResult> SubHits;
+		SweepWeaponCapsule(InterpStart, InterpEnd, Radius, FCollisionShape::MakeCapsule(Radius, (InterpEnd - InterpStart).Size() * 0.5f), Params, SweepHitScratch);
 
-		GetWorld()->SweepMultiByChannel(
-			SubHits,
-			InterpStart,
-			InterpEnd,
-			FQuat::Identity,
-			GetTraceChannel(),
-			FCollisionShape::MakeCapsule(Radius, (InterpEnd - InterpStart).Size() * 0.5f),
-			Params
-		);
+		OutHits.Append(SweepHitScratch);
 
-		OutHits.Append(SubHits);
+		//Visual Logger는 캡슐을 바닥 중심 기준으로 기록
+		UE_VLOG_CAPSULE(GetVisualLogOwner(), LogAPHitDetection, Log,
+			InterpStart - (InterpEnd - InterpStart).GetSafeNormal() * Radius,
+			(InterpEnd - InterpStart).Size() * 0.5f + Radius,
+			Radius,
+			FQuat::FindBetweenNormals(FVector::UpVector, (InterpEnd - InterpStart).GetSafeNormal()),
+			SweepHitScratch.Num() > 0 ? FColor::Yellow : DebugTraceColor,
+			TEXT("Sweep %d/%d"), i, InterpolationPerTrace);
 
 		++DebugSweepTraceCounter;
+		++TotalSweepTraceCounter;
 		if (bDrawDebugTrace)
 		{
 			DrawDebugCapsule(GetWorld(),
@@ -565,7 +1026,283 @@ void UAttackTraceComponent::PerformInterpolationTrace(
 }
 #pragma endregion
 
+#pragma region "Montage Time Functions"
+bool UAttackTraceComponent::BeginMontageWindow()
+{
+	if (!MontageTimeTrace::bEnabled) return false;
+
+	ABaseCharacter* Character = FindAnimatedCharacter();
+	USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	UAnimInstance* AnimInstance = Mesh ? Mesh->GetAnimInstance() : nullptr;
+	const UAnimMontage* Montage = AnimInstance ? AnimInstance->GetCurrentActiveMontage() : nullptr;
+	if (!Montage) return false;
+
+	const float Position = AnimInstance->Montage_GetPosition(Montage);
+
+	//시작 이벤트는 노티파이 다음 Tick에 전달되므로 현재 위치를 포함하는 구간 중 가장 늦게 시작한 구간 선택
+	const FAnimNotifyEvent* WindowNotify = nullptr;
+	for (const FAnimNotifyEvent& Notify : Montage->Notifies)
+	{
+		if (!Cast<UAnimNotifyState_HitDetection>(Notify.NotifyStateClass)) continue;
+		if (Notify.GetTriggerTime() > Position || Position > Notify.GetEndTriggerTime()) continue;
+
+		if (!WindowNotify || Notify.GetTriggerTime() > WindowNotify->GetTriggerTime())
+		{
+			WindowNotify = &Notify;
+		}
+	}
+
+	if (!WindowNotify)
+	{
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("BeginMontageWindow: no HitDetection window at %.3f in %s"), Position, *GetNameSafe(Montage));
+		return false;
+	}
+
+	if (!MontageWindow.Sampler.Initialize(Montage, Mesh) || !ResolveSocketBones(Mesh))
+	{
+		MontageWindow.Sampler.Reset();
+		return false;
+	}
+
+	MontageWindow.AnimInstance = AnimInstance;
+	MontageWindow.Montage = Montage;
+	MontageWindow.Mesh = Mesh;
+	MontageWindow.StartTime = WindowNotify->GetTriggerTime();
+	MontageWindow.EndTime = WindowNotify->GetEndTriggerTime();
+	MontageWindow.PrevMeshTransform = Mesh->GetComponentTransform();
+	MontageWindow.CurrMeshTransform = MontageWindow.PrevMeshTransform;
+	MontageWindow.PrevTickTime = Position;
+	MontageWindow.CurrTickTime = Position;
+
+	//구간 시작 시간의 포즈부터 스윕 (이벤트 전달까지 지난 시간도 포함)
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		if (!SampleSocketPositions(Pair.Value, MontageWindow.StartTime, Pair.Value.CurrentSocketPositions))
+		{
+			MontageWindow.Sampler.Reset();
+			return false;
+		}
+	}
+
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		Pair.Value.PreviousSocketPositions = Pair.Value.CurrentSocketPositions;
+		Pair.Value.MontageTracedTime = MontageWindow.StartTime;
+	}
+
+	MontageWindow.bActive = true;
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("BeginMontageWindow: %s [%.3f, %.3f], position %.3f"),
+		*GetNameSafe(Montage), MontageWindow.StartTime, MontageWindow.EndTime, Position);
+	return true;
+}
+
+void UAttackTraceComponent::EndMontageWindow()
+{
+	MontageWindow.bActive = false;
+	MontageWindow.AnimInstance.Reset();
+	MontageWindow.Montage.Reset();
+	MontageWindow.Mesh.Reset();
+	MontageWindow.Sampler.Reset();
+}
+
+bool UAttackTraceComponent::UpdateMontageWindow()
+{
+	UAnimInstance* AnimInstance = MontageWindow.AnimInstance.Get();
+	const UAnimMontage* Montage = MontageWindow.Montage.Get();
+	const USkeletalMeshComponent* Mesh = MontageWindow.Mesh.Get();
+	if (!AnimInstance || !Montage || !Mesh || !MontageWindow.Sampler.IsValid()) return false;
+	if (!AnimInstance->Montage_IsActive(Montage)) return false;
+
+	//섹션 점프/루프로 위치가 되돌아가면 같은 구간으로 볼 수 없음
+	const float Position = AnimInstance->Montage_GetPosition(Montage);
+	if (Position < MontageWindow.CurrTickTime) return false;
+
+	MontageWindow.PrevMeshTransform = MontageWindow.CurrMeshTransform;
+	MontageWindow.PrevTickTime = MontageWindow.CurrTickTime;
+	MontageWindow.CurrMeshTransform = Mesh->GetComponentTransform();
+	MontageWindow.CurrTickTime = FMath::Min(Position, MontageWindow.EndTime);
+	return true;
+}
+
+void UAttackTraceComponent::AdvanceMontageWindow(float TargetTime, bool bFinal)
+{
+	//트레이스할 간격이 있는 그룹이 있을 때만 랙 보상 되감기
+	bool bHasPendingStep = false;
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		const float Remaining = TargetTime - Pair.Value.MontageTracedTime;
+		bHasPendingStep |= bFinal ? Remaining > KINDA_SMALL_NUMBER : Remaining >= Pair.Value.CurrentSecondsPerTrace;
+	}
+	if (!bHasPendingStep) return;
+
+	FScopedLagCompensation LagCompensation(FindAnimatedCharacter(), LagCompensationRadius);
+	const FCollisionQueryParams Params = GetCollisionQueryParams();
+
+	//몽타주 1초당 월드 시간 배율, 백엔드 선택용 최고 속도는 CCD와 같은 월드 시간 단위로 기록
+	float WorldTimeScale = 1.0f;
+	if (const UAnimInstance* AnimInstance = MontageWindow.AnimInstance.Get())
+	{
+		WorldTimeScale = AnimInstance->Montage_GetEffectivePlayRate(MontageWindow.Montage.Get());
+		if (const AActor* MeshOwner = AnimInstance->GetOwningActor())
+		{
+			WorldTimeScale *= MeshOwner->CustomTimeDilation;
+		}
+	}
+
+	bool bSampleFailed = false;
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		FHitSocketGroupConfig& SocketGroup = Pair.Value;
+		const float Remaining = TargetTime - SocketGroup.MontageTracedTime;
+		if (Remaining <= KINDA_SMALL_NUMBER) continue;
+		if (!bFinal && Remaining < SocketGroup.CurrentSecondsPerTrace) continue;
+
+		//예산 초과 시 다음 Tick에 이어서 트레이스, 샘플 시간은 몽타주 시간 격자에 고정되어 빠지는 구간 없음
+		if (!bFinal && !UHitTraceBudgetSubsystem::TryConsume(this, Remaining)) continue;
+
+		const int32 SweepCountBefore = DebugSweepTraceCounter;
+		const double TraceStartTime = FPlatformTime::Seconds();
+
+		while (TargetTime - SocketGroup.MontageTracedTime > KINDA_SMALL_NUMBER)
+		{
+			float SampleTime = SocketGroup.MontageTracedTime + SocketGroup.CurrentSecondsPerTrace;
+			if (SampleTime > TargetTime)
+			{
+				if (!bFinal) break;
+				SampleTime = TargetTime;
+			}
+
+			if (!SampleSocketPositions(SocketGroup, SampleTime, SocketGroup.CurrentSocketPositions))
+			{
+				AP_DEBUG_LOG(LogAPHitDetection, TEXT("AdvanceMontageWindow: cannot sample %s at %.3f"), *Pair.Key.ToString(), SampleTime);
+				bSampleFailed = true;
+				break;
+			}
+
+			//몽타주 시간 기준 속도, 재생 속도와 무관하게 같은 단계 선택
+			const float StepSeconds = SampleTime - SocketGroup.MontageTracedTime;
+			ApplyAdaptiveTier(SocketGroup, FVector::Dist(SocketGroup.CurrentSocketPositions[0], SocketGroup.PreviousSocketPositions[0]) / StepSeconds, WorldTimeScale);
+
+			UE_VLOG(GetVisualLogOwner(), LogAPHitDetection, Log, TEXT("Trace %s @ %.3f: tier %d (%.0f cm/s), %d interpolation, %.3f s"),
+				*Pair.Key.ToString(), SampleTime, SocketGroup.CurrentAdaptiveTier, SocketGroup.CurrentSwingSpeed,
+				SocketGroup.CurrentInterpolationPerTrace, StepSeconds);
+
+			PerformGroupTrace(SocketGroup, Params);
+
+			Swap(SocketGroup.PreviousSocketPositions, SocketGroup.CurrentSocketPositions);
+			SocketGroup.MontageTracedTime = SampleTime;
+		}
+
+		UHitTraceBudgetSubsystem::ReportTraceTime(this, DebugSweepTraceCounter - SweepCountBefore, FPlatformTime::Seconds() - TraceStartTime);
+
+		if (bSampleFailed)
+		{
+			EndMontageWindow();
+			return;
+		}
+	}
+}
+
+bool UAttackTraceComponent::ResolveSocketBones(const USkeletalMeshComponent* CharacterMesh)
+{
+	if (!OwnerMesh || !CharacterMesh) return false;
+
+	//캐릭터 메시가 아니면 캐릭터 메시에 부착된 본이 모든 소켓을 구동 (무기)
+	const bool bOwnerIsCharacterMesh = OwnerMesh == CharacterMesh;
+	FName AttachBoneName = NAME_None;
+	if (!bOwnerIsCharacterMesh)
+	{
+		const USceneComponent* Child = OwnerMesh;
+		while (Child && Child->GetAttachParent() != CharacterMesh)
+		{
+			Child = Child->GetAttachParent();
+		}
+		if (!Child) return false;
+
+		AttachBoneName = CharacterMesh->GetSocketBoneName(Child->GetAttachSocketName());
+	}
+
+	for (TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		FHitSocketGroupConfig& SocketGroup = Pair.Value;
+		SocketGroup.SocketBoneIndices.Reset();
+		SocketGroup.SocketBoneOffsets.Reset();
+
+		for (const FName& SocketName : SocketGroup.TraceSocketNames)
+		{
+			const FName BoneName = bOwnerIsCharacterMesh ? CharacterMesh->GetSocketBoneName(SocketName) : AttachBoneName;
+			const int32 BoneIndex = CharacterMesh->GetBoneIndex(BoneName);
+			if (BoneIndex == INDEX_NONE || !OwnerMesh->DoesSocketExist(SocketName))
+			{
+				AP_DEBUG_LOG(LogAPHitDetection, TEXT("ResolveSocketBones: no driving bone for %s"), *SocketName.ToString());
+				return false;
+			}
+
+			//부착은 강체로 가정, 구간 시작 시점 렌더 포즈 기준 오프셋
+			SocketGroup.SocketBoneIndices.Add(BoneIndex);
+			SocketGroup.SocketBoneOffsets.Add(CharacterMesh->GetBoneTransform(BoneIndex).InverseTransformPosition(OwnerMesh->GetSocketLocation(SocketName)));
+		}
+	}
+	return true;
+}
+
+bool UAttackTraceComponent::SampleSocketPositions(FHitSocketGroupConfig& SocketGroup, float MontageTime, TArray<FVector, TInlineAllocator<FHitSocketGroupConfig::InlineSocketCount>>& OutPositions)
+{
+	const int32 NumSockets = SocketGroup.SocketBoneIndices.Num();
+	if (NumSockets == 0 || NumSockets != SocketGroup.TraceSocketNames.Num()) return false;
+
+	const FTransform MeshTransform = GetMeshTransformAtMontageTime(MontageTime);
+	OutPositions.SetNumUninitialized(NumSockets, EAllowShrinking::No);
+
+	for (int32 i = 0; i < NumSockets; ++i)
+	{
+		FTransform BoneTransform;
+		if (!MontageWindow.Sampler.GetComponentSpaceTransform(SocketGroup.SocketBoneIndices[i], MontageTime, BoneTransform))
+		{
+			return false;
+		}
+
+		OutPositions[i] = MeshTransform.TransformPosition(BoneTransform.TransformPosition(SocketGroup.SocketBoneOffsets[i]));
+	}
+	return true;
+}
+
+FTransform UAttackTraceComponent::GetMeshTransformAtMontageTime(float MontageTime) const
+{
+	//캐릭터 이동(루트 모션 포함)은 Tick 사이를 몽타주 시간 비율로 보간
+	const float Span = MontageWindow.CurrTickTime - MontageWindow.PrevTickTime;
+	if (Span <= KINDA_SMALL_NUMBER)
+	{
+		return MontageWindow.CurrMeshTransform;
+	}
+
+	const float Alpha = FMath::Clamp((MontageTime - MontageWindow.PrevTickTime) / Span, 0.0f, 1.0f);
+	FTransform Result;
+	Result.Blend(MontageWindow.PrevMeshTransform, MontageWindow.CurrMeshTransform, Alpha);
+	return Result;
+}
+#pragma endregion
+
 #pragma region "Utility Functions"
+const UObject* UAttackTraceComponent::GetVisualLogOwner() const
+{
+	if (const ABaseCharacter* Character = FindAnimatedCharacter())
+	{
+		return Character;
+	}
+	return GetOwner();
+}
+
+SIZE_T UAttackTraceComponent::GetTraceScratchAllocatedSize() const
+{
+	SIZE_T Size = SweepHitScratch.GetAllocatedSize() + TraceHitScratch.GetAllocatedSize() + OverlapScratch.GetAllocatedSize() + HitValidationMap.GetAllocatedSize();
+	for (const TPair<FName, FHitSocketGroupConfig>& Pair : UsingHitSocketGroups)
+	{
+		Size += Pair.Value.PreviousSocketPositions.GetAllocatedSize() + Pair.Value.CurrentSocketPositions.GetAllocatedSize();
+	}
+	return Size;
+}
+
 ECollisionChannel UAttackTraceComponent::GetTraceChannel() const
 {
 	//프로젝트 설정에서 커스텀 채널 사용
@@ -573,10 +1310,50 @@ ECollisionChannel UAttackTraceComponent::GetTraceChannel() const
 	return ECC_GameTraceChannel1;  //WeaponTrace 채널
 }
 
+ABaseCharacter* UAttackTraceComponent::FindAnimatedCharacter() const
+{
+	//Owner 체인을 따라 올라가 캐릭터 탐색 (Weapon -> Character)
+	AActor* Actor = GetOwner();
+	while (Actor)
+	{
+		if (ABaseCharacter* Character = Cast<ABaseCharacter>(Actor))
+		{
+			return Character;
+		}
+		Actor = Actor->GetOwner();
+	}
+	return nullptr;
+}
+
+void UAttackTraceComponent::SetFullRateAnimation(bool bEnable)
+{
+	if (bEnable)
+	{
+		if (FullRateAnimationCharacter.IsValid()) return;
+
+		ABaseCharacter* Character = FindAnimatedCharacter();
+		if (!Character) return;
+
+		Character->PushFullRateAnimation();
+		FullRateAnimationCharacter = Character;
+	}
+	else
+	{
+		if (ABaseCharacter* Character = FullRateAnimationCharacter.Get())
+		{
+			Character->PopFullRateAnimation();
+		}
+		FullRateAnimationCharacter.Reset();
+	}
+}
+
 FCollisionQueryParams UAttackTraceComponent::GetCollisionQueryParams() const
 {
 	FCollisionQueryParams Params(TEXT("AttackTrace"), false);
 
+	//히트 임팩트 테이블의 표면 키
+	Params.bReturnPhysicalMaterial = true;
+
 	AddIgnoredActors(Params);
 
 	return Params;
@@ -587,6 +1364,8 @@ FCollisionQueryParams UAttackTraceComponent::GetCollisionQueryParams() const
 void UAttackTraceComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	UnbindEventCallbacks();
+	SetFullRateAnimation(false);
+	UHitTraceBudgetSubsystem::UnregisterTracer(this);
 
 	Super::EndPlay(EndPlayReason);
 }
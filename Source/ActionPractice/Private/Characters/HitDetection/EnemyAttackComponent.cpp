@@ -7,15 +7,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "AbilitySystemComponent.h"
 #include "Components/InputComponent.h"
-
-#define ENABLE_DEBUG_LOG 1
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogEnemyAttackComponent, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogEnemyAttackComponent, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UEnemyAttackComponent::UEnemyAttackComponent()
 {
@@ -26,7 +18,7 @@ void UEnemyAttackComponent::BeginPlay()
 	OwnerEnemy = Cast<ABossCharacter>(GetOwner());
 	if (!OwnerEnemy)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackComponent: Owner is not an Enemy!"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent: Owner is not an Enemy!"));
 		return;
 	}
 
@@ -67,12 +59,12 @@ UAbilitySystemComponent* UEnemyAttackComponent::GetOwnerASC() const
 #pragma region "Trace Config Functions"
 bool UEnemyAttackComponent::LoadTraceConfig(const FName& AttackName, int32 ComboIndex)
 {
-	DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig: AttackName=%s, ComboIndex=%d"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig: AttackName=%s, ComboIndex=%d"),
 		*AttackName.ToString(), ComboIndex);
 
 	if (!OwnerEnemy)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
 		return false;
 	}
 
@@ -80,14 +72,14 @@ bool UEnemyAttackComponent::LoadTraceConfig(const FName& AttackName, int32 Combo
 	const UEnemyDataAsset* EnemyData = OwnerEnemy->GetEnemyData();
 	if (!EnemyData)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
 		return false;
 	}
 
 	const FNamedAttackData* AttackData = EnemyData->NamedAttackData.Find(AttackName);
 	if (!AttackData || AttackData->ComboSequence.Num() == 0)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
 		return false;
 	}
 
@@ -95,7 +87,7 @@ bool UEnemyAttackComponent::LoadTraceConfig(const FName& AttackName, int32 Combo
 	ComboIndex = FMath::Clamp(ComboIndex, 0, AttackData->ComboSequence.Num() - 1);
 	const FAttackStats& AttackInfo = AttackData->ComboSequence[ComboIndex].AttackData;
 
-	UsingHitSocketGroups.Empty();
+	UsingHitSocketGroups.Reset();
 
 	//AttackStats의 UsingSocketConfigs에서 사용할 소켓들을 가져옴
 	for (const FAttackSocketConfig& SocketConfig : AttackInfo.UsingSocketConfigs)
@@ -111,7 +103,7 @@ bool UEnemyAttackComponent::LoadTraceConfig(const FName& AttackName, int32 Combo
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig FAILED"));
 		}
 	}
 
@@ -120,7 +112,7 @@ bool UEnemyAttackComponent::LoadTraceConfig(const FName& AttackName, int32 Combo
 	CurrentAttackData.PoiseDamage = AttackInfo.PoiseDamage;
 	CurrentAttackData.DamageType = AttackInfo.DamageType;
 
-	DEBUG_LOG(TEXT("EnemyAttackComponent::LoadTraceConfig SUCCESS (UsingSocketGroups=%d)"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent::LoadTraceConfig SUCCESS (UsingSocketGroups=%d)"),
 		UsingHitSocketGroups.Num());
 
 	return true;
@@ -135,7 +127,7 @@ void UEnemyAttackComponent::SetOwnerMesh()
 
 	if (!OwnerMesh)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackComponent: No Enemy SkeletalMesh"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("EnemyAttackComponent: No Enemy SkeletalMesh"));
 		return;
 	}
 }
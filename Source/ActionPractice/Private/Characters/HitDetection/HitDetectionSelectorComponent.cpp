@@ -0,0 +1,265 @@
+#include "Characters/HitDetection/HitDetectionSelectorComponent.h"
+#include "Characters/HitDetection/AttackTraceComponent.h"
+#include "Characters/HitDetection/WeaponCCDComponent.h"
+#include "Characters/HitDetection/HitTraceBudgetSubsystem.h"
+#include "Items/AttackData.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace HitBackendSelect
+{
+	static int32 ForcedBackend = 0;
+	static FAutoConsoleVariableRef CVarForcedBackend(
+		TEXT("ap.HitDetection.Backend.Force"),
+		ForcedBackend,
+		TEXT("0: select the weapon hit detection backend per attack, 1: always sweep, 2: always CCD."));
+
+	static float BudgetLoadThreshold = 0.75f;
+	static FAutoConsoleVariableRef CVarBudgetLoadThreshold(
+		TEXT("ap.HitDetection.Backend.BudgetLoad"),
+		BudgetLoadThreshold,
+		TEXT("Fraction of the trace sweep budget used last frame above which faster attacks are moved to CCD."));
+
+	static float BudgetSpeedScale = 2.0f;
+	static FAutoConsoleVariableRef CVarBudgetSpeedScale(
+		TEXT("ap.HitDetection.Backend.BudgetSpeedScale"),
+		BudgetSpeedScale,
+		TEXT("Multiplier on the CCD tip speed limit while the sweep budget is under pressure."));
+}
+
+UHitDetectionSelectorComponent::UHitDetectionSelectorComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UHitDetectionSelectorComponent::SetBackends(UAttackTraceComponent* InSweep, UWeaponCCDComponent* InCCD)
+{
+	if (SweepBackend && SweepHitHandle.IsValid())
+	{
+		SweepBackend->GetOnHitDetected().Remove(SweepHitHandle);
+	}
+	if (CCDBackend && CCDHitHandle.IsValid())
+	{
+		CCDBackend->GetOnHitDetected().Remove(CCDHitHandle);
+	}
+
+	SweepBackend = InSweep;
+	CCDBackend = InCCD;
+
+	//어느 백엔드의 히트든 같은 델리게이트로 전달
+	SweepHitHandle = SweepBackend ? SweepBackend->GetOnHitDetected().AddUObject(this, &UHitDetectionSelectorComponent::HandleBackendHit) : FDelegateHandle();
+	CCDHitHandle = CCDBackend ? CCDBackend->GetOnHitDetected().AddUObject(this, &UHitDetectionSelectorComponent::HandleBackendHit) : FDelegateHandle();
+}
+
+void UHitDetectionSelectorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SetBackends(nullptr, nullptr);
+	Super::EndPlay(EndPlayReason);
+}
+
+#pragma region "HitDetection Interface"
+void UHitDetectionSelectorComponent::PrepareHitDetection(const FGameplayTagContainer& AttackTags, const int32 ComboIndex)
+{
+	RecordLastAttackSpeed();
+
+	const EHitDetectionBackend Backend = SelectBackend(AttackTags, ComboIndex);
+	ActivateBackend(Backend);
+
+	if (IHitDetectionInterface* HitDetection = GetBackend(Backend))
+	{
+		HitDetection->PrepareHitDetection(AttackTags, ComboIndex);
+	}
+
+	LastAttackTags = AttackTags;
+	LastComboIndex = ComboIndex;
+}
+
+void UHitDetectionSelectorComponent::PrepareHitDetection(const FName& AttackName, const int32 ComboIndex)
+{
+	//이름 기반 공격은 스윕만 지원
+	LastComboIndex = INDEX_NONE;
+	ActivateBackend(EHitDetectionBackend::Sweep);
+
+	if (SweepBackend)
+	{
+		SweepBackend->PrepareHitDetection(AttackName, ComboIndex);
+	}
+}
+
+void UHitDetectionSelectorComponent::HandleHitDetectionStart(const FGameplayEventData& Payload)
+{
+	if (IHitDetectionInterface* HitDetection = GetBackend(ActiveBackend))
+	{
+		HitDetection->HandleHitDetectionStart(Payload);
+	}
+}
+
+void UHitDetectionSelectorComponent::HandleHitDetectionEnd(const FGameplayEventData& Payload)
+{
+	if (IHitDetectionInterface* HitDetection = GetBackend(ActiveBackend))
+	{
+		HitDetection->HandleHitDetectionEnd(Payload);
+	}
+}
+
+void UHitDetectionSelectorComponent::CancelHitDetection()
+{
+	ActivateBackend(EHitDetectionBackend::None);
+	LastComboIndex = INDEX_NONE;
+}
+#pragma endregion
+
+#pragma region "Backend Selection"
+IHitDetectionInterface* UHitDetectionSelectorComponent::GetBackend(EHitDetectionBackend Backend) const
+{
+	switch (Backend)
+	{
+	case EHitDetectionBackend::Sweep:
+		return SweepBackend;
+	case EHitDetectionBackend::CCD:
+		return CCDBackend;
+	default:
+		return nullptr;
+	}
+}
+
+void UHitDetectionSelectorComponent::RecordLastAttackSpeed()
+{
+	if (LastComboIndex == INDEX_NONE) return;
+
+	//두 백엔드 모두 월드 시간 기준 cm/s, 재생 속도가 다른 몽타주도 같은 기준으로 비교
+	float MeasuredSpeed = 0.0f;
+	if (ActiveBackend == EHitDetectionBackend::Sweep && SweepBackend)
+	{
+		MeasuredSpeed = SweepBackend->GetPeakSwingSpeed();
+	}
+	else if (ActiveBackend == EHitDetectionBackend::CCD && CCDBackend)
+	{
+		MeasuredSpeed = CCDBackend->GetPeakTipSpeed();
+	}
+
+	//판정 구간 전에 취소된 공격은 기록하지 않음
+	if (MeasuredSpeed <= 0.0f) return;
+
+	FAttackSpeedRecord* Record = SpeedRecords.FindByPredicate([this](const FAttackSpeedRecord& Existing)
+	{
+		return Existing.ComboIndex == LastComboIndex && Existing.AttackTags == LastAttackTags;
+	});
+	if (!Record)
+	{
+		Record = &SpeedRecords.AddDefaulted_GetRef();
+		Record->AttackTags = LastAttackTags;
+		Record->ComboIndex = LastComboIndex;
+		Record->PeakTipSpeed = MeasuredSpeed;
+	}
+	else
+	{
+		//프레임 간격에 따른 측정 편차 완화
+		Record->PeakTipSpeed = FMath::Lerp(Record->PeakTipSpeed, MeasuredSpeed, 0.5f);
+	}
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Backend: recorded tip speed %.0f (measured %.0f) for combo %d"), Record->PeakTipSpeed, MeasuredSpeed, LastComboIndex);
+}
+
+const FAttackSpeedRecord* UHitDetectionSelectorComponent::FindSpeedRecord(const FGameplayTagContainer& AttackTags, int32 ComboIndex) const
+{
+	return SpeedRecords.FindByPredicate([&AttackTags, ComboIndex](const FAttackSpeedRecord& Record)
+	{
+		return Record.ComboIndex == ComboIndex && Record.AttackTags == AttackTags;
+	});
+}
+
+EHitDetectionBackend UHitDetectionSelectorComponent::SelectBackend(const FGameplayTagContainer& AttackTags, int32 ComboIndex) const
+{
+	if (!CCDBackend) return EHitDetectionBackend::Sweep;
+	if (!SweepBackend) return EHitDetectionBackend::CCD;
+
+	if (HitBackendSelect::ForcedBackend == 1) return EHitDetectionBackend::Sweep;
+	if (HitBackendSelect::ForcedBackend == 2) return EHitDetectionBackend::CCD;
+	if (!bAutoSelect) return FixedBackend;
+
+	//처음 보는 공격은 정밀한 스윕으로 속도 측정
+	const FAttackSpeedRecord* Record = FindSpeedRecord(AttackTags, ComboIndex);
+	if (!Record)
+	{
+		INC_DWORD_STAT(STAT_CombatBackendSweep);
+		return EHitDetectionBackend::Sweep;
+	}
+
+	//스윕 예산이 부족하면 더 빠른 공격까지 CCD로
+	float SpeedLimit = CCDMaxTipSpeed;
+	const float SweepLoad = UHitTraceBudgetSubsystem::GetSweepLoad(GetWorld());
+	if (SweepLoad >= HitBackendSelect::BudgetLoadThreshold)
+	{
+		SpeedLimit *= HitBackendSelect::BudgetSpeedScale;
+	}
+
+	const bool bSlowAttack = Record->PeakTipSpeed <= SpeedLimit;
+	const int32 NearbyTargets = bSlowAttack ? CountNearbyTargets() : 0;
+	const bool bUseCCD = bSlowAttack && NearbyTargets <= CCDMaxNearbyTargets;
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Backend: %s (tip %.0f / limit %.0f, targets %d, sweep load %.2f)"),
+		bUseCCD ? TEXT("CCD") : TEXT("Sweep"), Record->PeakTipSpeed, SpeedLimit, NearbyTargets, SweepLoad);
+
+	if (bUseCCD)
+	{
+		INC_DWORD_STAT(STAT_CombatBackendCCD);
+		return EHitDetectionBackend::CCD;
+	}
+
+	INC_DWORD_STAT(STAT_CombatBackendSweep);
+	return EHitDetectionBackend::Sweep;
+}
+
+int32 UHitDetectionSelectorComponent::CountNearbyTargets() const
+{
+	UWorld* World = GetWorld();
+	AActor* Weapon = GetOwner();
+	if (!World || !Weapon) return 0;
+
+	//무기는 소유 캐릭터 기준
+	const AActor* Attacker = Weapon->GetOwner() ? Weapon->GetOwner() : Weapon;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(HitBackendDensity), false);
+	Params.AddIgnoredActor(Weapon);
+	Params.AddIgnoredActor(Attacker);
+
+	TArray<FOverlapResult> Overlaps;
+	World->OverlapMultiByObjectType(Overlaps, Attacker->GetActorLocation(), FQuat::Identity,
+		FCollisionObjectQueryParams(ECC_Pawn), FCollisionShape::MakeSphere(DensityRadius), Params);
+
+	//한 폰이 여러 컴포넌트로 잡힐 수 있으므로 폰 단위로 집계
+	TArray<const APawn*, TInlineAllocator<8>> Pawns;
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		if (const APawn* Pawn = Cast<APawn>(Overlap.GetActor()))
+		{
+			Pawns.AddUnique(Pawn);
+		}
+	}
+	return Pawns.Num();
+}
+
+void UHitDetectionSelectorComponent::ActivateBackend(EHitDetectionBackend Backend)
+{
+	//선택되지 않은 백엔드가 이전 공격의 준비 상태로 HitDetection 이벤트를 받지 않도록 해제
+	if (ActiveBackend != Backend)
+	{
+		if (IHitDetectionInterface* Previous = GetBackend(ActiveBackend))
+		{
+			Previous->CancelHitDetection();
+		}
+	}
+
+	ActiveBackend = Backend;
+}
+
+void UHitDetectionSelectorComponent::HandleBackendHit(AActor* HitActor, const FHitResult& HitResult, FFinalAttackData AttackData)
+{
+	OnHit.Broadcast(HitActor, HitResult, AttackData);
+}
+#pragma endregion
@@ -0,0 +1,487 @@
+#include "Characters/HitDetection/HitImpactSubsystem.h"
+#include "Characters/HitDetection/HitImpactTable.h"
+#include "Characters/BaseCharacter.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundBase.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace HitImpact
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.Impact.Enable"),
+		bEnabled,
+		TEXT("Play hit impact effects and sounds from the impact tables."));
+
+	static int32 MaxPerFrame = 8;
+	static FAutoConsoleVariableRef CVarMaxPerFrame(
+		TEXT("ap.Impact.MaxPerFrame"),
+		MaxPerFrame,
+		TEXT("Maximum hit impacts started per frame, nearest to the view first. 0 disables the cap."));
+
+	static float CullDistance = 5000.0f;
+	static FAutoConsoleVariableRef CVarCullDistance(
+		TEXT("ap.Impact.CullDistance"),
+		CullDistance,
+		TEXT("Hit impacts farther than this from every local view are dropped. 0 disables distance culling."));
+
+	static int32 PoolSize = 16;
+	static FAutoConsoleVariableRef CVarPoolSize(
+		TEXT("ap.Impact.PoolSize"),
+		PoolSize,
+		TEXT("Pooled effect and audio components each. When all are busy the one started earliest is restarted."));
+}
+
+#pragma region "Subsystem Functions"
+bool UHitImpactSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHitImpactSubsystem::Deinitialize()
+{
+	for (UNiagaraComponent* Component : EffectPool)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	for (UAudioComponent* Component : AudioPool)
+	{
+		if (IsValid(Component))
+		{
+			Component->DestroyComponent();
+		}
+	}
+	EffectPool.Empty();
+	AudioPool.Empty();
+	EffectStartTimes.Empty();
+	AudioStartTimes.Empty();
+	PendingImpacts.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHitImpactSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && PendingImpacts.Num() > 0;
+}
+
+TStatId UHitImpactSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHitImpactSubsystem, STATGROUP_Tickables);
+}
+
+void UHitImpactSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//월드 Tick 이후 호출, 이번 프레임에 쌓인 히트를 한 번에 처리
+	FlushImpacts();
+}
+#pragma endregion
+
+#pragma region "Impact Queue"
+void UHitImpactSubsystem::BroadcastImpact(ABaseCharacter* Attacker, const UHitImpactTable* Table, const AActor* Target,
+	const FHitResult& HitResult, const FFinalAttackData& AttackData)
+{
+	if (!HitImpact::bEnabled || !Table || !Attacker) return;
+
+	FHitImpactNetData Impact;
+	Impact.Table = Table;
+	Impact.Target = Target;
+	Impact.DamageType = AttackData.DamageType;
+	Impact.Damage = AttackData.FinalDamage;
+	Impact.Surface = UPhysicalMaterial::DetermineSurfaceType(HitResult.PhysMaterial.Get());
+
+	//초기 겹침 히트는 ImpactPoint가 비어 있을 수 있으므로 대상 위치로 대체
+	Impact.Location = HitResult.ImpactPoint;
+	if (Impact.Location.IsNearlyZero() && Target)
+	{
+		Impact.Location = Target->GetActorLocation();
+	}
+	Impact.Normal = HitResult.ImpactNormal.IsNearlyZero() ? FVector::UpVector : FVector(HitResult.ImpactNormal);
+
+	//서버 판정은 모든 머신에 전달, 소유 클라이언트의 예측 판정은 로컬에만 (멀티캐스트에서 중복 제외)
+	if (Attacker->HasAuthority())
+	{
+		Attacker->MulticastHitImpact(Impact);
+	}
+	else if (Attacker->IsLocallyControlled())
+	{
+		QueueImpact(Attacker, Impact);
+	}
+}
+
+void UHitImpactSubsystem::QueueImpact(const UObject* WorldContext, const FHitImpactNetData& Impact)
+{
+	if (!HitImpact::bEnabled || !Impact.Table || !WorldContext) return;
+
+	UWorld* World = WorldContext->GetWorld();
+	if (!World || World->GetNetMode() == NM_DedicatedServer) return;
+
+	UHitImpactSubsystem* Subsystem = World->GetSubsystem<UHitImpactSubsystem>();
+	if (!Subsystem) return;
+
+	FHitImpactRequest& Request = Subsystem->PendingImpacts.AddDefaulted_GetRef();
+	Request.Table = Impact.Table.Get();
+	Request.Target = Impact.Target.Get();
+	Request.Location = Impact.Location;
+	Request.Normal = Impact.Normal;
+	Request.DamageType = Impact.DamageType;
+	Request.Surface = Impact.Surface;
+	Request.Damage = Impact.Damage;
+
+	INC_DWORD_STAT(STAT_CombatImpactsQueued);
+}
+
+FHitImpactPlanStats UHitImpactSubsystem::PlanImpacts(TArray<FHitImpactRequest>& Requests, TConstArrayView<FVector> ViewLocations,
+	float CullDistance, int32 MaxImpacts)
+{
+	FHitImpactPlanStats Stats;
+
+	//볼 수 있는 뷰가 없으면 전부 컬링
+	if (ViewLocations.IsEmpty())
+	{
+		Stats.Culled = Requests.Num();
+		Requests.Reset();
+		return Stats;
+	}
+
+	//같은 대상의 히트는 데미지가 가장 큰 것 하나로 병합 (대상이 없는 히트는 병합하지 않음)
+	TMap<const AActor*, int32, TInlineSetAllocator<16>> TargetToIndex;
+	int32 NumKept = 0;
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		if (const AActor* Target = Requests[Index].Target.Get())
+		{
+			if (const int32* KeptIndex = TargetToIndex.Find(Target))
+			{
+				++Stats.Merged;
+				if (Requests[Index].Damage > Requests[*KeptIndex].Damage)
+				{
+					Requests[*KeptIndex] = MoveTemp(Requests[Index]);
+				}
+				continue;
+			}
+			TargetToIndex.Add(Target, NumKept);
+		}
+
+		if (NumKept != Index)
+		{
+			Requests[NumKept] = MoveTemp(Requests[Index]);
+		}
+		++NumKept;
+	}
+	Requests.SetNum(NumKept, EAllowShrinking::No);
+
+	//가장 가까운 뷰 기준 거리 컬링
+	for (FHitImpactRequest& Request : Requests)
+	{
+		Request.ViewDistanceSq = TNumericLimits<float>::Max();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			Request.ViewDistanceSq = FMath::Min(Request.ViewDistanceSq, static_cast<float>(FVector::DistSquared(ViewLocation, Request.Location)));
+		}
+	}
+
+	if (CullDistance > 0.0f)
+	{
+		const float CullDistanceSq = FMath::Square(CullDistance);
+		const int32 NumBeforeCull = Requests.Num();
+		Requests.RemoveAllSwap([CullDistanceSq](const FHitImpactRequest& Request)
+		{
+			return Request.ViewDistanceSq > CullDistanceSq;
+		}, EAllowShrinking::No);
+		Stats.Culled = NumBeforeCull - Requests.Num();
+	}
+
+	//상한을 넘으면 가까운 순으로 남김
+	if (MaxImpacts > 0 && Requests.Num() > MaxImpacts)
+	{
+		Requests.Sort([](const FHitImpactRequest& A, const FHitImpactRequest& B)
+		{
+			return A.ViewDistanceSq < B.ViewDistanceSq;
+		});
+		Stats.OverBudget = Requests.Num() - MaxImpacts;
+		Requests.SetNum(MaxImpacts, EAllowShrinking::No);
+	}
+
+	return Stats;
+}
+
+void UHitImpactSubsystem::FlushImpacts()
+{
+	COMBAT_SCOPE(STAT_CombatImpactFlush);
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	GatherViewLocations(ViewLocations);
+
+	const int32 NumQueued = PendingImpacts.Num();
+	const FHitImpactPlanStats Stats = PlanImpacts(PendingImpacts, ViewLocations, HitImpact::CullDistance, HitImpact::MaxPerFrame);
+
+	INC_DWORD_STAT_BY(STAT_CombatImpactsMerged, Stats.Merged);
+	INC_DWORD_STAT_BY(STAT_CombatImpactsCulled, Stats.Culled + Stats.OverBudget);
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Impact: %d queued, %d merged, %d culled, %d over budget, %d played"),
+		NumQueued, Stats.Merged, Stats.Culled, Stats.OverBudget, PendingImpacts.Num());
+
+	for (const FHitImpactRequest& Request : PendingImpacts)
+	{
+		PlayImpact(Request);
+	}
+	PendingImpacts.Reset();
+}
+
+void UHitImpactSubsystem::GatherViewLocations(TArray<FVector, TInlineAllocator<4>>& OutViewLocations) const
+{
+	const UWorld* World = GetWorld();
+	if (!World) return;
+
+	//분할 화면을 포함한 로컬 플레이어 시점
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController()) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutViewLocations.Add(ViewLocation);
+	}
+}
+#pragma endregion
+
+#pragma region "Pooling"
+void UHitImpactSubsystem::PlayImpact(const FHitImpactRequest& Request)
+{
+	const UHitImpactTable* Table = Request.Table.Get();
+	const FHitImpactEffect* Impact = Table ? Table->FindImpact(Request.DamageType, Request.Surface) : nullptr;
+	if (!Impact) return;
+
+	//렌더링/오디오가 없는 프로세스(-nullrhi, -nosound)는 계획까지만
+	if (Impact->Effect && FApp::CanEverRender())
+	{
+		if (UNiagaraComponent* Component = AcquireEffectComponent())
+		{
+			if (Component->GetAsset() != Impact->Effect)
+			{
+				Component->SetAsset(Impact->Effect);
+			}
+			Component->SetWorldLocationAndRotation(Request.Location, Request.Normal.Rotation());
+			Component->SetWorldScale3D(FVector(Impact->EffectScale));
+			Component->Activate(true);
+		}
+	}
+
+	if (Impact->Sound && FApp::CanEverRenderAudio())
+	{
+		if (UAudioComponent* Component = AcquireAudioComponent())
+		{
+			Component->SetSound(Impact->Sound);
+			Component->SetWorldLocation(Request.Location);
+			Component->Play();
+		}
+	}
+
+	INC_DWORD_STAT(STAT_CombatImpactsPlayed);
+}
+
+UNiagaraComponent* UHitImpactSubsystem::AcquireEffectComponent()
+{
+	for (int32 Index = 0; Index < EffectPool.Num(); ++Index)
+	{
+		UNiagaraComponent* Component = EffectPool[Index];
+		if (Component && !Component->IsActive())
+		{
+			EffectStartTimes[Index] = GetWorld()->GetTimeSeconds();
+			return Component;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	if (EffectPool.Num() < FMath::Max(HitImpact::PoolSize, 1))
+	{
+		UNiagaraComponent* Component = NewObject<UNiagaraComponent>(World);
+		Component->bAutoActivate = false;
+		Component->SetAutoDestroy(false);
+		Component->RegisterComponentWithWorld(World);
+		EffectPool.Add(Component);
+		EffectStartTimes.Add(World->GetTimeSeconds());
+
+		INC_DWORD_STAT(STAT_CombatImpactPoolAllocations);
+		return Component;
+	}
+
+	//모두 재생 중이면 가장 먼저 시작한 것을 재시작
+	const int32 OldestIndex = StartOldestPoolEntry(EffectStartTimes, World->GetTimeSeconds());
+	return EffectPool.IsValidIndex(OldestIndex) ? EffectPool[OldestIndex].Get() : nullptr;
+}
+
+UAudioComponent* UHitImpactSubsystem::AcquireAudioComponent()
+{
+	for (int32 Index = 0; Index < AudioPool.Num(); ++Index)
+	{
+		UAudioComponent* Component = AudioPool[Index];
+		if (Component && !Component->IsPlaying())
+		{
+			AudioStartTimes[Index] = GetWorld()->GetTimeSeconds();
+			return Component;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	if (AudioPool.Num() < FMath::Max(HitImpact::PoolSize, 1))
+	{
+		UAudioComponent* Component = NewObject<UAudioComponent>(World);
+		Component->bAutoActivate = false;
+		Component->bAutoDestroy = false;
+		Component->bAllowSpatialization = true;
+		Component->RegisterComponentWithWorld(World);
+		AudioPool.Add(Component);
+		AudioStartTimes.Add(World->GetTimeSeconds());
+
+		INC_DWORD_STAT(STAT_CombatImpactPoolAllocations);
+		return Component;
+	}
+
+	const int32 OldestIndex = StartOldestPoolEntry(AudioStartTimes, World->GetTimeSeconds());
+	return AudioPool.IsValidIndex(OldestIndex) ? AudioPool[OldestIndex].Get() : nullptr;
+}
+
+int32 UHitImpactSubsystem::StartOldestPoolEntry(TArray<double>& StartTimes, double Now)
+{
+	int32 OldestIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < StartTimes.Num(); ++Index)
+	{
+		if (OldestIndex == INDEX_NONE || StartTimes[Index] < StartTimes[OldestIndex])
+		{
+			OldestIndex = Index;
+		}
+	}
+
+	if (OldestIndex != INDEX_NONE)
+	{
+		StartTimes[OldestIndex] = Now;
+	}
+	return OldestIndex;
+}
+#pragma endregion
+
+#if WITH_DEV_AUTOMATION_TESTS
+//렌더링 없이 계획 단계(병합, 컬링, 상한)와 풀 재사용 순서 검증
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHitImpactPlanTest, "ActionPractice.HitDetection.HitImpactPlan",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHitImpactPlanTest::RunTest(const FString& Parameters)
+{
+	auto MakeRequest = [](const AActor* Target, const FVector& Location, float Damage)
+	{
+		FHitImpactRequest Request;
+		Request.Target = Target;
+		Request.Location = Location;
+		Request.Damage = Damage;
+		return Request;
+	};
+
+	//병합 키로만 쓰므로 서로 다른 클래스 기본 객체를 대상으로 사용
+	const AActor* TargetA = GetDefault<AActor>();
+	const AActor* TargetB = GetDefault<APlayerController>();
+	const FVector Views[] = { FVector::ZeroVector, FVector(3000.0f, 0.0f, 0.0f) };
+
+	//병합: 같은 대상은 데미지가 가장 큰 히트 하나, 대상이 없는 히트는 각각 유지
+	{
+		TArray<FHitImpactRequest> Requests;
+		Requests.Add(MakeRequest(TargetA, FVector(100.0f, 0.0f, 0.0f), 10.0f));
+		Requests.Add(MakeRequest(TargetB, FVector(200.0f, 0.0f, 0.0f), 5.0f));
+		Requests.Add(MakeRequest(TargetA, FVector(110.0f, 0.0f, 0.0f), 30.0f));
+		Requests.Add(MakeRequest(nullptr, FVector(300.0f, 0.0f, 0.0f), 1.0f));
+		Requests.Add(MakeRequest(TargetA, FVector(120.0f, 0.0f, 0.0f), 20.0f));
+		Requests.Add(MakeRequest(nullptr, FVector(400.0f, 0.0f, 0.0f), 1.0f));
+
+		const FHitImpactPlanStats Stats = UHitImpactSubsystem::PlanImpacts(Requests, MakeArrayView(Views, 1), 0.0f, 0);
+
+		TestEqual(TEXT("Merge: merged"), Stats.Merged, 2);
+		TestEqual(TEXT("Merge: culled"), Stats.Culled, 0);
+		TestEqual(TEXT("Merge: kept"), Requests.Num(), 4);
+		if (Requests.Num() == 4)
+		{
+			TestTrue(TEXT("Merge: first slot keeps target A"), Requests[0].Target.Get() == TargetA);
+			TestEqual(TEXT("Merge: target A keeps the largest damage"), Requests[0].Damage, 30.0f);
+			TestTrue(TEXT("Merge: target B unchanged"), Requests[1].Target.Get() == TargetB);
+		}
+	}
+
+	//컬링: 가장 가까운 뷰 기준, 뷰가 없으면 전부 컬링
+	{
+		TArray<FHitImpactRequest> Requests;
+		Requests.Add(MakeRequest(nullptr, FVector(500.0f, 0.0f, 0.0f), 1.0f));
+		Requests.Add(MakeRequest(nullptr, FVector(1500.0f, 0.0f, 0.0f), 1.0f));
+		Requests.Add(MakeRequest(nullptr, FVector(2500.0f, 0.0f, 0.0f), 1.0f));
+
+		TArray<FHitImpactRequest> NoViewRequests = Requests;
+
+		const FHitImpactPlanStats Stats = UHitImpactSubsystem::PlanImpacts(Requests, Views, 1000.0f, 0);
+
+		TestEqual(TEXT("Cull: culled"), Stats.Culled, 1);
+		TestEqual(TEXT("Cull: kept"), Requests.Num(), 2);
+		for (const FHitImpactRequest& Request : Requests)
+		{
+			TestEqual(TEXT("Cull: distance to the nearest view"), Request.ViewDistanceSq, 500.0f * 500.0f, 1.0f);
+		}
+
+		const FHitImpactPlanStats NoViewStats = UHitImpactSubsystem::PlanImpacts(NoViewRequests, TConstArrayView<FVector>(), 1000.0f, 0);
+		TestEqual(TEXT("Cull: no view culls all"), NoViewStats.Culled, 3);
+		TestEqual(TEXT("Cull: no view keeps none"), NoViewRequests.Num(), 0);
+	}
+
+	//상한: 가까운 순으로 MaxImpacts개만 유지
+	{
+		TArray<FHitImpactRequest> Requests;
+		for (const float Distance : { 400.0f, 100.0f, 300.0f, 500.0f, 200.0f })
+		{
+			Requests.Add(MakeRequest(nullptr, FVector(Distance, 0.0f, 0.0f), 1.0f));
+		}
+
+		const FHitImpactPlanStats Stats = UHitImpactSubsystem::PlanImpacts(Requests, MakeArrayView(Views, 1), 0.0f, 3);
+
+		TestEqual(TEXT("Budget: over budget"), Stats.OverBudget, 2);
+		TestEqual(TEXT("Budget: kept"), Requests.Num(), 3);
+		if (Requests.Num() == 3)
+		{
+			TestEqual(TEXT("Budget: nearest first"), Requests[0].Location.X, 100.0);
+			TestEqual(TEXT("Budget: second nearest"), Requests[1].Location.X, 200.0);
+			TestEqual(TEXT("Budget: third nearest"), Requests[2].Location.X, 300.0);
+		}
+	}
+
+	//풀 재사용: 가장 먼저 시작한 항목을 재시작
+	{
+		TArray<double> StartTimes = { 5.0, 2.0, 8.0 };
+
+		TestEqual(TEXT("Pool: oldest first"), UHitImpactSubsystem::StartOldestPoolEntry(StartTimes, 10.0), 1);
+		TestEqual(TEXT("Pool: restarted time"), StartTimes[1], 10.0);
+		TestEqual(TEXT("Pool: next oldest"), UHitImpactSubsystem::StartOldestPoolEntry(StartTimes, 11.0), 0);
+		TestEqual(TEXT("Pool: then the last untouched"), UHitImpactSubsystem::StartOldestPoolEntry(StartTimes, 12.0), 2);
+
+		TArray<double> EmptyTimes;
+		TestEqual(TEXT("Pool: empty"), UHitImpactSubsystem::StartOldestPoolEntry(EmptyTimes, 1.0), static_cast<int32>(INDEX_NONE));
+	}
+
+	return true;
+}
+#endif
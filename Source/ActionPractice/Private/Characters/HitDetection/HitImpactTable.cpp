@@ -0,0 +1,27 @@
+#include "Characters/HitDetection/HitImpactTable.h"
+
+const FHitImpactEffect* UHitImpactTable::FindImpact(EAttackDamageType DamageType, EPhysicalSurface Surface) const
+{
+	//정확히 맞는 항목일수록 높은 점수, 와일드카드가 아닌 키가 다르면 제외
+	const FHitImpactEntry* Best = nullptr;
+	int32 BestScore = -1;
+
+	for (const FHitImpactEntry& Entry : Entries)
+	{
+		const bool bAnyType = Entry.DamageType == EAttackDamageType::None;
+		const bool bAnySurface = Entry.Surface == SurfaceType_Default;
+
+		if (!bAnyType && Entry.DamageType != DamageType) continue;
+		if (!bAnySurface && Entry.Surface != Surface) continue;
+
+		const int32 Score = (bAnyType ? 0 : 2) + (bAnySurface ? 0 : 1);
+		if (Score > BestScore)
+		{
+			Best = &Entry;
+			BestScore = Score;
+		}
+	}
+
+	const FHitImpactEffect* Impact = Best ? &Best->Impact : &DefaultImpact;
+	return Impact->IsEmpty() ? nullptr : Impact;
+}
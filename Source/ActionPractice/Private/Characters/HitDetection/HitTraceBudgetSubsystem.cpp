@@ -0,0 +1,292 @@
+#include "Characters/HitDetection/HitTraceBudgetSubsystem.h"
+#include "Characters/HitDetection/AttackTraceComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace HitTraceBudget
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.HitDetection.Budget.Enable"),
+		bEnabled,
+		TEXT("Cap weapon trace sweeps per frame, degrading and deferring low-priority attacks first."));
+
+	static int32 MaxSweepsPerFrame = 48;
+	static FAutoConsoleVariableRef CVarMaxSweepsPerFrame(
+		TEXT("ap.HitDetection.Budget.MaxSweeps"),
+		MaxSweepsPerFrame,
+		TEXT("Maximum weapon trace sweeps per frame. 0 disables the sweep cap."));
+
+	static float MaxMsPerFrame = 0.0f;
+	static FAutoConsoleVariableRef CVarMaxMsPerFrame(
+		TEXT("ap.HitDetection.Budget.MaxMs"),
+		MaxMsPerFrame,
+		TEXT("Maximum game thread milliseconds per frame spent in weapon traces. 0 disables the time cap."));
+
+	static float MaxDeferSeconds = 0.1f;
+	static FAutoConsoleVariableRef CVarMaxDeferSeconds(
+		TEXT("ap.HitDetection.Budget.MaxDefer"),
+		MaxDeferSeconds,
+		TEXT("A deferred trace is forced once this many seconds have accumulated, regardless of budget."));
+
+	static float ThreatRadius = 600.0f;
+	static FAutoConsoleVariableRef CVarThreatRadius(
+		TEXT("ap.HitDetection.Budget.ThreatRadius"),
+		ThreatRadius,
+		TEXT("Attacks closer than this to a player are treated as able to hit the player and prioritized."));
+}
+
+#pragma region "Subsystem Functions"
+bool UHitTraceBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHitTraceBudgetSubsystem::Deinitialize()
+{
+	for (const FHitTraceBudgetEntry& Entry : Entries)
+	{
+		if (UAttackTraceComponent* Component = Entry.Component.Get())
+		{
+			Component->SetBudgetTierCap(MAX_int32);
+		}
+	}
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHitTraceBudgetSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && Entries.Num() > 0;
+}
+
+TStatId UHitTraceBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHitTraceBudgetSubsystem, STATGROUP_Tickables);
+}
+
+void UHitTraceBudgetSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//월드 Tick 이후 호출, 이번 프레임 사용량으로 스윕 비용 갱신 후 다음 프레임 계획
+	if (SweepsThisFrame > 0)
+	{
+		const double MsPerSweep = TraceSecondsThisFrame * 1000.0 / SweepsThisFrame;
+		AverageMsPerSweep = AverageMsPerSweep > 0.0 ? FMath::Lerp(AverageMsPerSweep, MsPerSweep, 0.1) : MsPerSweep;
+	}
+	SweepsLastFrame = SweepsThisFrame;
+	SweepsThisFrame = 0;
+	TraceSecondsThisFrame = 0.0;
+
+	UpdatePriorities();
+	PlanBudget(DeltaTime);
+}
+
+FHitTraceBudgetEntry* UHitTraceBudgetSubsystem::FindEntry(const UAttackTraceComponent* Component)
+{
+	return Entries.FindByPredicate([Component](const FHitTraceBudgetEntry& Entry) { return Entry.Component.Get() == Component; });
+}
+
+void UHitTraceBudgetSubsystem::RegisterTracer(UAttackTraceComponent* Component, const AActor* Attacker)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	UHitTraceBudgetSubsystem* Subsystem = World ? World->GetSubsystem<UHitTraceBudgetSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	FHitTraceBudgetEntry* Entry = Subsystem->FindEntry(Component);
+	if (!Entry)
+	{
+		Entry = &Subsystem->Entries.AddDefaulted_GetRef();
+		Entry->Component = Component;
+	}
+	Entry->Attacker = Attacker ? Attacker : Component->GetOwner();
+
+	//첫 계획 전까지는 제한 없음
+	Entry->bProtected = true;
+	Component->SetBudgetTierCap(MAX_int32);
+}
+
+void UHitTraceBudgetSubsystem::UnregisterTracer(UAttackTraceComponent* Component)
+{
+	if (!Component) return;
+
+	Component->SetBudgetTierCap(MAX_int32);
+
+	UWorld* World = Component->GetWorld();
+	if (UHitTraceBudgetSubsystem* Subsystem = World ? World->GetSubsystem<UHitTraceBudgetSubsystem>() : nullptr)
+	{
+		Subsystem->Entries.RemoveAllSwap([Component](const FHitTraceBudgetEntry& Entry) { return Entry.Component.Get() == Component; });
+	}
+}
+#pragma endregion
+
+#pragma region "Budget Functions"
+void UHitTraceBudgetSubsystem::UpdatePriorities()
+{
+	UWorld* World = GetWorld();
+
+	//로컬 플레이어가 있으면 로컬 기준, 데디케이티드 서버는 가장 가까운 플레이어 기준
+	TArray<const APawn*, TInlineAllocator<8>> PlayerPawns;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn) continue;
+
+		if (PlayerController->IsLocalController())
+		{
+			PlayerPawns.Reset();
+			PlayerPawns.Add(Pawn);
+			break;
+		}
+		PlayerPawns.Add(Pawn);
+	}
+
+	const float ThreatRadiusSquared = FMath::Square(HitTraceBudget::ThreatRadius);
+
+	Entries.RemoveAllSwap([](const FHitTraceBudgetEntry& Entry) { return !Entry.Component.IsValid(); });
+	for (FHitTraceBudgetEntry& Entry : Entries)
+	{
+		const AActor* Attacker = Entry.Attacker.Get();
+		const APawn* AttackerPawn = Cast<APawn>(Attacker);
+
+		//플레이어 본인 공격은 항상 최우선
+		if (AttackerPawn && AttackerPawn->IsPlayerControlled())
+		{
+			Entry.bThreat = true;
+			Entry.DistanceToPlayer = 0.0f;
+			continue;
+		}
+
+		float MinDistanceSquared = UE_BIG_NUMBER;
+		if (Attacker)
+		{
+			for (const APawn* Pawn : PlayerPawns)
+			{
+				MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared(Pawn->GetActorLocation(), Attacker->GetActorLocation())));
+			}
+		}
+
+		Entry.bThreat = MinDistanceSquared <= ThreatRadiusSquared;
+		Entry.DistanceToPlayer = FMath::Sqrt(MinDistanceSquared);
+	}
+
+	Entries.Sort([](const FHitTraceBudgetEntry& A, const FHitTraceBudgetEntry& B)
+	{
+		if (A.bThreat != B.bThreat) return A.bThreat;
+		return A.DistanceToPlayer < B.DistanceToPlayer;
+	});
+}
+
+int32 UHitTraceBudgetSubsystem::GetEffectiveMaxSweeps() const
+{
+	int32 MaxSweeps = HitTraceBudget::MaxSweepsPerFrame > 0 ? HitTraceBudget::MaxSweepsPerFrame : MAX_int32;
+
+	//ms 예산은 측정된 스윕당 비용으로 스윕 수로 환산
+	if (HitTraceBudget::MaxMsPerFrame > 0.0f && AverageMsPerSweep > 0.0)
+	{
+		MaxSweeps = FMath::Min(MaxSweeps, FMath::Max(1, FMath::FloorToInt(HitTraceBudget::MaxMsPerFrame / AverageMsPerSweep)));
+	}
+	return MaxSweeps;
+}
+
+void UHitTraceBudgetSubsystem::PlanBudget(float DeltaTime)
+{
+	if (!HitTraceBudget::bEnabled)
+	{
+		for (FHitTraceBudgetEntry& Entry : Entries)
+		{
+			Entry.bProtected = true;
+			Entry.Component->SetBudgetTierCap(MAX_int32);
+		}
+		return;
+	}
+
+	//우선순위 순서로 원하는 단계의 예상 비용을 배분, 남은 예산에 맞을 때까지 단계를 낮춤
+	float RemainingSweeps = static_cast<float>(GetEffectiveMaxSweeps());
+	for (FHitTraceBudgetEntry& Entry : Entries)
+	{
+		UAttackTraceComponent* Component = Entry.Component.Get();
+
+		const int32 DesiredTier = Component->GetDesiredAdaptiveTier();
+		int32 Tier = DesiredTier;
+		float Cost = Component->EstimateSweepsPerFrame(Tier, DeltaTime);
+		while (Tier > 0 && Cost > RemainingSweeps)
+		{
+			--Tier;
+			Cost = Component->EstimateSweepsPerFrame(Tier, DeltaTime);
+		}
+
+		Entry.bProtected = Cost <= RemainingSweeps;
+		Component->SetBudgetTierCap(Tier < DesiredTier ? Tier : MAX_int32);
+		RemainingSweeps = FMath::Max(0.0f, RemainingSweeps - Cost);
+
+		if (Tier < DesiredTier)
+		{
+			INC_DWORD_STAT(STAT_CombatBudgetDegraded);
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("Budget: %s tier %d -> %d (distance %.0f, threat %d)"),
+				*GetNameSafe(Entry.Attacker.Get()), DesiredTier, Tier, Entry.DistanceToPlayer, Entry.bThreat ? 1 : 0);
+		}
+	}
+}
+
+bool UHitTraceBudgetSubsystem::TryConsume(UAttackTraceComponent* Component, float AccumulatedSeconds)
+{
+	if (!HitTraceBudget::bEnabled || !Component) return true;
+
+	UWorld* World = Component->GetWorld();
+	UHitTraceBudgetSubsystem* Subsystem = World ? World->GetSubsystem<UHitTraceBudgetSubsystem>() : nullptr;
+	if (!Subsystem) return true;
+
+	const int32 NumSweeps = Component->EstimateSweepsPerTrace();
+	const bool bOverBudget = Subsystem->SweepsThisFrame + NumSweeps > Subsystem->GetEffectiveMaxSweeps()
+		|| (HitTraceBudget::MaxMsPerFrame > 0.0f && Subsystem->TraceSecondsThisFrame * 1000.0 >= HitTraceBudget::MaxMsPerFrame);
+
+	if (bOverBudget)
+	{
+		const FHitTraceBudgetEntry* Entry = Subsystem->FindEntry(Component);
+		const bool bProtected = !Entry || Entry->bProtected;
+
+		//계획 밖 항목은 지연, 너무 오래 밀리면 예산과 무관하게 실행
+		if (!bProtected && AccumulatedSeconds < HitTraceBudget::MaxDeferSeconds)
+		{
+			INC_DWORD_STAT(STAT_CombatBudgetDeferred);
+			return false;
+		}
+
+		INC_DWORD_STAT(STAT_CombatBudgetOverrun);
+	}
+
+	return true;
+}
+
+void UHitTraceBudgetSubsystem::ReportTraceTime(UAttackTraceComponent* Component, int32 NumSweeps, double Seconds)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	if (UHitTraceBudgetSubsystem* Subsystem = World ? World->GetSubsystem<UHitTraceBudgetSubsystem>() : nullptr)
+	{
+		Subsystem->SweepsThisFrame += NumSweeps;
+		Subsystem->TraceSecondsThisFrame += Seconds;
+	}
+}
+
+float UHitTraceBudgetSubsystem::GetSweepLoad(const UWorld* World)
+{
+	const UHitTraceBudgetSubsystem* Subsystem = World ? World->GetSubsystem<UHitTraceBudgetSubsystem>() : nullptr;
+	if (!HitTraceBudget::bEnabled || !Subsystem) return 0.0f;
+
+	const int32 MaxSweeps = Subsystem->GetEffectiveMaxSweeps();
+	if (MaxSweeps == MAX_int32) return 0.0f;
+
+	//트레이스 중인 공격이 없으면 Tick이 멈추므로 마지막 기록이 남아 있을 수 있음
+	if (Subsystem->Entries.Num() == 0) return 0.0f;
+
+	return static_cast<float>(Subsystem->SweepsLastFrame) / MaxSweeps;
+}
+#pragma endregion
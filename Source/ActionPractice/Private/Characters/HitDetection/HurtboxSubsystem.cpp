@@ -0,0 +1,401 @@
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "Characters/HitDetection/HurtboxSetDataAsset.h"
+#include "Characters/BaseCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "VisualLogger/VisualLogger.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace HurtboxQuery
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.HitDetection.Hurtbox.Enable"),
+		bEnabled,
+		TEXT("Test weapon traces against per-bone hurtbox capsules for characters that have a hurtbox set."));
+
+	static bool bPhysicsSweep = false;
+	static FAutoConsoleVariableRef CVarPhysicsSweep(
+		TEXT("ap.HitDetection.Hurtbox.PhysicsSweep"),
+		bPhysicsSweep,
+		TEXT("Also sweep the physics scene for targets without a hurtbox set. Off by default so hurtbox targets cost no scene query; enable when weapons must hit actors that have no hurtbox set."));
+
+	//SoA 스트림 순서 (각 스트림은 4의 배수 길이)
+	enum EStream : int32 { P2X, P2Y, P2Z, D2X, D2Y, D2Z, RAD, NumStreams };
+
+	static constexpr float Epsilon = 1.e-6f;
+
+	//무기 선분(P1 + s*D1) 하나와 피격 캡슐 선분(P2 + t*D2) 4개의 최근접 거리 제곱 (Real-Time Collision Detection 5.1.9)
+	//평행한 경우 s = 0, 피격 캡슐 t가 구간 밖이면 클램프 후 s 재계산
+	static FORCEINLINE VectorRegister4Float SegmentSegmentDistSq4(
+		const VectorRegister4Float& P1X, const VectorRegister4Float& P1Y, const VectorRegister4Float& P1Z,
+		const VectorRegister4Float& D1X, const VectorRegister4Float& D1Y, const VectorRegister4Float& D1Z,
+		const VectorRegister4Float& A, const float* const* Streams, int32 Offset,
+		VectorRegister4Float& OutS, VectorRegister4Float& OutT)
+	{
+		const VectorRegister4Float Zero = GlobalVectorConstants::FloatZero;
+		const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+		const VectorRegister4Float Eps = VectorSetFloat1(Epsilon);
+
+		const VectorRegister4Float P2X = VectorLoad(Streams[EStream::P2X] + Offset);
+		const VectorRegister4Float P2Y = VectorLoad(Streams[EStream::P2Y] + Offset);
+		const VectorRegister4Float P2Z = VectorLoad(Streams[EStream::P2Z] + Offset);
+		const VectorRegister4Float D2X = VectorLoad(Streams[EStream::D2X] + Offset);
+		const VectorRegister4Float D2Y = VectorLoad(Streams[EStream::D2Y] + Offset);
+		const VectorRegister4Float D2Z = VectorLoad(Streams[EStream::D2Z] + Offset);
+
+		//R = P1 - P2
+		const VectorRegister4Float RX = VectorSubtract(P1X, P2X);
+		const VectorRegister4Float RY = VectorSubtract(P1Y, P2Y);
+		const VectorRegister4Float RZ = VectorSubtract(P1Z, P2Z);
+
+		const VectorRegister4Float E = VectorMax(VectorMultiplyAdd(D2X, D2X, VectorMultiplyAdd(D2Y, D2Y, VectorMultiply(D2Z, D2Z))), Eps);
+		const VectorRegister4Float F = VectorMultiplyAdd(D2X, RX, VectorMultiplyAdd(D2Y, RY, VectorMultiply(D2Z, RZ)));
+		const VectorRegister4Float C = VectorMultiplyAdd(D1X, RX, VectorMultiplyAdd(D1Y, RY, VectorMultiply(D1Z, RZ)));
+		const VectorRegister4Float B = VectorMultiplyAdd(D1X, D2X, VectorMultiplyAdd(D1Y, D2Y, VectorMultiply(D1Z, D2Z)));
+
+		//S = clamp((B*F - C*E) / (A*E - B*B)), 평행이면 0
+		const VectorRegister4Float Denom = VectorSubtract(VectorMultiply(A, E), VectorMultiply(B, B));
+		const VectorRegister4Float SNumer = VectorSubtract(VectorMultiply(B, F), VectorMultiply(C, E));
+		const VectorRegister4Float SRaw = VectorDivide(SNumer, VectorMax(Denom, Eps));
+		VectorRegister4Float S = VectorSelect(VectorCompareGT(Denom, Eps), VectorMin(VectorMax(SRaw, Zero), One), Zero);
+
+		//T = (B*S + F) / E, 구간 밖이면 클램프 후 S = clamp((B*T - C) / A)
+		const VectorRegister4Float TRaw = VectorDivide(VectorMultiplyAdd(B, S, F), E);
+		const VectorRegister4Float T = VectorMin(VectorMax(TRaw, Zero), One);
+		const VectorRegister4Float OutOfRange = VectorBitwiseOr(VectorCompareLT(TRaw, Zero), VectorCompareGT(TRaw, One));
+		const VectorRegister4Float SAlt = VectorMin(VectorMax(VectorDivide(VectorSubtract(VectorMultiply(B, T), C), A), Zero), One);
+		S = VectorSelect(OutOfRange, SAlt, S);
+
+		//|R + D1*S - D2*T|^2
+		const VectorRegister4Float DX = VectorSubtract(VectorMultiplyAdd(D1X, S, RX), VectorMultiply(D2X, T));
+		const VectorRegister4Float DY = VectorSubtract(VectorMultiplyAdd(D1Y, S, RY), VectorMultiply(D2Y, T));
+		const VectorRegister4Float DZ = VectorSubtract(VectorMultiplyAdd(D1Z, S, RZ), VectorMultiply(D2Z, T));
+
+		OutS = S;
+		OutT = T;
+		return VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+	}
+}
+
+#pragma region "Subsystem Functions"
+bool UHurtboxSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHurtboxSubsystem::Deinitialize()
+{
+	Runtimes.Empty();
+
+	Super::Deinitialize();
+}
+
+void UHurtboxSubsystem::RegisterCharacter(ABaseCharacter* Character)
+{
+	const UHurtboxSetDataAsset* HurtboxSet = Character ? Character->GetHurtboxSet() : nullptr;
+	if (!HurtboxSet || HurtboxSet->Capsules.Num() == 0) return;
+
+	UWorld* World = Character->GetWorld();
+	UHurtboxSubsystem* Subsystem = World ? World->GetSubsystem<UHurtboxSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	FHurtboxRuntime& Runtime = Subsystem->Runtimes.FindOrAdd(Character);
+	Runtime.Character = Character;
+	Runtime.HurtboxSet = HurtboxSet;
+	Runtime.CachedMesh.Reset();
+	Runtime.CachedFrame = MAX_uint64;
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Registered hurtboxes: %s (%d capsules)"), *Character->GetName(), HurtboxSet->Capsules.Num());
+}
+
+void UHurtboxSubsystem::UnregisterCharacter(ABaseCharacter* Character)
+{
+	UWorld* World = Character ? Character->GetWorld() : nullptr;
+	if (UHurtboxSubsystem* Subsystem = World ? World->GetSubsystem<UHurtboxSubsystem>() : nullptr)
+	{
+		Subsystem->Runtimes.Remove(Character);
+	}
+}
+
+bool UHurtboxSubsystem::IsEnabled()
+{
+	return HurtboxQuery::bEnabled;
+}
+
+bool UHurtboxSubsystem::ShouldSweepPhysics()
+{
+	return !HurtboxQuery::bEnabled || HurtboxQuery::bPhysicsSweep;
+}
+
+bool UHurtboxSubsystem::IsHurtboxActor(const AActor* Actor) const
+{
+	return Actor && Runtimes.Contains(Actor);
+}
+
+bool UHurtboxSubsystem::CaptureActorSpaceCapsules(const ABaseCharacter* Character, FHurtboxPoints& OutStarts, FHurtboxPoints& OutEnds)
+{
+	OutStarts.Reset();
+	OutEnds.Reset();
+
+	FHurtboxRuntime* Runtime = Runtimes.Find(Character);
+	const USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	if (!Runtime || !Mesh) return false;
+
+	//같은 프레임 앞선 판정이 애니메이션 전 포즈를 캐시했을 수 있으므로 최종 포즈로 다시 계산
+	Runtime->CachedFrame = MAX_uint64;
+	if (!RefreshRuntime(*Runtime)) return false;
+
+	const FTransform MeshToActor = Mesh->GetComponentTransform().GetRelativeTransform(Character->GetActorTransform());
+	for (int32 i = 0; i < Runtime->ComponentStarts.Num(); ++i)
+	{
+		OutStarts.Add(MeshToActor.TransformPosition(Runtime->ComponentStarts[i]));
+		OutEnds.Add(MeshToActor.TransformPosition(Runtime->ComponentEnds[i]));
+	}
+	return true;
+}
+
+void UHurtboxSubsystem::SetRewoundPose(const ABaseCharacter* Character, const FTransform& ActorTransform, const FHurtboxPoints& ActorSpaceStarts, const FHurtboxPoints& ActorSpaceEnds)
+{
+	if (FHurtboxRuntime* Runtime = Runtimes.Find(Character))
+	{
+		Runtime->RewoundActorTransform = ActorTransform;
+		Runtime->RewoundStarts = ActorSpaceStarts;
+		Runtime->RewoundEnds = ActorSpaceEnds;
+	}
+}
+
+void UHurtboxSubsystem::ClearRewoundPoses()
+{
+	for (TPair<FObjectKey, FHurtboxRuntime>& Pair : Runtimes)
+	{
+		Pair.Value.RewoundActorTransform.Reset();
+		Pair.Value.RewoundStarts.Reset();
+		Pair.Value.RewoundEnds.Reset();
+	}
+}
+#pragma endregion
+
+#pragma region "Query Functions"
+bool UHurtboxSubsystem::RefreshRuntime(FHurtboxRuntime& Runtime) const
+{
+	if (Runtime.CachedFrame == GFrameCounter)
+	{
+		return Runtime.ComponentStarts.Num() > 0;
+	}
+
+	const ABaseCharacter* Character = Runtime.Character.Get();
+	const UHurtboxSetDataAsset* HurtboxSet = Runtime.HurtboxSet.Get();
+	const USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+	const USkeletalMesh* MeshAsset = Mesh ? Mesh->GetSkeletalMeshAsset() : nullptr;
+	if (!HurtboxSet || !MeshAsset)
+	{
+		return false;
+	}
+
+	const TArray<FHurtboxCapsule>& Capsules = HurtboxSet->Capsules;
+
+	//메시가 바뀐 경우에만 본 이름 조회
+	if (Runtime.CachedMesh.Get() != MeshAsset || Runtime.BoneIndices.Num() != Capsules.Num())
+	{
+		Runtime.BoneIndices.Reset();
+		for (const FHurtboxCapsule& Capsule : Capsules)
+		{
+			const int32 BoneIndex = Mesh->GetBoneIndex(Capsule.BoneName);
+			if (BoneIndex == INDEX_NONE)
+			{
+				AP_DEBUG_LOG(LogAPHitDetection, TEXT("Hurtbox bone %s not found on %s"), *Capsule.BoneName.ToString(), *GetNameSafe(MeshAsset));
+			}
+			Runtime.BoneIndices.Add(BoneIndex);
+		}
+		Runtime.CachedMesh = MeshAsset;
+	}
+
+	Runtime.ComponentStarts.SetNumUninitialized(Capsules.Num(), EAllowShrinking::No);
+	Runtime.ComponentEnds.SetNumUninitialized(Capsules.Num(), EAllowShrinking::No);
+	for (int32 i = 0; i < Capsules.Num(); ++i)
+	{
+		//본이 없는 캡슐은 QueryCapsule에서 패딩 레인으로 처리
+		const int32 BoneIndex = Runtime.BoneIndices[i];
+		if (BoneIndex == INDEX_NONE)
+		{
+			Runtime.ComponentStarts[i] = FVector::ZeroVector;
+			Runtime.ComponentEnds[i] = FVector::ZeroVector;
+			continue;
+		}
+
+		const FTransform BoneTransform = Mesh->GetBoneTransform(BoneIndex, FTransform::Identity);
+		Runtime.ComponentStarts[i] = BoneTransform.TransformPosition(Capsules[i].Start);
+		Runtime.ComponentEnds[i] = BoneTransform.TransformPosition(Capsules[i].End);
+	}
+
+	Runtime.CachedFrame = GFrameCounter;
+	return Capsules.Num() > 0;
+}
+
+int32 UHurtboxSubsystem::QueryCapsule(const FVector& Start, const FVector& End, float Radius, ECollisionChannel Channel, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits)
+{
+	using namespace HurtboxQuery;
+
+	if (Runtimes.Num() == 0) return 0;
+
+	COMBAT_SCOPE(STAT_CombatHurtboxQuery);
+	++FCombatQueryCounters::HurtboxQueries;
+
+	//무기 선분은 float로 한 번만 복제 (캐릭터 주변 좌표 범위에서는 float 정밀도로 충분)
+	const FVector3f P1(Start);
+	const FVector3f D1(End - Start);
+	const VectorRegister4Float P1X = VectorSetFloat1(P1.X);
+	const VectorRegister4Float P1Y = VectorSetFloat1(P1.Y);
+	const VectorRegister4Float P1Z = VectorSetFloat1(P1.Z);
+	const VectorRegister4Float D1X = VectorSetFloat1(D1.X);
+	const VectorRegister4Float D1Y = VectorSetFloat1(D1.Y);
+	const VectorRegister4Float D1Z = VectorSetFloat1(D1.Z);
+	const VectorRegister4Float A = VectorSetFloat1(FMath::Max(D1.SizeSquared(), Epsilon));
+
+	int32 NumAdded = 0;
+	for (TPair<FObjectKey, FHurtboxRuntime>& Pair : Runtimes)
+	{
+		FHurtboxRuntime& Runtime = Pair.Value;
+		ABaseCharacter* Character = Runtime.Character.Get();
+		if (!Character || Params.GetIgnoredActors().Contains(Character->GetUniqueID())) continue;
+
+		//물리 스윕과 같은 조건: 메시 콜리전이 꺼져 있거나 채널을 무시하면 판정 제외 (사망, 래그돌 전환 등)
+		USkeletalMeshComponent* Mesh = Character->GetMesh();
+		if (!Mesh || !Mesh->IsCollisionEnabled() || Mesh->GetCollisionResponseToChannel(Channel) == ECR_Ignore) continue;
+
+		//되감기 중이면 메시 트랜스폼과 바운드를 과거 액터 트랜스폼 기준으로 옮겨서 판정
+		FTransform ComponentTransform = Mesh->GetComponentTransform();
+		FVector BoundsOrigin = Mesh->Bounds.Origin;
+		if (Runtime.RewoundActorTransform.IsSet())
+		{
+			const FTransform& ActorTransform = Character->GetActorTransform();
+			ComponentTransform = ComponentTransform.GetRelativeTransform(ActorTransform) * Runtime.RewoundActorTransform.GetValue();
+			BoundsOrigin = Runtime.RewoundActorTransform->TransformPosition(ActorTransform.InverseTransformPosition(BoundsOrigin));
+		}
+
+		//1차: 메시 바운드 구체와 무기 캡슐 거리
+		if (FMath::PointDistToSegmentSquared(BoundsOrigin, Start, End) > FMath::Square(Mesh->Bounds.SphereRadius + Radius)) continue;
+
+		if (!RefreshRuntime(Runtime)) continue;
+
+		//월드 공간 SoA 구성, 남는 레인은 멀리 떨어진 반경 0 캡슐로 채움
+		const TArray<FHurtboxCapsule>& Capsules = Runtime.HurtboxSet->Capsules;
+		const int32 NumCapsules = Runtime.ComponentStarts.Num();
+
+		//되감기 중 기록된 과거 포즈가 있으면 그 캡슐 사용 (메시가 바뀌어 개수가 다르면 현재 포즈)
+		const bool bRewoundPose = Runtime.RewoundActorTransform.IsSet()
+			&& Runtime.RewoundStarts.Num() == NumCapsules && Runtime.RewoundEnds.Num() == NumCapsules;
+		const int32 NumPadded = Align(NumCapsules, 4);
+		SoAScratch.SetNumUninitialized(NumPadded * EStream::NumStreams, EAllowShrinking::No);
+
+		float* Streams[EStream::NumStreams];
+		for (int32 Stream = 0; Stream < EStream::NumStreams; ++Stream)
+		{
+			Streams[Stream] = SoAScratch.GetData() + Stream * NumPadded;
+		}
+
+		for (int32 i = 0; i < NumPadded; ++i)
+		{
+			FVector3f P2(UE_BIG_NUMBER, UE_BIG_NUMBER, UE_BIG_NUMBER);
+			FVector3f D2(1.0f, 0.0f, 0.0f);
+			float CapsuleRadius = 0.0f;
+			if (i < NumCapsules && Runtime.BoneIndices[i] != INDEX_NONE)
+			{
+				const FVector WorldStart = bRewoundPose
+					? Runtime.RewoundActorTransform->TransformPosition(Runtime.RewoundStarts[i])
+					: ComponentTransform.TransformPosition(Runtime.ComponentStarts[i]);
+				const FVector WorldEnd = bRewoundPose
+					? Runtime.RewoundActorTransform->TransformPosition(Runtime.RewoundEnds[i])
+					: ComponentTransform.TransformPosition(Runtime.ComponentEnds[i]);
+				P2 = FVector3f(WorldStart);
+				D2 = FVector3f(WorldEnd - WorldStart);
+				CapsuleRadius = Capsules[i].Radius * ComponentTransform.GetMaximumAxisScale();
+			}
+
+			Streams[EStream::P2X][i] = P2.X;
+			Streams[EStream::P2Y][i] = P2.Y;
+			Streams[EStream::P2Z][i] = P2.Z;
+			Streams[EStream::D2X][i] = D2.X;
+			Streams[EStream::D2Y][i] = D2.Y;
+			Streams[EStream::D2Z][i] = D2.Z;
+			Streams[EStream::RAD][i] = CapsuleRadius;
+		}
+
+		//2차: 4개씩 선분-선분 거리, 액터당 가장 깊이 겹친 캡슐 선택
+		int32 BestIndex = INDEX_NONE;
+		float BestPenetration = -UE_BIG_NUMBER;
+		float BestS = 0.0f;
+		float BestT = 0.0f;
+
+		for (int32 Offset = 0; Offset < NumPadded; Offset += 4)
+		{
+			VectorRegister4Float S, T;
+			const VectorRegister4Float DistSq = SegmentSegmentDistSq4(P1X, P1Y, P1Z, D1X, D1Y, D1Z, A, Streams, Offset, S, T);
+
+			const VectorRegister4Float RadiusSum = VectorAdd(VectorLoad(Streams[EStream::RAD] + Offset), VectorSetFloat1(Radius));
+			const int32 HitMask = VectorMaskBits(VectorCompareLE(DistSq, VectorMultiply(RadiusSum, RadiusSum)));
+			INC_DWORD_STAT_BY(STAT_CombatHurtboxTests, FMath::Min(4, NumCapsules - Offset));
+			if (HitMask == 0) continue;
+
+			alignas(16) float DistSqLanes[4], SLanes[4], TLanes[4];
+			VectorStoreAligned(DistSq, DistSqLanes);
+			VectorStoreAligned(S, SLanes);
+			VectorStoreAligned(T, TLanes);
+
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				if (!(HitMask & (1 << Lane))) continue;
+
+				const int32 Index = Offset + Lane;
+				const float Penetration = Streams[EStream::RAD][Index] + Radius - FMath::Sqrt(DistSqLanes[Lane]);
+				if (Penetration > BestPenetration)
+				{
+					BestPenetration = Penetration;
+					BestIndex = Index;
+					BestS = SLanes[Lane];
+					BestT = TLanes[Lane];
+				}
+			}
+		}
+
+		if (BestIndex == INDEX_NONE) continue;
+
+		//무기 선분 위 최근접점과 피격 캡슐 표면점으로 히트 결과 구성
+		const FVector HurtboxStart(Streams[EStream::P2X][BestIndex], Streams[EStream::P2Y][BestIndex], Streams[EStream::P2Z][BestIndex]);
+		const FVector HurtboxAxis(Streams[EStream::D2X][BestIndex], Streams[EStream::D2Y][BestIndex], Streams[EStream::D2Z][BestIndex]);
+		const FVector WeaponPoint = Start + (End - Start) * BestS;
+		const FVector HurtboxPoint = HurtboxStart + HurtboxAxis * BestT;
+
+		FVector Normal = (WeaponPoint - HurtboxPoint).GetSafeNormal();
+		if (Normal.IsNearlyZero())
+		{
+			Normal = -(End - Start).GetSafeNormal();
+		}
+
+		FHitResult& Hit = OutHits.Emplace_GetRef(Character, Mesh, WeaponPoint, Normal);
+		Hit.ImpactPoint = HurtboxPoint + Normal * Streams[EStream::RAD][BestIndex];
+		Hit.TraceStart = Start;
+		Hit.TraceEnd = End;
+		Hit.Time = BestS;
+		Hit.Distance = FMath::Max(0.0f, -BestPenetration);
+		Hit.PenetrationDepth = FMath::Max(0.0f, BestPenetration);
+		Hit.BoneName = Capsules[BestIndex].BoneName;
+		Hit.Item = BestIndex;
+		++NumAdded;
+
+		UE_VLOG_CAPSULE(Character, LogAPHitDetection, Log,
+			HurtboxStart - HurtboxAxis.GetSafeNormal() * Streams[EStream::RAD][BestIndex],
+			HurtboxAxis.Size() * 0.5f + Streams[EStream::RAD][BestIndex],
+			Streams[EStream::RAD][BestIndex],
+			FQuat::FindBetweenNormals(FVector::UpVector, HurtboxAxis.GetSafeNormal()),
+			FColor::Red,
+			TEXT("Hurtbox %s (x%.2f)"), *Hit.BoneName.ToString(), Capsules[BestIndex].DamageMultiplier);
+	}
+
+	return NumAdded;
+}
+#pragma endregion
@@ -0,0 +1,388 @@
+#include "Characters/HitDetection/LagCompensationSubsystem.h"
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "Characters/BaseCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace LagCompensation
+{
+	static bool bEnabled = true;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("ap.LagComp.Enable"),
+		bEnabled,
+		TEXT("Rewind victims to the attacker's view time before server-side weapon traces."));
+
+	static float MaxHistorySeconds = 0.4f;
+	static FAutoConsoleVariableRef CVarMaxHistory(
+		TEXT("ap.LagComp.MaxHistory"),
+		MaxHistorySeconds,
+		TEXT("Maximum rewind in seconds. History length is sized from this when a character registers."));
+
+	static float RecordInterval = 1.0f / 60.0f;
+	static FAutoConsoleVariableRef CVarRecordInterval(
+		TEXT("ap.LagComp.RecordInterval"),
+		RecordInterval,
+		TEXT("Minimum seconds between hurtbox snapshots. Applied when a character registers."));
+
+	static float InterpDelay = 0.0f;
+	static FAutoConsoleVariableRef CVarInterpDelay(
+		TEXT("ap.LagComp.InterpDelay"),
+		InterpDelay,
+		TEXT("Extra seconds of client-side smoothing delay added to the round trip time."));
+
+	static int32 MaxRewindsPerFrame = 16;
+	static FAutoConsoleVariableRef CVarMaxRewindsPerFrame(
+		TEXT("ap.LagComp.MaxRewindsPerFrame"),
+		MaxRewindsPerFrame,
+		TEXT("Maximum number of victim rewinds per frame. Remaining victims are traced at their current position."));
+
+#if !UE_BUILD_SHIPPING
+	static bool bDrawDebug = false;
+	static FAutoConsoleVariableRef CVarDrawDebug(
+		TEXT("ap.LagComp.Debug"),
+		bDrawDebug,
+		TEXT("Draw current (red) and rewound (green) capsules for each rewind."));
+#endif
+
+	static int32 GetHistoryCapacity()
+	{
+		return FMath::CeilToInt(MaxHistorySeconds / FMath::Max(RecordInterval, 0.001f)) + 2;
+	}
+}
+
+#pragma region "Hurtbox History"
+FHurtboxSnapshot& FHurtboxHistory::Record()
+{
+	check(Samples.Num() > 0);
+
+	FHurtboxSnapshot& Snapshot = Samples[Head];
+	Head = (Head + 1) % Samples.Num();
+	Count = FMath::Min(Count + 1, Samples.Num());
+	return Snapshot;
+}
+
+bool FHurtboxHistory::Sample(double Time, FHurtboxSnapshot& OutSnapshot) const
+{
+	if (Count == 0) return false;
+
+	const FHurtboxSnapshot& Oldest = Get(0);
+	const FHurtboxSnapshot& Newest = Get(Count - 1);
+
+	if (Time <= Oldest.Time)
+	{
+		OutSnapshot = Oldest;
+		return true;
+	}
+
+	if (Time >= Newest.Time)
+	{
+		OutSnapshot = Newest;
+		return true;
+	}
+
+	//Time보다 늦은 첫 샘플 이진 탐색
+	int32 Low = 1;
+	int32 High = Count - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (Get(Mid).Time > Time) High = Mid;
+		else Low = Mid + 1;
+	}
+
+	const FHurtboxSnapshot& Before = Get(Low - 1);
+	const FHurtboxSnapshot& After = Get(Low);
+	const double Span = After.Time - Before.Time;
+	const float Alpha = Span > UE_SMALL_NUMBER ? static_cast<float>((Time - Before.Time) / Span) : 1.0f;
+
+	OutSnapshot.Time = Time;
+	OutSnapshot.Location = FMath::Lerp(Before.Location, After.Location, Alpha);
+	OutSnapshot.Rotation = FQuat::Slerp(Before.Rotation, After.Rotation, Alpha);
+
+	//캡슐 끝점 보간, 두 샘플 사이에 메시가 바뀌었으면 가까운 샘플 사용
+	const int32 NumCapsules = Before.CapsuleStarts.Num();
+	if (NumCapsules == After.CapsuleStarts.Num())
+	{
+		OutSnapshot.CapsuleStarts.SetNumUninitialized(NumCapsules, EAllowShrinking::No);
+		OutSnapshot.CapsuleEnds.SetNumUninitialized(NumCapsules, EAllowShrinking::No);
+		for (int32 i = 0; i < NumCapsules; ++i)
+		{
+			OutSnapshot.CapsuleStarts[i] = FMath::Lerp(Before.CapsuleStarts[i], After.CapsuleStarts[i], Alpha);
+			OutSnapshot.CapsuleEnds[i] = FMath::Lerp(Before.CapsuleEnds[i], After.CapsuleEnds[i], Alpha);
+		}
+	}
+	else
+	{
+		const FHurtboxSnapshot& Nearest = Alpha < 0.5f ? Before : After;
+		OutSnapshot.CapsuleStarts = Nearest.CapsuleStarts;
+		OutSnapshot.CapsuleEnds = Nearest.CapsuleEnds;
+	}
+	return true;
+}
+#pragma endregion
+
+#pragma region "Subsystem Functions"
+bool ULagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void ULagCompensationSubsystem::Deinitialize()
+{
+	Restore();
+	Histories.Empty();
+
+	Super::Deinitialize();
+}
+
+bool ULagCompensationSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && Histories.Num() > 0;
+}
+
+TStatId ULagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+void ULagCompensationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//월드 Tick 이후 호출되므로 이번 프레임 최종 위치/포즈를 기록, 핑과 같은 실제 시간 기준
+	RewindsThisFrame = 0;
+	RecordSnapshots(GetWorld()->GetRealTimeSeconds());
+}
+
+void ULagCompensationSubsystem::RecordSnapshots(double Now)
+{
+	if (LastRecordTime >= 0.0 && Now - LastRecordTime < LagCompensation::RecordInterval - UE_KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+	LastRecordTime = Now;
+
+	UHurtboxSubsystem* HurtboxSubsystem = UHurtboxSubsystem::IsEnabled() ? GetWorld()->GetSubsystem<UHurtboxSubsystem>() : nullptr;
+
+	for (auto It = Histories.CreateIterator(); It; ++It)
+	{
+		FHurtboxHistory& History = It.Value();
+		const ABaseCharacter* Character = History.Character.Get();
+		if (!IsValid(Character))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (History.Samples.Num() == 0) continue;
+
+		FHurtboxSnapshot& Snapshot = History.Record();
+		Snapshot.Time = Now;
+		Snapshot.Location = Character->GetActorLocation();
+		Snapshot.Rotation = Character->GetActorQuat();
+		if (!HurtboxSubsystem || !HurtboxSubsystem->CaptureActorSpaceCapsules(Character, Snapshot.CapsuleStarts, Snapshot.CapsuleEnds))
+		{
+			Snapshot.CapsuleStarts.Reset();
+			Snapshot.CapsuleEnds.Reset();
+		}
+	}
+}
+
+void ULagCompensationSubsystem::RegisterCharacter(ABaseCharacter* Character)
+{
+	if (!Character || !Character->HasAuthority()) return;
+
+	UWorld* World = Character->GetWorld();
+	if (!World || World->GetNetMode() == NM_Standalone) return;
+
+	ULagCompensationSubsystem* Subsystem = World->GetSubsystem<ULagCompensationSubsystem>();
+	if (!Subsystem) return;
+
+	FHurtboxHistory& History = Subsystem->Histories.FindOrAdd(Character);
+	History.Character = Character;
+	History.Samples.SetNum(LagCompensation::GetHistoryCapacity());
+	History.Head = 0;
+	History.Count = 0;
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Registered %s (%d samples)"), *Character->GetName(), History.Samples.Num());
+}
+
+void ULagCompensationSubsystem::UnregisterCharacter(ABaseCharacter* Character)
+{
+	UWorld* World = Character ? Character->GetWorld() : nullptr;
+	if (ULagCompensationSubsystem* Subsystem = World ? World->GetSubsystem<ULagCompensationSubsystem>() : nullptr)
+	{
+		Subsystem->Histories.Remove(Character);
+	}
+}
+#pragma endregion
+
+#pragma region "Rewind Functions"
+float ULagCompensationSubsystem::GetRewindSeconds(const ABaseCharacter* Attacker) const
+{
+	if (!LagCompensation::bEnabled || !Attacker) return 0.0f;
+
+	//서버가 권한을 가진 AI, 리슨 서버 호스트는 보상 불필요
+	const APlayerController* PlayerController = Attacker->GetController<APlayerController>();
+	if (!PlayerController || PlayerController->IsLocalController()) return 0.0f;
+
+	const APlayerState* PlayerState = PlayerController->PlayerState;
+	if (!PlayerState) return 0.0f;
+
+	//클라이언트가 본 피격자 = 서버 기준 RTT + 보간 지연만큼 과거
+	const float RewindSeconds = PlayerState->GetPingInMilliseconds() * 0.001f + LagCompensation::InterpDelay;
+	return FMath::Clamp(RewindSeconds, 0.0f, LagCompensation::MaxHistorySeconds);
+}
+
+int32 ULagCompensationSubsystem::Rewind(const ABaseCharacter* Attacker, double Time, const FVector& Center, float Radius)
+{
+	const float RadiusSquared = FMath::Square(Radius);
+	int32 NumRewound = 0;
+
+	UHurtboxSubsystem* HurtboxSubsystem = GetWorld()->GetSubsystem<UHurtboxSubsystem>();
+
+	for (const TPair<TObjectKey<ABaseCharacter>, FHurtboxHistory>& Pair : Histories)
+	{
+		ABaseCharacter* Victim = Pair.Value.Character.Get();
+		if (!IsValid(Victim) || Victim == Attacker) continue;
+
+		if (RewindsThisFrame >= LagCompensation::MaxRewindsPerFrame)
+		{
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("Rewind budget exhausted (%d)"), LagCompensation::MaxRewindsPerFrame);
+			break;
+		}
+
+		FHurtboxSnapshot Snapshot;
+		if (!Pair.Value.Sample(Time, Snapshot)) continue;
+
+		//현재 위치와 되감은 위치 중 하나라도 범위 안이면 대상
+		const FVector CurrentLocation = Victim->GetActorLocation();
+		if (FVector::DistSquared(CurrentLocation, Center) > RadiusSquared
+			&& FVector::DistSquared(Snapshot.Location, Center) > RadiusSquared)
+		{
+			continue;
+		}
+
+#if !UE_BUILD_SHIPPING
+		if (LagCompensation::bDrawDebug)
+		{
+			if (const UCapsuleComponent* Capsule = Victim->GetCapsuleComponent())
+			{
+				const float HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+				const float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+				DrawDebugCapsule(GetWorld(), CurrentLocation, HalfHeight, CapsuleRadius, Victim->GetActorQuat(), FColor::Red, false, 2.0f);
+				DrawDebugCapsule(GetWorld(), Snapshot.Location, HalfHeight, CapsuleRadius, Snapshot.Rotation, FColor::Green, false, 2.0f);
+			}
+		}
+#endif
+
+		const FTransform& CurrentTransform = Victim->GetActorTransform();
+		const FTransform RewoundTransform(Snapshot.Rotation, Snapshot.Location, CurrentTransform.GetScale3D());
+
+		if (HurtboxSubsystem && HurtboxSubsystem->IsHurtboxActor(Victim))
+		{
+			HurtboxSubsystem->SetRewoundPose(Victim, RewoundTransform, Snapshot.CapsuleStarts, Snapshot.CapsuleEnds);
+			bHurtboxesRewound = true;
+		}
+
+		if (UHurtboxSubsystem::ShouldSweepPhysics())
+		{
+			RewindBodies(Victim, CurrentTransform, RewoundTransform);
+		}
+
+		++RewindsThisFrame;
+		++NumRewound;
+	}
+
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("Rewind %s: %d victims, %.3f s"), *GetNameSafe(Attacker), NumRewound, GetWorld()->GetRealTimeSeconds() - Time);
+	return NumRewound;
+}
+
+void ULagCompensationSubsystem::RewindBodies(ABaseCharacter* Victim, const FTransform& CurrentTransform, const FTransform& RewoundTransform)
+{
+	//컴포넌트 트랜스폼은 그대로 두고 물리 씬의 바디만 텔레포트, UpdateOverlaps가 호출되지 않음
+	auto RewindBody = [&](UPrimitiveComponent* Primitive, FBodyInstance* Body)
+	{
+		if (!Body || !Body->IsValidBodyInstance()) return;
+
+		const FTransform Original = Body->GetUnrealWorldTransform();
+		RewoundBodies.Add({ Primitive, Body, Original });
+		Body->SetBodyTransform(Original.GetRelativeTransform(CurrentTransform) * RewoundTransform, ETeleportType::TeleportPhysics);
+	};
+
+	Victim->ForEachComponent<UPrimitiveComponent>(false, [&](UPrimitiveComponent* Primitive)
+	{
+		if (!Primitive->IsQueryCollisionEnabled()) return;
+
+		if (USkeletalMeshComponent* SkeletalMesh = Cast<USkeletalMeshComponent>(Primitive))
+		{
+			for (FBodyInstance* Body : SkeletalMesh->Bodies)
+			{
+				RewindBody(Primitive, Body);
+			}
+		}
+		else
+		{
+			RewindBody(Primitive, Primitive->GetBodyInstance());
+		}
+	});
+}
+
+void ULagCompensationSubsystem::Restore()
+{
+	//역순 복원, 스코프 중 파괴된 컴포넌트의 바디는 건너뜀
+	for (int32 Index = RewoundBodies.Num() - 1; Index >= 0; --Index)
+	{
+		const FRewoundBody& Rewound = RewoundBodies[Index];
+		if (Rewound.Component.IsValid() && Rewound.Body->IsValidBodyInstance())
+		{
+			Rewound.Body->SetBodyTransform(Rewound.Original, ETeleportType::TeleportPhysics);
+		}
+	}
+	RewoundBodies.Reset();
+
+	if (bHurtboxesRewound)
+	{
+		if (UHurtboxSubsystem* HurtboxSubsystem = GetWorld()->GetSubsystem<UHurtboxSubsystem>())
+		{
+			HurtboxSubsystem->ClearRewoundPoses();
+		}
+		bHurtboxesRewound = false;
+	}
+}
+#pragma endregion
+
+#pragma region "Scoped Lag Compensation"
+FScopedLagCompensation::FScopedLagCompensation(const ABaseCharacter* Attacker, float Radius)
+{
+	if (!LagCompensation::bEnabled || !Attacker || !Attacker->HasAuthority()) return;
+
+	UWorld* World = Attacker->GetWorld();
+	ULagCompensationSubsystem* LagCompensationSubsystem = World ? World->GetSubsystem<ULagCompensationSubsystem>() : nullptr;
+	if (!LagCompensationSubsystem) return;
+
+	const float RewindSeconds = LagCompensationSubsystem->GetRewindSeconds(Attacker);
+	if (RewindSeconds <= 0.0f) return;
+
+	//핑은 실제 시간이므로 월드 시간 배율(슬로우 모션 등)과 무관하게 실제 시간 기록에서 되감음
+	if (LagCompensationSubsystem->Rewind(Attacker, World->GetRealTimeSeconds() - RewindSeconds, Attacker->GetActorLocation(), Radius) > 0)
+	{
+		Subsystem = LagCompensationSubsystem;
+	}
+}
+
+FScopedLagCompensation::~FScopedLagCompensation()
+{
+	if (Subsystem)
+	{
+		Subsystem->Restore();
+	}
+}
+#pragma endregion
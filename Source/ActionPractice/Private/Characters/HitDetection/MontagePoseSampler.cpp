@@ -0,0 +1,128 @@
+#include "Characters/HitDetection/MontagePoseSampler.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequence.h"
+#include "Animation/Skeleton.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Games/ActionPracticeLog.h"
+
+bool FMontagePoseSampler::Initialize(const UAnimMontage* InMontage, const USkeletalMeshComponent* Mesh)
+{
+	Reset();
+
+	const USkeletalMesh* InMeshAsset = Mesh ? Mesh->GetSkeletalMeshAsset() : nullptr;
+	if (!InMontage || !InMeshAsset || !InMeshAsset->GetSkeleton() || InMontage->SlotAnimTracks.Num() == 0)
+	{
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("MontagePoseSampler: cannot sample %s"), *GetNameSafe(InMontage));
+		return false;
+	}
+
+	Montage = InMontage;
+	MeshAsset = InMeshAsset;
+	bLockRoot = InMontage->HasRootMotion();
+	return true;
+}
+
+void FMontagePoseSampler::Reset()
+{
+	Montage.Reset();
+	MeshAsset.Reset();
+	bLockRoot = false;
+
+	CachedTime = -1.0f;
+	CachedSequence.Reset();
+	CachedComponentSpace.Reset();
+
+	TrackMapSequence.Reset();
+	AnimatedSkeletonBones.Empty();
+}
+
+bool FMontagePoseSampler::ResolveSequence(float Time)
+{
+	if (Time == CachedTime)
+	{
+		return CachedSequence.IsValid();
+	}
+
+	CachedTime = Time;
+	CachedSequence.Reset();
+	CachedComponentSpace.Reset();
+
+	//몽타주 시간 -> 세그먼트의 시퀀스 시간 (세그먼트 재생 속도/루프 반영)
+	const FAnimTrack& Track = Montage->SlotAnimTracks[0].AnimTrack;
+	const FAnimSegment* Segment = Track.GetSegmentAtTime(Time);
+	if (!Segment) return false;
+
+	float AnimTime = 0.0f;
+	const UAnimSequence* Sequence = Cast<UAnimSequence>(Segment->GetAnimationData(Time, AnimTime));
+	if (!Sequence) return false;
+
+	CachedSequence = Sequence;
+	CachedAnimTime = AnimTime;
+
+	//트랙이 없는 본은 레퍼런스 포즈 사용
+	if (TrackMapSequence.Get() != Sequence)
+	{
+		const FReferenceSkeleton& SkeletonRef = MeshAsset->GetSkeleton()->GetReferenceSkeleton();
+		AnimatedSkeletonBones.Init(false, SkeletonRef.GetNum());
+		for (const FTrackToSkeletonMap& TrackMap : Sequence->GetCompressedTrackToSkeletonMapTable())
+		{
+			if (AnimatedSkeletonBones.IsValidIndex(TrackMap.BoneTreeIndex))
+			{
+				AnimatedSkeletonBones[TrackMap.BoneTreeIndex] = true;
+			}
+		}
+		TrackMapSequence = Sequence;
+	}
+
+	return true;
+}
+
+FTransform FMontagePoseSampler::GetLocalTransform(int32 BoneIndex)
+{
+	const FReferenceSkeleton& RefSkeleton = MeshAsset->GetRefSkeleton();
+
+	//루트 모션은 액터 이동으로 반영되므로 루트 본 고정
+	if (BoneIndex == 0 && bLockRoot)
+	{
+		return RefSkeleton.GetRefBonePose()[0];
+	}
+
+	const int32 SkeletonBoneIndex = MeshAsset->GetSkeleton()->GetReferenceSkeleton().FindBoneIndex(RefSkeleton.GetBoneName(BoneIndex));
+	if (!AnimatedSkeletonBones.IsValidIndex(SkeletonBoneIndex) || !AnimatedSkeletonBones[SkeletonBoneIndex])
+	{
+		return RefSkeleton.GetRefBonePose()[BoneIndex];
+	}
+
+	FTransform LocalTransform;
+	CachedSequence->GetBoneTransform(LocalTransform, FSkeletonPoseBoneIndex(SkeletonBoneIndex), FAnimExtractContext(static_cast<double>(CachedAnimTime)), false);
+	return LocalTransform;
+}
+
+bool FMontagePoseSampler::GetComponentSpaceTransform(int32 BoneIndex, float Time, FTransform& OutTransform)
+{
+	if (!IsValid() || !ResolveSequence(Time)) return false;
+
+	if (const FTransform* Cached = CachedComponentSpace.Find(BoneIndex))
+	{
+		OutTransform = *Cached;
+		return true;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = MeshAsset->GetRefSkeleton();
+	if (!RefSkeleton.IsValidIndex(BoneIndex)) return false;
+
+	FTransform Result = GetLocalTransform(BoneIndex);
+
+	const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+	if (ParentIndex != INDEX_NONE)
+	{
+		FTransform ParentTransform;
+		if (!GetComponentSpaceTransform(ParentIndex, Time, ParentTransform)) return false;
+		Result = Result * ParentTransform;
+	}
+
+	CachedComponentSpace.Add(BoneIndex, Result);
+	OutTransform = Result;
+	return true;
+}
@@ -9,15 +9,7 @@
 #include "Characters/ActionPracticeCharacter.h"
 #include "AbilitySystemComponent.h"
 #include "Components/InputComponent.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogWeaponAttackTraceComponent, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogWeaponAttackTraceComponent, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UWeaponAttackComponent::UWeaponAttackComponent()
 {
@@ -28,7 +20,7 @@ void UWeaponAttackComponent::BeginPlay()
 	OwnerWeapon = Cast<AWeapon>(GetOwner());
 	if (!OwnerWeapon)
 	{
-		DEBUG_LOG(TEXT("WeaponCollisionComponent: Owner is not a weapon!"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("WeaponCollisionComponent: Owner is not a weapon!"));
 		return;
 	}
 
@@ -70,18 +62,18 @@ UAbilitySystemComponent* UWeaponAttackComponent::GetOwnerASC() const
 #pragma region "Trace Config Functions"
 bool UWeaponAttackComponent::LoadTraceConfig(const FGameplayTagContainer& AttackTags, int32 ComboIndex)
 {
-	DEBUG_LOG(TEXT("LoadTraceConfig - START, ComboIndex: %d"), ComboIndex);
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - START, ComboIndex: %d"), ComboIndex);
 
 	if (!OwnerWeapon)
 	{
-		DEBUG_LOG(TEXT("LoadTraceConfig - FAILED: No OwnerWeapon"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - FAILED: No OwnerWeapon"));
 		return false;
 	}
 
 	const UWeaponDataAsset* WeaponData = OwnerWeapon->GetWeaponData();
 	if (!WeaponData)
 	{
-		DEBUG_LOG(TEXT("LoadTraceConfig - FAILED: No WeaponData"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - FAILED: No WeaponData"));
 		return false;
 	}
 
@@ -89,7 +81,7 @@ bool UWeaponAttackComponent::LoadTraceConfig(const FGameplayTagContainer& Attack
 	const FTaggedAttackData* AttackData = OwnerWeapon->GetWeaponAttackDataByTag(AttackTags);
 	if (!AttackData || AttackData->ComboSequence.Num() == 0)
 	{
-		DEBUG_LOG(TEXT("LoadTraceConfig - FAILED: No AttackData or empty ComboSequence"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - FAILED: No AttackData or empty ComboSequence"));
 		return false;
 	}
 
@@ -97,7 +89,7 @@ bool UWeaponAttackComponent::LoadTraceConfig(const FGameplayTagContainer& Attack
 	ComboIndex = FMath::Clamp(ComboIndex, 0, AttackData->ComboSequence.Num() - 1);
 	const FAttackStats& AttackInfo = AttackData->ComboSequence[ComboIndex].AttackData;
 
-	UsingHitSocketGroups.Empty();
+	UsingHitSocketGroups.Reset();
 
 	//AttackStats의 UsingSocketConfigs에서 사용할 소켓들을 가져옴
 	for (const FAttackSocketConfig& SocketConfig : AttackInfo.UsingSocketConfigs)
@@ -110,12 +102,12 @@ bool UWeaponAttackComponent::LoadTraceConfig(const FGameplayTagContainer& Attack
 			SocketGroupConfig.TraceRadius = SocketConfig.TraceRadius;
 
 			UsingHitSocketGroups.Add(SocketConfig.SocketName, SocketGroupConfig);
-			DEBUG_LOG(TEXT("LoadTraceConfig - Added socket group: %s, SocketCount: %d, Radius: %.2f"),
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - Added socket group: %s, SocketCount: %d, Radius: %.2f"),
 				*SocketConfig.SocketName.ToString(), SocketGroupConfig.SocketCount, SocketGroupConfig.TraceRadius);
 		}
 		else
 		{
-			DEBUG_LOG(TEXT("LoadTraceConfig - Socket not found in PrebuiltSocketGroups: %s"), *SocketConfig.SocketName.ToString());
+			AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - Socket not found in PrebuiltSocketGroups: %s"), *SocketConfig.SocketName.ToString());
 		}
 	}
 
@@ -124,7 +116,7 @@ bool UWeaponAttackComponent::LoadTraceConfig(const FGameplayTagContainer& Attack
 	CurrentAttackData.PoiseDamage = AttackInfo.PoiseDamage;
 	CurrentAttackData.DamageType = AttackInfo.DamageType;
 
-	DEBUG_LOG(TEXT("LoadTraceConfig - SUCCESS: Added %d socket groups, FinalDamage: %.2f"),
+	AP_DEBUG_LOG(LogAPHitDetection, TEXT("LoadTraceConfig - SUCCESS: Added %d socket groups, FinalDamage: %.2f"),
 		UsingHitSocketGroups.Num(), CurrentAttackData.FinalDamage);
 
 	return true;
@@ -136,7 +128,7 @@ void UWeaponAttackComponent::SetOwnerMesh()
 
 	if (!OwnerMesh)
 	{
-		DEBUG_LOG(TEXT("WeaponCollisionComponent: No Weapon StaticMesh"));
+		AP_DEBUG_LOG(LogAPHitDetection, TEXT("WeaponCollisionComponent: No Weapon StaticMesh"));
 		return;
 	}
 }
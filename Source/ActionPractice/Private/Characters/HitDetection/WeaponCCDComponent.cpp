@@ -2,20 +2,18 @@
 #include "Items/Weapon.h"
 #include "Items/WeaponDataAsset.h"
 #include "Characters/ActionPracticeCharacter.h"
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "Characters/HitDetection/HurtboxSetDataAsset.h"
+#include "Notifies/NotifyEventSubsystem.h"
 #include "AbilitySystemComponent.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/StaticMeshComponent.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogWeaponCCDComponent, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogWeaponCCDComponent, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/CombatStats.h"
+#include "Games/TickAuditSubsystem.h"
+#include "VisualLogger/VisualLogger.h"
+#include "Games/ActionPracticeLog.h"
 
 UWeaponCCDComponent::UWeaponCCDComponent()
 {
@@ -35,12 +33,16 @@ void UWeaponCCDComponent::BeginPlay()
     SetCollisionResponseToAllChannels(ECR_Ignore);
     SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
     SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
-    
+
+    HurtboxSubsystem = GetWorld()->GetSubsystem<UHurtboxSubsystem>();
+
+    //같은 프레임의 HitDetectionStart/End 이벤트를 받은 뒤 판정
+    UNotifyEventSubsystem::AddDispatchPrerequisite(this, PrimaryComponentTick);
     
     OwnerWeapon = Cast<AWeapon>(GetOwner());
     if (!OwnerWeapon)
     {
-        DEBUG_LOG(TEXT("WeaponCCDComponent: Owner is not a weapon!"));
+        AP_DEBUG_LOG(LogAPHitDetection, TEXT("WeaponCCDComponent: Owner is not a weapon!"));
         return;
     }
 
@@ -95,7 +97,7 @@ void UWeaponCCDComponent::BeginPlay()
     // 고정 크기로 캡슐 설정
     SetCapsuleSize(DefaultCapsuleRadius, DefaultCapsuleHalfHeight);
     
-    DEBUG_LOG(TEXT("WeaponCCD initialized - Radius: %.2f (fixed), HalfHeight: %.2f"), 
+    AP_DEBUG_LOG(LogAPHitDetection, TEXT("WeaponCCD initialized - Radius: %.2f (fixed), HalfHeight: %.2f"), 
               DefaultCapsuleRadius, DefaultCapsuleHalfHeight);
     
     Super::BeginPlay();
@@ -105,10 +107,36 @@ void UWeaponCCDComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
+    //판정 구간 밖에서는 디버그 위치 갱신만 하므로 Tick이 꺼져 있어야 함
+    if (!bIsDetecting)
+    {
+        UTickAuditSubsystem::ReportIdleTick(this);
+    }
+    
     if (bIsDetecting && bDrawDebugCapsule)
     {
         DrawDebugCCDTrajectory();
     }
+
+    //Visual Logger 기록 (녹화 중일 때만 평가), 캡슐은 바닥 기준
+    if (bIsDetecting)
+    {
+        UE_VLOG_CAPSULE(GetVisualLogOwner(), LogAPHitDetection, Log,
+            GetComponentLocation() - GetComponentQuat().GetAxisZ() * GetScaledCapsuleHalfHeight(),
+            GetScaledCapsuleHalfHeight(), GetScaledCapsuleRadius(), GetComponentQuat(), DebugCCDColor, TEXT("CCD"));
+        UE_VLOG_SEGMENT(GetVisualLogOwner(), LogAPHitDetection, Log,
+            PreviousCapsuleLocation, GetComponentLocation(), FColor::Yellow, TEXT(""));
+    }
+    
+    //캡슐 끝 속도, 백엔드 선택 시 다음 공격의 속도 추정에 사용
+    //스윕 백엔드와 같은 월드 시간 단위 (액터 CustomTimeDilation 제외)
+    const float WorldDeltaSeconds = GetWorld()->GetDeltaSeconds();
+    if (bIsDetecting && WorldDeltaSeconds > KINDA_SMALL_NUMBER)
+    {
+        const FVector TipLocation = GetTipLocation();
+        PeakTipSpeed = FMath::Max(PeakTipSpeed, static_cast<float>(FVector::Dist(TipLocation, PreviousTipLocation)) / WorldDeltaSeconds);
+        PreviousTipLocation = TipLocation;
+    }
     
     //위치 업데이트 (디버그용)
     PreviousCapsuleLocation = GetComponentLocation();
@@ -119,10 +147,11 @@ void UWeaponCCDComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 void UWeaponCCDComponent::PrepareHitDetection(const FGameplayTagContainer& AttackTags, const int32 ComboIndex)
 {
     CurrentComboIndex = ComboIndex;
+    PeakTipSpeed = 0.0f;
     
     if (!LoadAttackConfig(AttackTags, ComboIndex))
     {
-        DEBUG_LOG(TEXT("Failed to load attack config for tag container"));
+        AP_DEBUG_LOG(LogAPHitDetection, TEXT("Failed to load attack config for tag container"));
         return;
     }
     
@@ -131,7 +160,7 @@ void UWeaponCCDComponent::PrepareHitDetection(const FGameplayTagContainer& Attac
     
     bIsPrepared = true;
     
-    DEBUG_LOG(TEXT("PrepareHitDetection - Attack Tags Count: %d, Combo: %d"), 
+    AP_DEBUG_LOG(LogAPHitDetection, TEXT("PrepareHitDetection - Attack Tags Count: %d, Combo: %d"), 
               AttackTags.Num(), ComboIndex);
 }
 
@@ -139,7 +168,7 @@ void UWeaponCCDComponent::HandleHitDetectionStart(const FGameplayEventData& Payl
 {
     if (!bIsPrepared)
     {
-        DEBUG_LOG(TEXT("HitDetectionStart - Not Prepared"));
+        AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetectionStart - Not Prepared"));
         return;
     }
     
@@ -151,8 +180,9 @@ void UWeaponCCDComponent::HandleHitDetectionStart(const FGameplayEventData& Payl
     //초기 위치 저장
     PreviousCapsuleLocation = GetComponentLocation();
     PreviousCapsuleRotation = GetComponentQuat();
+    PreviousTipLocation = GetTipLocation();
     
-    DEBUG_LOG(TEXT("HitDetection Started - CCD Active"));
+    AP_DEBUG_LOG(LogAPHitDetection, TEXT("HitDetection Started - CCD Active"));
 }
 
 void UWeaponCCDComponent::HandleHitDetectionEnd(const FGameplayEventData& Payload)
@@ -165,6 +195,11 @@ void UWeaponCCDComponent::HandleHitDetectionEnd(const FGameplayEventData& Payloa
     
     UnbindEventCallbacks();
 }
+
+void UWeaponCCDComponent::CancelHitDetection()
+{
+    HandleHitDetectionEnd(FGameplayEventData());
+}
 #pragma endregion
 
 #pragma region "Event Binding"
@@ -241,15 +276,25 @@ void UWeaponCCDComponent::OnCapsuleBeginOverlap(UPrimitiveComponent* OverlappedC
 {
     if (!bIsDetecting || !OtherActor) return;
 
+    COMBAT_SCOPE(STAT_CombatHitValidation);
+
     if (ValidateHit(OtherActor))
     {
+        INC_DWORD_STAT(STAT_CombatHitsValidated);
+        UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log,
+            GetComponentLocation(), 10.0f, FColor::Green, TEXT("CCD Hit %s"), *OtherActor->GetName());
         FHitResult HitResult;
+        bool bHurtboxHit = false;
         
         if (bFromSweep)
         {
             //Sweep 결과 그대로 사용
             HitResult = SweepResult;
         }
+        else if (ResolveHurtboxHit(OtherActor, HitResult))
+        {
+            bHurtboxHit = true;
+        }
         else
         {
             //Overlap의 경우 수동으로 HitResult 구성
@@ -271,7 +316,14 @@ void UWeaponCCDComponent::OnCapsuleBeginOverlap(UPrimitiveComponent* OverlappedC
             }
         }
         
-        ProcessHit(OtherActor, HitResult);
+        ProcessHit(OtherActor, HitResult, bHurtboxHit);
+    }
+    else
+    {
+        INC_DWORD_STAT(STAT_CombatHitsRejected);
+        COMBAT_TRACE_EVENT(TEXT("HitRejected %s: CCD"), *OtherActor->GetName());
+        UE_VLOG_LOCATION(GetVisualLogOwner(), LogAPHitDetection, Log,
+            GetComponentLocation(), 6.0f, FColor::Orange, TEXT("CCD Rejected %s: Self, Invulnerable or AlreadyHit"), *OtherActor->GetName());
     }
 }
 
@@ -283,12 +335,18 @@ bool UWeaponCCDComponent::ValidateHit(AActor* HitActor)
     AActionPracticeCharacter* WeaponOwner = OwnerWeapon->GetOwnerCharacter();
     if (HitActor == OwnerWeapon || HitActor == WeaponOwner) return false;
     
-    //중복 히트 체크
-    float CurrentTime = GetWorld()->GetTimeSeconds();
+    //무적 구간이면 대미지 스펙을 만들기 전에 거부
+    const ABaseCharacter* HitCharacter = Cast<ABaseCharacter>(HitActor);
+    if (HitCharacter && HitCharacter->IsHurtboxWindowActive(EHurtboxWindow::Invulnerable))
+    {
+        COMBAT_TRACE_EVENT(TEXT("HitRejected %s: Invulnerable"), *HitActor->GetName());
+        return false;
+    }
+
+    //중복 히트 체크, 스윕 백엔드와 같이 판정 준비 당 대상별 1회
     for (const FHitRecord& Record : HitRecords)
     {
-        if (Record.HitActor == HitActor && 
-            CurrentTime - Record.HitTime < HitCooldownTime)
+        if (Record.HitActor == HitActor)
         {
             return false;
         }
@@ -297,20 +355,64 @@ bool UWeaponCCDComponent::ValidateHit(AActor* HitActor)
     return true;
 }
 
-void UWeaponCCDComponent::ProcessHit(AActor* HitActor, const FHitResult& HitResult)
+bool UWeaponCCDComponent::ResolveHurtboxHit(AActor* HitActor, FHitResult& OutHit) const
 {
+    if (!HurtboxSubsystem || !UHurtboxSubsystem::IsEnabled() || !HurtboxSubsystem->IsHurtboxActor(HitActor)) return false;
+
+    //캡슐 축 선분 + 반경으로 피격 캡슐 판정
+    const FVector Axis = GetComponentQuat().GetAxisZ() * (GetScaledCapsuleHalfHeight() - GetScaledCapsuleRadius());
+    const FVector Center = GetComponentLocation();
+
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(WeaponCCDHurtbox), false);
+    Params.AddIgnoredActor(GetOwner());
+    if (OwnerWeapon && OwnerWeapon->GetOwnerCharacter())
+    {
+        Params.AddIgnoredActor(OwnerWeapon->GetOwnerCharacter());
+    }
+
+    TArray<FHitResult> Hits;
+    HurtboxSubsystem->QueryCapsule(Center + Axis, Center - Axis, GetScaledCapsuleRadius(), GetCollisionObjectType(), Params, Hits);
+
+    for (const FHitResult& Hit : Hits)
+    {
+        if (Hit.GetActor() == HitActor)
+        {
+            OutHit = Hit;
+            return true;
+        }
+    }
+    return false;
+}
+
+FVector UWeaponCCDComponent::GetTipLocation() const
+{
+    return GetComponentLocation() + GetComponentQuat().GetAxisZ() * GetScaledCapsuleHalfHeight();
+}
+
+void UWeaponCCDComponent::ProcessHit(AActor* HitActor, const FHitResult& HitResult, bool bHurtboxHit)
+{
+    COMBAT_SCOPE(STAT_CombatProcessHit);
+
     //히트 기록
     FHitRecord NewRecord;
     NewRecord.HitActor = HitActor;
     NewRecord.HitTime = GetWorld()->GetTimeSeconds();
     HitRecords.Add(NewRecord);
+
+    //부위 배율 적용 (스윕 백엔드와 동일)
+    FFinalAttackData HitAttackData = CurrentAttackData;
+    const ABaseCharacter* HitCharacter = Cast<ABaseCharacter>(HitActor);
+    if (const UHurtboxSetDataAsset* HurtboxSet = HitCharacter ? HitCharacter->GetHurtboxSet() : nullptr)
+    {
+        HitAttackData.FinalDamage *= HurtboxSet->GetDamageMultiplier(HitResult, bHurtboxHit);
+    }
     
-    DEBUG_LOG(TEXT("CCD Hit: %s at %s"), 
+    AP_DEBUG_LOG(LogAPHitDetection, TEXT("CCD Hit: %s at %s"), 
               *HitActor->GetName(), 
               *HitResult.Location.ToString());
     
     //이벤트 브로드캐스트
-    OnWeaponHit.Broadcast(HitActor, HitResult, CurrentAttackData);
+    OnWeaponHit.Broadcast(HitActor, HitResult, HitAttackData);
 }
 
 void UWeaponCCDComponent::ResetHitActors()
@@ -366,7 +468,7 @@ void UWeaponCCDComponent::UpdateCapsuleSize(EAttackDamageType DamageType)
         break;
     }
     
-    DEBUG_LOG(TEXT("Capsule size updated for %s attack"), 
+    AP_DEBUG_LOG(LogAPHitDetection, TEXT("Capsule size updated for %s attack"), 
               *UEnum::GetValueAsString(DamageType));
 }
 #pragma endregion
@@ -378,6 +480,15 @@ void UWeaponCCDComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 }
 
 #pragma region "Debug And Profiling"
+const UObject* UWeaponCCDComponent::GetVisualLogOwner() const
+{
+    if (OwnerWeapon && OwnerWeapon->GetOwnerCharacter())
+    {
+        return OwnerWeapon->GetOwnerCharacter();
+    }
+    return GetOwner();
+}
+
 void UWeaponCCDComponent::DrawDebugCCDTrajectory()
 {
     if (!bDrawDebugCapsule) return;
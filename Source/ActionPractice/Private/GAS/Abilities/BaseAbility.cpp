@@ -5,15 +5,10 @@
 #include "GameplayEffect.h"
 #include "GAS/AbilitySystemComponent/BaseAbilitySystemComponent.h"
 #include "GAS/GameplayTagsSubsystem.h"
-
-#define ENABLE_DEBUG_LOG 1
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "GAS/Abilities/MontageAbilityInterface.h"
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
 
 UBaseAbility::UBaseAbility()
 {
@@ -30,30 +25,48 @@ void UBaseAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, con
 	EffectStaminaCostTag = UGameplayTagsSubsystem::GetEffectStaminaCostTag();
 	if (!EffectStaminaCostTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EffectStaminaCostTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EffectStaminaCostTag is Invalid"));
 	}
 
 	EffectCooldownDurationTag = UGameplayTagsSubsystem::GetEffectCooldownDurationTag();
 	if (!EffectCooldownDurationTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EffectCooldownDurationTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EffectCooldownDurationTag is Invalid"));
 	}
 }
 
+void UBaseAbility::OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	if (MontageDriver)
+	{
+		MontageDriver->ReleaseBindings();
+	}
+
+	Super::OnRemoveAbility(ActorInfo, Spec);
+}
+
 bool UBaseAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
+	COMBAT_SCOPE(STAT_CombatAbilityCanActivate);
+
 	const bool bSuperCanActivate = Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags);
 
 	if (!bSuperCanActivate)
 	{
-		DEBUG_LOG(TEXT("BaseAbility::CanActivateAbility FAILED at Super. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("BaseAbility::CanActivateAbility FAILED at Super. Ability=%s"), *GetName());
+		INC_DWORD_STAT(STAT_CombatAbilitiesFailed);
+		//실패 사유 태그 (쿨다운, 차단 태그 등)는 OptionalRelevantTags에 채워짐
+		COMBAT_TRACE_EVENT(TEXT("AbilityFailed %s: %s"), *GetClass()->GetName(),
+			OptionalRelevantTags && !OptionalRelevantTags->IsEmpty() ? *OptionalRelevantTags->ToStringSimple() : TEXT("Requirements"));
 		return false;
 	}
 
 	const bool bHasStamina = CheckStaminaCost(*ActorInfo);
 	if (!bHasStamina)
 	{
-		DEBUG_LOG(TEXT("BaseAbility::CanActivateAbility FAILED by Stamina. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("BaseAbility::CanActivateAbility FAILED by Stamina. Ability=%s"), *GetName());
+		INC_DWORD_STAT(STAT_CombatAbilitiesFailed);
+		COMBAT_TRACE_EVENT(TEXT("AbilityFailed %s: Stamina"), *GetClass()->GetName());
 		return false;
 	}
 
@@ -62,13 +75,18 @@ bool UBaseAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, c
 
 void UBaseAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	COMBAT_SCOPE(STAT_CombatAbilityActivate);
+
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
-		DEBUG_LOG(TEXT("Cannot Commit Ability"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Cannot Commit Ability"));
+		INC_DWORD_STAT(STAT_CombatAbilitiesFailed);
+		COMBAT_TRACE_EVENT(TEXT("AbilityFailed %s: Commit"), *GetClass()->GetName());
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
 
+	INC_DWORD_STAT(STAT_CombatAbilitiesActivated);
 	ActivateInitSettings();
 
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
@@ -76,6 +94,15 @@ void UBaseAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, cons
 
 void UBaseAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
+	//대기 중인 잠재 흐름의 타이머/델리게이트 해제
+	LatentFlow.Cancel();
+
+	//몽타주 콜백만 해제, 드라이버와 노티파이 바인딩은 다음 활성화에서 재사용
+	if (MontageDriver)
+	{
+		MontageDriver->Stop();
+	}
+
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
@@ -106,14 +133,14 @@ bool UBaseAbility::ApplyStaminaCost()
 	const UBaseAttributeSet* AttributeSet = GetBaseAttributeSetFromActorInfo();
 	if (!AttributeSet || AttributeSet->GetStamina() < 3.0f)
 	{
-		DEBUG_LOG(TEXT("No AttributeSet or Low Stamina"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No AttributeSet or Low Stamina"));
 		return false;
 	}
 
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!ASC || !StaminaCostEffect)
 	{
-		DEBUG_LOG(TEXT("No ASC or StaminaCostEffect"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No ASC or StaminaCostEffect"));
 		return false;
 	}
 
@@ -125,7 +152,7 @@ bool UBaseAbility::ApplyStaminaCost()
 
 	if (!EffectSpec.IsValid())
 	{
-		DEBUG_LOG(TEXT("Failed StaminaCost GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed StaminaCost GameplayEffectSpec"));
 		return false;
 	}
 
@@ -133,7 +160,7 @@ bool UBaseAbility::ApplyStaminaCost()
 	const FActiveGameplayEffectHandle Handle = ASC->ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get());
 	const bool bApplied = Handle.IsValid();
 
-	DEBUG_LOG(TEXT("ApplyStaminaCost applied=%s, Cost=%.2f"), bApplied ? TEXT("true") : TEXT("false"), StaminaCost);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("ApplyStaminaCost applied=%s, Cost=%.2f"), bApplied ? TEXT("true") : TEXT("false"), StaminaCost);
 
 	return true;
 }
@@ -206,7 +233,7 @@ void UBaseAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const
 	UGameplayEffect* CooldownGE = GetCooldownGameplayEffect();
 	if (!CooldownGE)
 	{
-		DEBUG_LOG(TEXT("No Cooldown GameplayEffect set"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Cooldown GameplayEffect set"));
 		return;
 	}
 
@@ -214,7 +241,7 @@ void UBaseAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const
 	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("No AbilitySystemComponent"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No AbilitySystemComponent"));
 		return;
 	}
 
@@ -228,7 +255,7 @@ void UBaseAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const
 
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("Failed to create Cooldown GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to create Cooldown GameplayEffectSpec"));
 		return;
 	}
 
@@ -236,16 +263,38 @@ void UBaseAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const
 	if (EffectCooldownDurationTag.IsValid() && CooldownDuration > 0.0f)
 	{
 		SpecHandle.Data->SetSetByCallerMagnitude(EffectCooldownDurationTag, CooldownDuration);
-		DEBUG_LOG(TEXT("ApplyCooldown: Duration=%.2f"), CooldownDuration);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ApplyCooldown: Duration=%.2f"), CooldownDuration);
 	}
 
 	//AbilityTags를 동적으로 부여 (GetCooldownTags와 일치시킴)
 	if (AbilityTags.IsValid() && AbilityTags.Num() > 0)
 	{
 		SpecHandle.Data->DynamicGrantedTags.AppendTags(AbilityTags);
-		DEBUG_LOG(TEXT("ApplyCooldown: Added AbilityTags as Granted Tags"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ApplyCooldown: Added AbilityTags as Granted Tags"));
 	}
 
 	//자기 자신에게 적용
 	ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-}
\ No newline at end of file
+}
+
+void UBaseAbility::RunLatent(FAbilityCoroutine&& Flow)
+{
+	LatentFlow = MoveTemp(Flow);
+	LatentFlow.Start();
+}
+
+UAbilityMontageDriver* UBaseAbility::GetMontageDriver()
+{
+	if (!MontageDriver)
+	{
+		MontageDriver = NewObject<UAbilityMontageDriver>(this);
+		MontageDriver->Initialize(this);
+
+		if (IMontageAbilityInterface* MontageAbility = Cast<IMontageAbilityInterface>(this))
+		{
+			MontageAbility->BindEventsAndReadyMontageTask();
+		}
+	}
+
+	return MontageDriver;
+}
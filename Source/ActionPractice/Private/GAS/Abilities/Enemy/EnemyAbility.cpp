@@ -6,15 +6,6 @@
 #include "GAS/AbilitySystemComponent/BossAbilitySystemComponent.h"
 #include "AI/EnemyAIController.h"
 
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogEnemyAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogEnemyAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
-
 void UEnemyAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
 {
 	Super::OnGiveAbility(ActorInfo, Spec);
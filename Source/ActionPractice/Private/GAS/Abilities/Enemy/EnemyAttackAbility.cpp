@@ -4,21 +4,14 @@
 #include "Animation/AnimMontage.h"
 #include "Characters/BossCharacter.h"
 #include "Characters/Enemy/EnemyDataAsset.h"
+#include "Characters/HitDetection/HitImpactSubsystem.h"
 #include "GAS/AbilitySystemComponent/BossAbilitySystemComponent.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "Items/AttackData.h"
 #include "AI/EnemyAIController.h"
 #include "Characters/ActionPracticeCharacter.h"
-
-#define ENABLE_DEBUG_LOG 1
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogEnemyAttackAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogEnemyAttackAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 void UEnemyAttackAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
 {
@@ -30,17 +23,17 @@ void UEnemyAttackAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorIn
 
 	if (!EventNotifyRotateToTargetTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyRotateToTargetTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyRotateToTargetTag is not valid"));
 	}
 
 	if (!EventNotifyCheckConditionTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyCheckConditionTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyCheckConditionTag is not valid"));
 	}
 
 	if (!EventNotifyActionRecoveryEndTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyActionRecoveryEndTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyActionRecoveryEndTag is not valid"));
 	}
 }
 
@@ -51,21 +44,21 @@ void UEnemyAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handl
 	ABossCharacter* BossCharacter = GetBossCharacterFromActorInfo();
 	if (!BossCharacter)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackAbility::ActivateAbility FAIL - BossCharacter is nullptr. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ActivateAbility FAIL - BossCharacter is nullptr. Ability=%s"), *GetName());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
 
 	if (!HitDetectionSetter.Init(BossCharacter->GetHitDetectionInterface()))
 	{
-		DEBUG_LOG(TEXT("EnemyAttackAbility::ActivateAbility FAIL - HitDetectionSetter.Init failed. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ActivateAbility FAIL - HitDetectionSetter.Init failed. Ability=%s"), *GetName());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
 
 	if (!HitDetectionSetter.Bind(this))
 	{
-		DEBUG_LOG(TEXT("EnemyAttackAbility::ActivateAbility FAIL - HitDetectionSetter.Bind failed. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ActivateAbility FAIL - HitDetectionSetter.Bind failed. Ability=%s"), *GetName());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
@@ -73,7 +66,7 @@ void UEnemyAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handl
 	const UEnemyDataAsset* EnemyData = BossCharacter->GetEnemyData();
 	if (!EnemyData)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackAbility::ActivateAbility FAIL - EnemyData is nullptr. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ActivateAbility FAIL - EnemyData is nullptr. Ability=%s"), *GetName());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
@@ -81,7 +74,7 @@ void UEnemyAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handl
 	EnemyAttackData = EnemyData->NamedAttackData.Find(AttackName);
 	if (!EnemyAttackData || EnemyAttackData->ComboSequence.Num() == 0)
 	{
-		DEBUG_LOG(TEXT("ActivateAbility: Attack data not found for name: %s"), *AttackName.ToString());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ActivateAbility: Attack data not found for name: %s"), *AttackName.ToString());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
@@ -97,7 +90,6 @@ void UEnemyAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handl
 
 	ComboCounter = 0;
 	bPerformNextCombo = true;
-	bCreateTask = true;
 	PlayAction();
 }
 
@@ -106,7 +98,7 @@ void UEnemyAttackAbility::SetHitDetectionConfig()
 	//PrepareHitDetection 호출
 	if (!HitDetectionSetter.PrepareHitDetection(AttackName, ComboCounter))
 	{
-		DEBUG_LOG(TEXT("Failed to prepare HitDetection"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to prepare HitDetection"));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
@@ -118,6 +110,13 @@ void UEnemyAttackAbility::OnHitDetected(AActor* HitActor, const FHitResult& HitR
 	UBossAbilitySystemComponent* SourceASC = GetBossAbilitySystemComponentFromActorInfo();
 	if (!HitActor || !SourceASC) return;
 
+	//이펙트/사운드는 프레임 끝에 병합, 컬링 후 풀에서 재생
+	if (ABossCharacter* BossCharacter = GetBossCharacterFromActorInfo())
+	{
+		const UEnemyDataAsset* EnemyData = BossCharacter->GetEnemyData();
+		UHitImpactSubsystem::BroadcastImpact(BossCharacter, EnemyData ? EnemyData->ImpactTable.Get() : nullptr, HitActor, HitResult, AttackData);
+	}
+
 	//Target ASC (피격자)
 	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(HitActor);
 	if (!TargetASC) return;
@@ -133,7 +132,7 @@ void UEnemyAttackAbility::OnHitDetected(AActor* HitActor, const FHitResult& HitR
 		//적용에 성공했으면
 		if (ActiveGEHandle.WasSuccessfullyApplied())
 		{
-			DEBUG_LOG(TEXT("Damage Applied Successfully"));
+			AP_DEBUG_LOG(LogAPAbility, TEXT("Damage Applied Successfully"));
 		}
 	}
 }
@@ -149,7 +148,7 @@ UAnimMontage* UEnemyAttackAbility::SetMontageToPlayTask()
 {
 	if (!EnemyAttackData)
 	{
-		DEBUG_LOG(TEXT("SetMontageToPlayTask: No EnemyAttackData"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: No EnemyAttackData"));
 		return nullptr;
 	}
 
@@ -163,7 +162,7 @@ UAnimMontage* UEnemyAttackAbility::SetMontageToPlayTask()
 	UAnimMontage* Montage = ComboData.AttackMontage.LoadSynchronous();
 	if (!Montage)
 	{
-		DEBUG_LOG(TEXT("SetMontageToPlayTask: Failed to load montage. AttackName=%s, ComboIndex=%d"),
+		AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: Failed to load montage. AttackName=%s, ComboIndex=%d"),
 			*AttackName.ToString(), ComboCounter);
 		return nullptr;
 	}
@@ -176,62 +175,47 @@ void UEnemyAttackAbility::ExecuteMontageTask()
 	UAnimMontage* MontageToPlay = SetMontageToPlayTask();
 	if (!MontageToPlay)
 	{
-		DEBUG_LOG(TEXT("EnemyAttackAbility::ExecuteMontageTask FAIL - MontageToPlay is nullptr. Ability=%s"), *GetName());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ExecuteMontageTask FAIL - MontageToPlay is nullptr. Ability=%s"), *GetName());
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		return;
 	}
 
-	if (bCreateTask) //커스텀 태스크 생성
+	//콤보 간에는 드라이버가 제자리에서 몽타주 전환
+	if (!GetMontageDriver()->Play(MontageToPlay))
 	{
-		PlayMontageWithEventsTask = UAbilityTask_PlayMontageWithEvents::CreatePlayMontageWithEventsProxy(
-			this,
-			NAME_None,
-			MontageToPlay,
-			1.0f,
-			NAME_None,
-			1.0f
-		);
-
-		BindEventsAndReadyMontageTask();
-	}
-	else //태스크 중간에 몽타주 바꾸기
-	{
-		PlayMontageWithEventsTask->ChangeMontageAndPlay(MontageToPlay);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EnemyAttackAbility::ExecuteMontageTask FAIL - Montage_Play failed. Ability=%s"), *GetName());
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 	}
 }
 
 void UEnemyAttackAbility::BindEventsAndReadyMontageTask()
 {
-	if (!PlayMontageWithEventsTask)
+	if (!MontageDriver)
 	{
-		DEBUG_LOG(TEXT("No MontageWithEvents Task"));
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage Driver"));
 		return;
 	}
 
-	//커스텀 몽타주 태스크 델리게이트 바인딩
-	PlayMontageWithEventsTask->OnMontageCompleted.AddDynamic(this, &UEnemyAttackAbility::OnTaskMontageCompleted);
-	PlayMontageWithEventsTask->OnMontageInterrupted.AddDynamic(this, &UEnemyAttackAbility::OnTaskMontageInterrupted);
-	PlayMontageWithEventsTask->OnNotifyEventsReceived.AddDynamic(this, &UEnemyAttackAbility::OnTaskNotifyEventsReceived);
+	//몽타주 드라이버 콜백 바인딩 (드라이버 생성 시 한 번)
+	MontageDriver->OnMontageCompleted.BindUObject(this, &UEnemyAttackAbility::OnTaskMontageCompleted);
+	MontageDriver->OnMontageInterrupted.BindUObject(this, &UEnemyAttackAbility::OnTaskMontageInterrupted);
+	MontageDriver->OnNotifyEventReceived.BindUObject(this, &UEnemyAttackAbility::OnTaskNotifyEventsReceived);
 
 	//노티파이 이벤트 바인딩
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyRotateToTargetTag);
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyCheckConditionTag);
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyActionRecoveryEndTag);
-
-	//태스크 활성화
-	PlayMontageWithEventsTask->ReadyForActivation();
+	MontageDriver->BindNotifyEventTag(EventNotifyRotateToTargetTag);
+	MontageDriver->BindNotifyEventTag(EventNotifyCheckConditionTag);
+	MontageDriver->BindNotifyEventTag(EventNotifyActionRecoveryEndTag);
 }
 
 void UEnemyAttackAbility::OnTaskMontageCompleted()
 {
-	DEBUG_LOG(TEXT("Montage Task Completed"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Task Completed"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 void UEnemyAttackAbility::OnTaskMontageInterrupted()
 {
-	DEBUG_LOG(TEXT("Montage Task Interrupted"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Task Interrupted"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 }
 
@@ -256,27 +240,27 @@ void UEnemyAttackAbility::OnEventRotateToTarget(FGameplayEventData Payload)
 	ABossCharacter* BossCharacter = GetBossCharacterFromActorInfo();
 	if (!BossCharacter)
 	{
-		DEBUG_LOG(TEXT("OnEventRotateToTarget: No BossCharacter"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventRotateToTarget: No BossCharacter"));
 		return;
 	}
 
 	//캐싱된 Target Actor 가져오기
 	if (!CachedTargetInfo.IsValid())
 	{
-		DEBUG_LOG(TEXT("OnEventRotateToTarget: No Cached Target"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventRotateToTarget: No Cached Target"));
 		return;
 	}
 
 	AActor* TargetActor = CachedTargetInfo.Actor.Get();
 	if (!TargetActor)
 	{
-		DEBUG_LOG(TEXT("OnEventRotateToTarget: Target Actor is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventRotateToTarget: Target Actor is nullptr"));
 		return;
 	}
 
 	//타겟을 향해 회전
 	BossCharacter->RotateToTarget(TargetActor, RotateTime);
-	DEBUG_LOG(TEXT("OnEventRotateToTarget: Rotating to %s"),	*TargetActor->GetName());
+	AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventRotateToTarget: Rotating to %s"),	*TargetActor->GetName());
 }
 
 void UEnemyAttackAbility::OnEventCheckCondition(FGameplayEventData Payload)
@@ -284,7 +268,7 @@ void UEnemyAttackAbility::OnEventCheckCondition(FGameplayEventData Payload)
 	AEnemyAIController* AIController = GetEnemyAIControllerFromActorInfo();
 	if (!AIController)
 	{
-		DEBUG_LOG(TEXT("OnEventCheckCondition: No AIController"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventCheckCondition: No AIController"));
 		bPerformNextCombo = false;
 		return;
 	}
@@ -292,7 +276,7 @@ void UEnemyAttackAbility::OnEventCheckCondition(FGameplayEventData Payload)
 	FCurrentTarget CurrentTargetInfo = AIController->GetCurrentTarget();
 	if (!CurrentTargetInfo.IsValid())
 	{
-		DEBUG_LOG(TEXT("OnEventCheckCondition: No Valid Target"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventCheckCondition: No Valid Target"));
 		bPerformNextCombo = false;
 		return;
 	}
@@ -300,7 +284,7 @@ void UEnemyAttackAbility::OnEventCheckCondition(FGameplayEventData Payload)
 	//거리 체크
 	if (CurrentTargetInfo.Distance > MaxTargetDistance)
 	{
-		DEBUG_LOG(TEXT("OnEventCheckCondition: Target too far - Distance: %.2f, Max: %.2f"), CurrentTargetInfo.Distance, MaxTargetDistance);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventCheckCondition: Target too far - Distance: %.2f, Max: %.2f"), CurrentTargetInfo.Distance, MaxTargetDistance);
 		bPerformNextCombo = false;
 		return;
 	}
@@ -308,61 +292,60 @@ void UEnemyAttackAbility::OnEventCheckCondition(FGameplayEventData Payload)
 	//각도 체크 (절대값)
 	if (FMath::Abs(CurrentTargetInfo.AngleToTarget) > MaxTargetAngle)
 	{
-		DEBUG_LOG(TEXT("OnEventCheckCondition: Target angle out of range - Angle: %.2f, Max: %.2f"), CurrentTargetInfo.AngleToTarget, MaxTargetAngle);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventCheckCondition: Target angle out of range - Angle: %.2f, Max: %.2f"), CurrentTargetInfo.AngleToTarget, MaxTargetAngle);
 		bPerformNextCombo = false;
 		return;
 	}
 
-	DEBUG_LOG(TEXT("OnEventCheckCondition: Passed - Distance: %.2f, Angle: %.2f"), CurrentTargetInfo.Distance, CurrentTargetInfo.AngleToTarget);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventCheckCondition: Passed - Distance: %.2f, Angle: %.2f"), CurrentTargetInfo.Distance, CurrentTargetInfo.AngleToTarget);
 }
 
 void UEnemyAttackAbility::OnEventActionRecoveryEnd(FGameplayEventData Payload)
 {
-	DEBUG_LOG(TEXT("OnEventActionRecoveryEnd: bPerformNextCombo=%s"),
+	AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventActionRecoveryEnd: bPerformNextCombo=%s"),
 		bPerformNextCombo ? TEXT("true") : TEXT("false"));
 
 	if (bPerformNextCombo)
 	{
-		DEBUG_LOG(TEXT("OnEventActionRecoveryEnd: Performing Next Combo"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventActionRecoveryEnd: Performing Next Combo"));
 		PlayNextCombo();
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("OnEventActionRecoveryEnd: Combo Cancelled"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("OnEventActionRecoveryEnd: Combo Cancelled"));
 	}
 }
 
 void UEnemyAttackAbility::PlayNextCombo()
 {
 	++ComboCounter;
-	DEBUG_LOG(TEXT("PlayNextCombo: ComboCounter=%d / MaxComboCount=%d"),
+	AP_DEBUG_LOG(LogAPAbility, TEXT("PlayNextCombo: ComboCounter=%d / MaxComboCount=%d"),
 		ComboCounter, MaxComboCount);
 
 	//콤보 카운터가 콤보 시퀀스를 벗어나면 종료
 	if (ComboCounter >= MaxComboCount)
 	{
-		DEBUG_LOG(TEXT("PlayNextCombo: Combo Finished - ComboCounter: %d"), ComboCounter);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PlayNextCombo: Combo Finished - ComboCounter: %d"), ComboCounter);
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		return;
 	}
 
 	bPerformNextCombo = true;
-	bCreateTask = false;
 	PlayAction();
 }
 
 void UEnemyAttackAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	DEBUG_LOG(TEXT("EndAbility %d"), bWasCancelled);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("EndAbility %d"), bWasCancelled);
 
 	if (IsEndAbilityValid(Handle, ActorInfo))
 	{
 		//HitDetectionSetter 언바인딩
 		HitDetectionSetter.UnBind();
 
-		if (PlayMontageWithEventsTask)
+		if (MontageDriver)
 		{
-			PlayMontageWithEventsTask->bStopMontageWhenAbilityCancelled = bWasCancelled;
+			MontageDriver->bStopMontageWhenAbilityCancelled = bWasCancelled;
 		}
 
 		Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
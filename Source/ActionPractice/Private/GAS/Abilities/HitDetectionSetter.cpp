@@ -1,13 +1,5 @@
 #include "GAS/Abilities/HitDetectionSetter.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogHitDetectionSetter, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogHitDetectionSetter, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 bool FHitDetectionSetter::Init(const TScriptInterface<IHitDetectionInterface>& InHitDetection)
 {
@@ -15,11 +7,11 @@ bool FHitDetectionSetter::Init(const TScriptInterface<IHitDetectionInterface>& I
 
 	if(!HitDetection)
 	{
-		DEBUG_LOG(TEXT("Init: HitDetection is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Init: HitDetection is nullptr"));
 		return false;
 	}
 
-	DEBUG_LOG(TEXT("Init: HitDetection initialized successfully"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Init: HitDetection initialized successfully"));
 	return true;
 }
 
@@ -27,13 +19,13 @@ bool FHitDetectionSetter::Bind(IHitDetectionUser* User)
 {
 	if(!HitDetection)
 	{
-		DEBUG_LOG(TEXT("Bind: HitDetection is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Bind: HitDetection is nullptr"));
 		return false;
 	}
 
 	if(!User)
 	{
-		DEBUG_LOG(TEXT("Bind: User is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Bind: User is nullptr"));
 		return false;
 	}
 
@@ -41,7 +33,7 @@ bool FHitDetectionSetter::Bind(IHitDetectionUser* User)
 
 	OnHitDelegateHandle = HitDetection->GetOnHitDetected().AddRaw(User, &IHitDetectionUser::OnHitDetected);
 
-	DEBUG_LOG(TEXT("Bind: Successfully bound to IHitDetectionUser"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Bind: Successfully bound to IHitDetectionUser"));
 	return true;
 }
 
@@ -52,7 +44,7 @@ void FHitDetectionSetter::UnBind()
 		HitDetection->GetOnHitDetected().Remove(OnHitDelegateHandle);
 		OnHitDelegateHandle.Reset();
 
-		DEBUG_LOG(TEXT("UnBind: Delegate unbound"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("UnBind: Delegate unbound"));
 	}
 }
 
@@ -60,13 +52,13 @@ bool FHitDetectionSetter::PrepareHitDetection(const FGameplayTagContainer& Asset
 {
 	if(!HitDetection)
 	{
-		DEBUG_LOG(TEXT("PrepareHitDetection: HitDetection is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PrepareHitDetection: HitDetection is nullptr"));
 		return false;
 	}
 
 	HitDetection->PrepareHitDetection(AssetTag, ComboCounter);
 
-	DEBUG_LOG(TEXT("PrepareHitDetection: Called with ComboCounter=%d"), ComboCounter);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("PrepareHitDetection: Called with ComboCounter=%d"), ComboCounter);
 	return true;
 }
 
@@ -74,13 +66,13 @@ bool FHitDetectionSetter::PrepareHitDetection(const FName& AttackName, const int
 {
 	if(!HitDetection)
 	{
-		DEBUG_LOG(TEXT("PrepareHitDetection: HitDetection is nullptr"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PrepareHitDetection: HitDetection is nullptr"));
 		return false;
 	}
 
 	HitDetection->PrepareHitDetection(AttackName, ComboCounter);
 
-	DEBUG_LOG(TEXT("PrepareHitDetection: Called with AttackName=%s, ComboCounter=%d"), *AttackName.ToString(), ComboCounter);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("PrepareHitDetection: Called with AttackName=%s, ComboCounter=%d"), *AttackName.ToString(), ComboCounter);
 	return true;
 }
 
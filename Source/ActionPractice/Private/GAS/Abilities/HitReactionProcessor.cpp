@@ -1,13 +1,5 @@
 #include "GAS/Abilities/HitReactionProcessor.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogHitReactionProcessor, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogHitReactionProcessor, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 FHitReactionProcessor::FHitReactionProcessor()
 {
@@ -17,7 +9,7 @@ void FHitReactionProcessor::InitReactionLevel(float Light, float Heavy)
 {
 	LightThreshold = Light;
 	HeavyThreshold = Heavy;
-	DEBUG_LOG(TEXT("InitReactionLevel: Light=%.1f, Heavy=%.1f"), Light, Heavy);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("InitReactionLevel: Light=%.1f, Heavy=%.1f"), Light, Heavy);
 }
 
 void FHitReactionProcessor::SelectReactionLevel(float PoiseDamage)
@@ -25,17 +17,17 @@ void FHitReactionProcessor::SelectReactionLevel(float PoiseDamage)
 	//Poise 값에 따라 레벨 선택
 	if (PoiseDamage < HeavyThreshold)
 	{
-		DEBUG_LOG(TEXT("Heavy hit reaction (Poise=%.1f < %.1f)"), PoiseDamage, HeavyThreshold);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Heavy hit reaction (Poise=%.1f < %.1f)"), PoiseDamage, HeavyThreshold);
 		ReactionLevel = EReactionLevel::Heavy;
 	}
 	else if (PoiseDamage < LightThreshold)
 	{
-		DEBUG_LOG(TEXT("Middle hit reaction (%.1f <= Poise=%.1f < %.1f)"), HeavyThreshold, PoiseDamage, LightThreshold);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Middle hit reaction (%.1f <= Poise=%.1f < %.1f)"), HeavyThreshold, PoiseDamage, LightThreshold);
 		ReactionLevel = EReactionLevel::Middle;
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("Light hit reaction (Poise=%.1f >= %.1f)"), PoiseDamage, LightThreshold);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Light hit reaction (Poise=%.1f >= %.1f)"), PoiseDamage, LightThreshold);
 		ReactionLevel = EReactionLevel::Light;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,466 @@
+#include "GAS/Abilities/Latent/AbilityCoroutine.h"
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Characters/ActionPracticeCharacter.h"
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
+
+namespace AbilityCoroutinePool
+{
+	//64바이트 단위 버킷, 최대 2KB까지 풀링 (그 이상은 일반 할당)
+	static constexpr SIZE_T Granularity = 64;
+	static constexpr int32 NumBuckets = 32;
+
+	struct FFreeNode
+	{
+		FFreeNode* Next;
+	};
+
+	static FFreeNode* FreeLists[NumBuckets] = {};
+
+	static int32 GetBucket(SIZE_T Size)
+	{
+		return static_cast<int32>((Size + Granularity - 1) / Granularity) - 1;
+	}
+}
+
+#pragma region "Coroutine Frame Pool"
+void* FAbilityCoroutine::promise_type::operator new(size_t Size)
+{
+	using namespace AbilityCoroutinePool;
+	check(IsInGameThread());
+
+	const int32 Bucket = GetBucket(Size);
+	if (Bucket >= NumBuckets)
+	{
+		INC_DWORD_STAT(STAT_CombatLatentFrameAllocations);
+		return FMemory::Malloc(Size);
+	}
+
+	if (FFreeNode* Node = FreeLists[Bucket])
+	{
+		FreeLists[Bucket] = Node->Next;
+		return Node;
+	}
+
+	INC_DWORD_STAT(STAT_CombatLatentFrameAllocations);
+	return FMemory::Malloc((Bucket + 1) * Granularity);
+}
+
+void FAbilityCoroutine::promise_type::operator delete(void* Ptr, size_t Size)
+{
+	using namespace AbilityCoroutinePool;
+
+	const int32 Bucket = GetBucket(Size);
+	if (Bucket >= NumBuckets)
+	{
+		FMemory::Free(Ptr);
+		return;
+	}
+
+	FFreeNode* Node = static_cast<FFreeNode*>(Ptr);
+	Node->Next = FreeLists[Bucket];
+	FreeLists[Bucket] = Node;
+}
+#pragma endregion
+
+#pragma region "Coroutine Functions"
+FAbilityCoroutine::FAbilityCoroutine(FHandle InHandle)
+	: Handle(InHandle)
+{
+	Handle.promise().Owner = this;
+}
+
+FAbilityCoroutine::FAbilityCoroutine(FAbilityCoroutine&& Other) noexcept
+	: Handle(Other.Handle)
+{
+	Other.Handle = nullptr;
+	if (Handle)
+	{
+		Handle.promise().Owner = this;
+	}
+}
+
+FAbilityCoroutine& FAbilityCoroutine::operator=(FAbilityCoroutine&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Cancel();
+
+		Handle = Other.Handle;
+		Other.Handle = nullptr;
+		if (Handle)
+		{
+			Handle.promise().Owner = this;
+		}
+	}
+	return *this;
+}
+
+FAbilityCoroutine::~FAbilityCoroutine()
+{
+	Cancel();
+}
+
+void FAbilityCoroutine::Start()
+{
+	if (Handle)
+	{
+		Resume(Handle);
+	}
+}
+
+void FAbilityCoroutine::Cancel()
+{
+	if (!Handle) return;
+
+	FHandle CancelledHandle = Handle;
+	Handle = nullptr;
+
+	promise_type& Promise = CancelledHandle.promise();
+	Promise.Owner = nullptr;
+
+	//자기 자신 안에서 취소되면 실행 중인 프레임을 파괴할 수 없으므로 Resume 복귀 시 파괴
+	if (Promise.bRunning)
+	{
+		Promise.bCancelRequested = true;
+		return;
+	}
+
+	CancelledHandle.destroy();
+}
+
+void FAbilityCoroutine::Resume(FHandle InHandle)
+{
+	promise_type& Promise = InHandle.promise();
+
+	Promise.bRunning = true;
+	InHandle.resume();
+	Promise.bRunning = false;
+
+	if (InHandle.done() || Promise.bCancelRequested)
+	{
+		if (Promise.Owner)
+		{
+			Promise.Owner->Handle = nullptr;
+		}
+		InHandle.destroy();
+	}
+}
+#pragma endregion
+
+namespace AbilityLatent
+{
+#pragma region "Awaiter Base"
+	bool FAwaiterBase::BeginSuspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		Continuation = InHandle;
+		return !InHandle.promise().bCancelRequested;
+	}
+
+	void FAwaiterBase::Complete()
+	{
+		FAbilityCoroutine::FHandle Handle = Continuation;
+		Continuation = nullptr;
+		if (Handle)
+		{
+			FAbilityCoroutine::Resume(Handle);
+		}
+	}
+#pragma endregion
+
+#pragma region "Wait Seconds"
+	FWaitSecondsAwaiter::~FWaitSecondsAwaiter()
+	{
+		if (UWorld* CurrentWorld = World.Get())
+		{
+			CurrentWorld->GetTimerManager().ClearTimer(TimerHandle);
+		}
+	}
+
+	bool FWaitSecondsAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		UWorld* CurrentWorld = World.Get();
+		if (!CurrentWorld)
+		{
+			AP_DEBUG_LOG(LogAPAbility, TEXT("WaitSeconds: No World, continuing immediately"));
+			return false;
+		}
+
+		FTimerDelegate Delegate = FTimerDelegate::CreateLambda([this]() { Complete(); });
+		if (Seconds <= 0.0f)
+		{
+			TimerHandle = CurrentWorld->GetTimerManager().SetTimerForNextTick(Delegate);
+		}
+		else
+		{
+			CurrentWorld->GetTimerManager().SetTimer(TimerHandle, Delegate, Seconds, false);
+		}
+		return true;
+	}
+#pragma endregion
+
+#pragma region "Wait Gameplay Event"
+	FWaitGameplayEventAwaiter::~FWaitGameplayEventAwaiter()
+	{
+		Unbind();
+	}
+
+	bool FWaitGameplayEventAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		UAbilitySystemComponent* CurrentASC = ASC.Get();
+		if (!CurrentASC || !Tag.IsValid())
+		{
+			AP_DEBUG_LOG(LogAPAbility, TEXT("WaitGameplayEvent: No ASC or invalid tag, continuing immediately"));
+			return false;
+		}
+
+		DelegateHandle = CurrentASC->GenericGameplayEventCallbacks.FindOrAdd(Tag).AddLambda([this](const FGameplayEventData* EventData)
+		{
+			if (EventData)
+			{
+				Payload = *EventData;
+			}
+			Unbind();
+			Complete();
+		});
+		return true;
+	}
+
+	void FWaitGameplayEventAwaiter::Unbind()
+	{
+		if (!DelegateHandle.IsValid()) return;
+
+		if (UAbilitySystemComponent* CurrentASC = ASC.Get())
+		{
+			if (FGameplayEventMulticastDelegate* Delegate = CurrentASC->GenericGameplayEventCallbacks.Find(Tag))
+			{
+				Delegate->Remove(DelegateHandle);
+			}
+		}
+		DelegateHandle.Reset();
+	}
+#pragma endregion
+
+#pragma region "Wait Tag"
+	FWaitTagAwaiter::~FWaitTagAwaiter()
+	{
+		Unbind();
+	}
+
+	bool FWaitTagAwaiter::await_ready() const
+	{
+		const UAbilitySystemComponent* CurrentASC = ASC.Get();
+		return !CurrentASC || CurrentASC->HasMatchingGameplayTag(Tag) == bWaitForAdded;
+	}
+
+	bool FWaitTagAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		UAbilitySystemComponent* CurrentASC = ASC.Get();
+		if (!CurrentASC) return false;
+
+		DelegateHandle = CurrentASC->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved).AddLambda([this](const FGameplayTag, int32 NewCount)
+		{
+			if ((NewCount > 0) != bWaitForAdded) return;
+
+			Unbind();
+			Complete();
+		});
+		return true;
+	}
+
+	void FWaitTagAwaiter::Unbind()
+	{
+		if (!DelegateHandle.IsValid()) return;
+
+		if (UAbilitySystemComponent* CurrentASC = ASC.Get())
+		{
+			CurrentASC->UnregisterGameplayTagEvent(DelegateHandle, Tag, EGameplayTagEventType::NewOrRemoved);
+		}
+		DelegateHandle.Reset();
+	}
+#pragma endregion
+
+#pragma region "Play Montage"
+	FPlayMontageAwaiter::~FPlayMontageAwaiter()
+	{
+		Unbind();
+	}
+
+	bool FPlayMontageAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		const UGameplayAbility* CurrentAbility = Ability.Get();
+		const FGameplayAbilityActorInfo* ActorInfo = CurrentAbility ? CurrentAbility->GetCurrentActorInfo() : nullptr;
+		UAnimInstance* CurrentAnimInstance = ActorInfo ? ActorInfo->GetAnimInstance() : nullptr;
+		UAnimMontage* CurrentMontage = Montage.Get();
+
+		if (!CurrentAnimInstance || !CurrentMontage || CurrentAnimInstance->Montage_Play(CurrentMontage, PlayRate) <= 0.0f)
+		{
+			AP_DEBUG_LOG(LogAPAbility, TEXT("PlayMontageAndWait: failed to play %s"), *GetNameSafe(CurrentMontage));
+			return false;
+		}
+
+		if (StartSection != NAME_None)
+		{
+			CurrentAnimInstance->Montage_JumpToSection(StartSection, CurrentMontage);
+		}
+
+		AnimInstance = CurrentAnimInstance;
+		FOnMontageEnded EndDelegate = FOnMontageEnded::CreateLambda([this](UAnimMontage*, bool bWasInterrupted)
+		{
+			bInterrupted = bWasInterrupted;
+			AnimInstance.Reset();
+			Complete();
+		});
+		CurrentAnimInstance->Montage_SetEndDelegate(EndDelegate, CurrentMontage);
+		return true;
+	}
+
+	void FPlayMontageAwaiter::Unbind()
+	{
+		UAnimInstance* CurrentAnimInstance = AnimInstance.Get();
+		UAnimMontage* CurrentMontage = Montage.Get();
+		if (CurrentAnimInstance && CurrentMontage)
+		{
+			FOnMontageEnded EmptyEndDelegate;
+			CurrentAnimInstance->Montage_SetEndDelegate(EmptyEndDelegate, CurrentMontage);
+		}
+		AnimInstance.Reset();
+	}
+#pragma endregion
+
+#pragma region "Wait Attribute Change"
+	FWaitAttributeChangeAwaiter::~FWaitAttributeChangeAwaiter()
+	{
+		Unbind();
+	}
+
+	bool FWaitAttributeChangeAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		UAbilitySystemComponent* CurrentASC = ASC.Get();
+		if (!CurrentASC || !Attribute.IsValid())
+		{
+			AP_DEBUG_LOG(LogAPAbility, TEXT("WaitAttributeChange: No ASC or invalid attribute, continuing immediately"));
+			return false;
+		}
+
+		DelegateHandle = CurrentASC->GetGameplayAttributeValueChangeDelegate(Attribute).AddLambda([this](const FOnAttributeChangeData& Data)
+		{
+			NewValue = Data.NewValue;
+			Unbind();
+			Complete();
+		});
+		return true;
+	}
+
+	void FWaitAttributeChangeAwaiter::Unbind()
+	{
+		if (!DelegateHandle.IsValid()) return;
+
+		if (UAbilitySystemComponent* CurrentASC = ASC.Get())
+		{
+			CurrentASC->GetGameplayAttributeValueChangeDelegate(Attribute).Remove(DelegateHandle);
+		}
+		DelegateHandle.Reset();
+	}
+#pragma endregion
+
+#pragma region "Wait Actor Delegate"
+	FWaitActorDelegateAwaiter::~FWaitActorDelegateAwaiter()
+	{
+		Unbind();
+	}
+
+	bool FWaitActorDelegateAwaiter::await_suspend(FAbilityCoroutine::FHandle InHandle)
+	{
+		if (!BeginSuspend(InHandle)) return true;
+
+		if (!Owner.IsValid() || !Delegate)
+		{
+			AP_DEBUG_LOG(LogAPAbility, TEXT("WaitActorDelegate: No owner or delegate, continuing immediately"));
+			return false;
+		}
+
+		DelegateHandle = Delegate->AddLambda([this]()
+		{
+			Unbind();
+			Complete();
+		});
+		return true;
+	}
+
+	void FWaitActorDelegateAwaiter::Unbind()
+	{
+		if (!DelegateHandle.IsValid()) return;
+
+		if (Owner.IsValid())
+		{
+			Delegate->Remove(DelegateHandle);
+		}
+		DelegateHandle.Reset();
+	}
+#pragma endregion
+
+#pragma region "Factory Functions"
+	FWaitSecondsAwaiter WaitSeconds(const UObject* WorldContext, float Seconds)
+	{
+		return FWaitSecondsAwaiter(WorldContext ? WorldContext->GetWorld() : nullptr, Seconds);
+	}
+
+	FWaitSecondsAwaiter WaitNextTick(const UObject* WorldContext)
+	{
+		return WaitSeconds(WorldContext, 0.0f);
+	}
+
+	FWaitGameplayEventAwaiter WaitGameplayEvent(const UGameplayAbility* Ability, const FGameplayTag& EventTag)
+	{
+		return FWaitGameplayEventAwaiter(Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr, EventTag);
+	}
+
+	FWaitTagAwaiter WaitTagAdded(const UGameplayAbility* Ability, const FGameplayTag& Tag)
+	{
+		return FWaitTagAwaiter(Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr, Tag, true);
+	}
+
+	FWaitTagAwaiter WaitTagRemoved(const UGameplayAbility* Ability, const FGameplayTag& Tag)
+	{
+		return FWaitTagAwaiter(Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr, Tag, false);
+	}
+
+	FPlayMontageAwaiter PlayMontageAndWait(UGameplayAbility* Ability, UAnimMontage* Montage, float PlayRate, FName StartSection)
+	{
+		return FPlayMontageAwaiter(Ability, Montage, PlayRate, StartSection);
+	}
+
+	FWaitAttributeChangeAwaiter WaitAttributeChange(const UGameplayAbility* Ability, const FGameplayAttribute& Attribute)
+	{
+		return FWaitAttributeChangeAwaiter(Ability ? Ability->GetAbilitySystemComponentFromActorInfo() : nullptr, Attribute);
+	}
+
+	FWaitActorDelegateAwaiter WaitMovementModeChanged(const UGameplayAbility* Ability)
+	{
+		ABaseCharacter* Character = Ability ? Cast<ABaseCharacter>(Ability->GetAvatarActorFromActorInfo()) : nullptr;
+		return FWaitActorDelegateAwaiter(Character, Character ? &Character->OnMovementModeChangedNative : nullptr);
+	}
+
+	FWaitActorDelegateAwaiter WaitMoveInputReleased(const UGameplayAbility* Ability)
+	{
+		AActionPracticeCharacter* Character = Ability ? Cast<AActionPracticeCharacter>(Ability->GetAvatarActorFromActorInfo()) : nullptr;
+		return FWaitActorDelegateAwaiter(Character, Character ? &Character->OnMoveInputReleased : nullptr);
+	}
+#pragma endregion
+}
@@ -2,19 +2,10 @@
 #include "Input/InputBufferComponent.h"
 #include "Characters/ActionPracticeCharacter.h"
 #include "AbilitySystemComponent.h"
-#include "Abilities/Tasks/AbilityTask_WaitDelay.h"
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
 #include "GAS/GameplayTagsSubsystem.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogActionRecoveryAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogActionRecoveryAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Games/ActionPracticeLog.h"
 
 UActionRecoveryAbility::UActionRecoveryAbility()
 {
@@ -33,23 +24,23 @@ void UActionRecoveryAbility::OnGiveAbility(const FGameplayAbilityActorInfo* Acto
 
 	if (!ActionRecoveryStartTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("ActionRecoveryStartTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ActionRecoveryStartTag is not valid"));
 	}
 	if (!ActionRecoveryEndTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("ActionRecoveryEndTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ActionRecoveryEndTag is not valid"));
 	}
 	if (!EventInputByBufferTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventInputByBufferTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventInputByBufferTag is not valid"));
 	}
 	if (!EventPlayBufferTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventPlayBufferTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventPlayBufferTag is not valid"));
 	}
 	if (!StateRecoveringTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateRecoveringTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("StateRecoveringTag is not valid"));
 	}
 }
 
@@ -70,11 +61,11 @@ void UActionRecoveryAbility::AddStateRecoveringTag()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("ActionRecoveryStart: No ASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ActionRecoveryStart: No ASC"));
 	}
 	
 	ASC->AddLooseGameplayTag(StateRecoveringTag);
-	DEBUG_LOG(TEXT("Add State.Recovering"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Add State.Recovering"));
 }
 
 void UActionRecoveryAbility::RemoveStateRecoveringTags()
@@ -82,7 +73,7 @@ void UActionRecoveryAbility::RemoveStateRecoveringTags()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("ActionRecoveryEnd: No ASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ActionRecoveryEnd: No ASC"));
 	}
 
 	//모든 StateRecovering 태그 제거 (스택된 태그 모두 제거)
@@ -91,14 +82,14 @@ void UActionRecoveryAbility::RemoveStateRecoveringTags()
 		ASC->RemoveLooseGameplayTag(StateRecoveringTag);
 	}
 
-	DEBUG_LOG(TEXT("Remove All State.Recovering"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Remove All State.Recovering"));
 }
 
 bool UActionRecoveryAbility::ConsumeStamina()
 {
 	if (!ApplyStaminaCost())
 	{
-		DEBUG_LOG(TEXT("No Stamina"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Stamina"));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return false;
 	}
@@ -115,7 +106,7 @@ bool UActionRecoveryAbility::RotateCharacter()
 
 	if (AActionPracticeCharacter* Character = GetActionPracticeCharacterFromActorInfo())
 	{
-		DEBUG_LOG(TEXT("Rotating Character"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Rotating Character"));
 		Character->RotateCharacterToInputDirection(RotateTime, bIgnoreLockOn);
 		return true;
 	}
@@ -132,13 +123,13 @@ void UActionRecoveryAbility::PlayAction()
 
 	//캐릭터가 회전을 마칠 때까지 기다린 후에 몽타주 태스크 실행
 	//회전하지 않으면 즉시 실행
-	float DelayTime = bShouldRotate ? RotateTime : 0.0f;
-	WaitDelayTask = UAbilityTask_WaitDelay::WaitDelay(this, DelayTime);
-	if (WaitDelayTask)
-	{
-		WaitDelayTask->OnFinish.AddDynamic(this, &UActionRecoveryAbility::ExecuteMontageTask);
-		WaitDelayTask->ReadyForActivation();
-	}
+	RunLatent(ExecuteMontageAfterDelay(bShouldRotate ? RotateTime : 0.0f));
+}
+
+FAbilityCoroutine UActionRecoveryAbility::ExecuteMontageAfterDelay(float DelayTime)
+{
+	co_await AbilityLatent::WaitSeconds(this, DelayTime);
+	ExecuteMontageTask();
 }
 
 void UActionRecoveryAbility::ExecuteMontageTask()
@@ -146,43 +137,35 @@ void UActionRecoveryAbility::ExecuteMontageTask()
 	UAnimMontage* MontageToPlay = SetMontageToPlayTask();
 	if (!MontageToPlay)
 	{
-		DEBUG_LOG(TEXT("No Montage to Play"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage to Play"));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		return;
 	}
-    
-	// 커스텀 태스크 생성
-	PlayMontageWithEventsTask = UAbilityTask_PlayMontageWithEvents::CreatePlayMontageWithEventsProxy(
-		this,
-		NAME_None,
-		MontageToPlay,
-		1.0f,
-		NAME_None,
-		1.0f
-	);
-    
-	BindEventsAndReadyMontageTask();
+
+	//드라이버는 어빌리티 인스턴스와 함께 유지, 재생 중이면 제자리에서 몽타주 전환 (콤보, 차지)
+	if (!GetMontageDriver()->Play(MontageToPlay))
+	{
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to play montage"));
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+	}
 }
 
 void UActionRecoveryAbility::BindEventsAndReadyMontageTask()
 {
-	if (!PlayMontageWithEventsTask)
+	if (!MontageDriver)
 	{
-		DEBUG_LOG(TEXT("No MontageWithEvents Task"));
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage Driver"));
+		return;
 	}
 
-	//커스텀 몽타주 태스크 델리게이트 바인딩
-	PlayMontageWithEventsTask->OnMontageCompleted.AddDynamic(this, &UActionRecoveryAbility::OnTaskMontageCompleted);
-	PlayMontageWithEventsTask->OnMontageInterrupted.AddDynamic(this, &UActionRecoveryAbility::OnTaskMontageInterrupted);
-	PlayMontageWithEventsTask->OnNotifyEventsReceived.AddDynamic(this, &UActionRecoveryAbility::OnTaskNotifyEventsReceived);
+	//몽타주 드라이버 콜백 바인딩 (드라이버 생성 시 한 번)
+	MontageDriver->OnMontageCompleted.BindUObject(this, &UActionRecoveryAbility::OnTaskMontageCompleted);
+	MontageDriver->OnMontageInterrupted.BindUObject(this, &UActionRecoveryAbility::OnTaskMontageInterrupted);
+	MontageDriver->OnNotifyEventReceived.BindUObject(this, &UActionRecoveryAbility::OnTaskNotifyEventsReceived);
 
 	//노티파이 이벤트 바인딩
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(ActionRecoveryStartTag);
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(ActionRecoveryEndTag);
-	
-	//태스크 활성화
-	PlayMontageWithEventsTask->ReadyForActivation();
+	MontageDriver->BindNotifyEventTag(ActionRecoveryStartTag);
+	MontageDriver->BindNotifyEventTag(ActionRecoveryEndTag);
 }
 	
 void UActionRecoveryAbility::ReadyInputByBufferTask()
@@ -198,13 +181,13 @@ void UActionRecoveryAbility::ReadyInputByBufferTask()
 
 void UActionRecoveryAbility::OnTaskMontageCompleted()
 {
-	DEBUG_LOG(TEXT("Montage Task Completed"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Task Completed"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 void UActionRecoveryAbility::OnTaskMontageInterrupted()
 {
-	DEBUG_LOG(TEXT("Montage Task Interrupted"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Task Interrupted"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 }
 
@@ -231,7 +214,7 @@ void UActionRecoveryAbility::OnEventActionRecoveryEnd(FGameplayEventData Payload
 		EventData.EventTag = EventPlayBufferTag;
 			
 		ASC->HandleGameplayEvent(EventPlayBufferTag, &EventData);
-		DEBUG_LOG(TEXT("Play Buffer Event Activated"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Play Buffer Event Activated"));
 	}
 }
 
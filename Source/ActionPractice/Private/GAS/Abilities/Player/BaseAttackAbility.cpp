@@ -6,17 +6,9 @@
 #include "Animation/AnimMontage.h"
 #include "Characters/ActionPracticeCharacter.h"
 #include "GAS/Abilities/Player/WeaponAbilityStatics.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
 #include "GAS/AbilitySystemComponent/ActionPracticeAbilitySystemComponent.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseAttackAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseAttackAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UBaseAttackAbility::UBaseAttackAbility()
 {
@@ -28,7 +20,7 @@ void UBaseAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle
     AActionPracticeCharacter* Character = GetActionPracticeCharacterFromActorInfo();
     if (!Character)
     {
-        DEBUG_LOG(TEXT("No Character"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("No Character"));
         EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
         return;
     }
@@ -36,7 +28,7 @@ void UBaseAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle
     //HitDetectionSetter 초기화
     if (!HitDetectionSetter.Init(Character->GetHitDetectionInterface()))
     {
-        DEBUG_LOG(TEXT("Failed to init HitDetectionSetter"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to init HitDetectionSetter"));
         EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
         return;
     }
@@ -44,7 +36,7 @@ void UBaseAttackAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle
     //HitDetectionSetter 바인딩
     if (!HitDetectionSetter.Bind(this))
     {
-        DEBUG_LOG(TEXT("Failed to bind HitDetectionSetter"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to bind HitDetectionSetter"));
         EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
         return;
     }
@@ -57,19 +49,19 @@ void UBaseAttackAbility::SetHitDetectionConfig()
     FGameplayTagContainer AssetTag = GetAssetTags();
     if (AssetTag.IsEmpty())
     {
-        DEBUG_LOG(TEXT("No AssetTags"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("No AssetTags"));
         return;
     }
     
     //PrepareHitDetection 호출
     if (!HitDetectionSetter.PrepareHitDetection(AssetTag, ComboCounter))
     {
-        DEBUG_LOG(TEXT("Failed to prepare HitDetection"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to prepare HitDetection"));
         EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
         return;
     }
 
-    DEBUG_LOG(TEXT("Attack Ability: Call Hit Detection Prepare"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Attack Ability: Call Hit Detection Prepare"));
 }
 
 void UBaseAttackAbility::OnHitDetected(AActor* HitActor, const FHitResult& HitResult, FFinalAttackData AttackData)
@@ -105,7 +97,7 @@ void UBaseAttackAbility::ActivateInitSettings()
     WeaponAttackData = FWeaponAbilityStatics::GetAttackDataFromAbility(this);
     if (!WeaponAttackData)
     {
-        DEBUG_LOG(TEXT("Cannot Load Base Attack Data"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Cannot Load Base Attack Data"));
         EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
         return;
     }
@@ -131,7 +123,7 @@ UAnimMontage* UBaseAttackAbility::SetMontageToPlayTask()
 {
     if (!WeaponAttackData)
     {
-        DEBUG_LOG(TEXT("SetMontageToPlayTask: No WeaponAttackData"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: No WeaponAttackData"));
         return nullptr;
     }
 
@@ -145,7 +137,7 @@ UAnimMontage* UBaseAttackAbility::SetMontageToPlayTask()
     UAnimMontage* Montage = ComboData.AttackMontage.LoadSynchronous();
     if (!Montage)
     {
-        DEBUG_LOG(TEXT("SetMontageToPlayTask: Failed to load montage. ComboIndex=%d"), ComboCounter);
+        AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: Failed to load montage. ComboIndex=%d"), ComboCounter);
         return nullptr;
     }
 
@@ -154,16 +146,16 @@ UAnimMontage* UBaseAttackAbility::SetMontageToPlayTask()
 
 void UBaseAttackAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-    DEBUG_LOG(TEXT("EndAbility %d"), bWasCancelled);
+    AP_DEBUG_LOG(LogAPAbility, TEXT("EndAbility %d"), bWasCancelled);
 
     if (IsEndAbilityValid(Handle, ActorInfo))
     {
         //HitDetectionSetter 언바인딩
         HitDetectionSetter.UnBind();
 
-        if (PlayMontageWithEventsTask)
+        if (MontageDriver)
         {
-            PlayMontageWithEventsTask->bStopMontageWhenAbilityCancelled = bWasCancelled;
+            MontageDriver->bStopMontageWhenAbilityCancelled = bWasCancelled;
         }
 
         Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -7,21 +7,13 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "GAS/Abilities/Player/WeaponAbilityStatics.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
 #include "Items/WeaponDataAsset.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBlockAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBlockAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Characters/BaseCharacter.h"
+#include "Games/ActionPracticeLog.h"
 
 UBlockAbility::UBlockAbility()
 {
-	PlayMontageWithEventsTask = nullptr;
 	DamageReductionMultiplier = 0.5f;
 	StaminaDamageReduction = 0.5f;
 	BlockAngle = 120.0f;
@@ -40,12 +32,10 @@ void UBlockAbility::ActivateInitSettings()
 	WeaponBlockData = FWeaponAbilityStatics::GetBlockDataFromAbility(this);
 	if (!WeaponBlockData)
 	{
-		DEBUG_LOG(TEXT("Cannot Load Block Data"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Cannot Load Block Data"));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
 		return;
 	}
-	
-	bCreateTask = true;
 }
 
 void UBlockAbility::PlayAction()
@@ -58,7 +48,7 @@ UAnimMontage* UBlockAbility::SetMontageToPlayTask()
 {
 	if (!WeaponBlockData)
 	{
-		DEBUG_LOG(TEXT("SetMontageToPlayTask: No WeaponBlockData"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: No WeaponBlockData"));
 		return nullptr;
 	}
 
@@ -66,7 +56,7 @@ UAnimMontage* UBlockAbility::SetMontageToPlayTask()
 	UAnimMontage* Montage = WeaponBlockData->BlockIdleMontage.LoadSynchronous();
 	if (!Montage)
 	{
-		DEBUG_LOG(TEXT("SetMontageToPlayTask: Failed to load BlockIdleMontage"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("SetMontageToPlayTask: Failed to load BlockIdleMontage"));
 		return nullptr;
 	}
 
@@ -75,7 +65,15 @@ UAnimMontage* UBlockAbility::SetMontageToPlayTask()
 
 void UBlockAbility::BindEventsAndReadyMontageTask()
 {
-	
+	if (!MontageDriver)
+	{
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage Driver"));
+		return;
+	}
+
+	// 델리게이트 바인딩 - 사용하지 않는 델리게이트도 있음
+	MontageDriver->OnMontageCompleted.BindUObject(this, &UBlockAbility::OnTaskMontageCompleted);
+	MontageDriver->OnMontageInterrupted.BindUObject(this, &UBlockAbility::OnTaskMontageInterrupted);
 }
 
 void UBlockAbility::ExecuteMontageTask()
@@ -84,80 +82,63 @@ void UBlockAbility::ExecuteMontageTask()
 	
 	if (!MontageToPlay)
 	{
-		DEBUG_LOG(TEXT("No Montage to Play"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage to Play"));
 		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 		return;
 	}
-    
-	if (bCreateTask) // 커스텀 태스크 생성
-	{        
-		PlayMontageWithEventsTask = UAbilityTask_PlayMontageWithEvents::CreatePlayMontageWithEventsProxy(
-			this,
-			NAME_None,
-			MontageToPlay,
-			1.0f,
-			NAME_None,
-			1.0f
-		);
-		
-		if (PlayMontageWithEventsTask)
-		{        
-			// 델리게이트 바인딩 - 사용하지 않는 델리게이트도 있음
-			PlayMontageWithEventsTask->OnMontageCompleted.AddDynamic(this, &UBlockAbility::OnTaskMontageCompleted);
-			PlayMontageWithEventsTask->OnMontageInterrupted.AddDynamic(this, &UBlockAbility::OnTaskMontageInterrupted);
-
-			// 태스크 활성화
-			PlayMontageWithEventsTask->ReadyForActivation();
-		}
-    
-		else
-		{
-			DEBUG_LOG(TEXT("No Montage Task"));
-			EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
-		}
+
+	if (!GetMontageDriver()->Play(MontageToPlay))
+	{
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to play montage"));
+		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		return;
 	}
 
-	else //태스크 중간에 몽타주 바꾸기
+	//방어 구간 기록, 방어 판정에서 태그 조회 전에 확인
+	if (ABaseCharacter* Character = GetBaseCharacterFromActorInfo())
 	{
-		PlayMontageWithEventsTask->ChangeMontageAndPlay(MontageToPlay);
+		Character->OpenHurtboxWindow(EHurtboxWindow::Guard);
 	}
 }
 
 void UBlockAbility::OnTaskMontageCompleted()
 {
 	//Idle은 실행 X, 오직 Reaction만
-	DEBUG_LOG(TEXT("Montage Completed"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Completed"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 void UBlockAbility::OnTaskMontageInterrupted()
 {
-	DEBUG_LOG(TEXT("Montage Interrupted"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Interrupted"));
 	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 
 void UBlockAbility::InputReleased(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo)
 {
-	DEBUG_LOG(TEXT("Block Input Released - End Ability"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Block Input Released - End Ability"));
 	EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 }
 
 void UBlockAbility::CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,	const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateCancelAbility)
 {
-	DEBUG_LOG(TEXT("Block cancel"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Block cancel"));
 	Super::CancelAbility(Handle, ActorInfo, ActivationInfo, bReplicateCancelAbility);
 }
 
 void UBlockAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	bCreateTask = false;
-	
 	if (IsEndAbilityValid(Handle, ActorInfo))
 	{
-		if (PlayMontageWithEventsTask)
+		if (MontageDriver)
+		{
+			MontageDriver->bStopMontageWhenAbilityCancelled = bWasCancelled;
+		}
+
+		if (ABaseCharacter* Character = ActorInfo ? GetBaseCharacterFromActorInfo(ActorInfo) : nullptr)
 		{
-			PlayMontageWithEventsTask->bStopMontageWhenAbilityCancelled = bWasCancelled;
+			Character->CloseHurtboxWindow(EHurtboxWindow::Guard);
 		}
 
 		Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -8,16 +8,8 @@
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
 #include "GAS/Abilities/Player/BaseAttackAbility.h"
 #include "GAS/Abilities/Player/WeaponAbilityStatics.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogChargeAttackAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogChargeAttackAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Games/ActionPracticeLog.h"
 
 UChargeAttackAbility::UChargeAttackAbility()
 {
@@ -33,11 +25,11 @@ void UChargeAttackAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorI
     
     if (!EventNotifyResetComboTag.IsValid())
     {
-        DEBUG_LOG(TEXT("EventNotifyResetComboTag is not valid"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyResetComboTag is not valid"));
     }
     if (!EventNotifyChargeStartTag.IsValid())
     {
-        DEBUG_LOG(TEXT("EventNotifyChargeStartTag is not valid"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyChargeStartTag is not valid"));
     }
 }
 
@@ -55,8 +47,7 @@ void UChargeAttackAbility::ActivateInitSettings()
     //InputBuffer에 의해 TryActivate될 때 이미 떼져 있는지 체크(NoCharge), 추후 TriggerAbilityFromGameplayEvent 형식으로 활성화 시 bool값을 넘기는 걸로 변경
     bNoCharge = GetInputBufferComponentFromActorInfo()->bBufferActionReleased;
     
-    DEBUG_LOG(TEXT("Charge Ability Activated"));
-    bCreateTask = true;
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Charge Ability Activated"));
     bIsAttackMontage = false;
 }
 
@@ -67,7 +58,7 @@ void UChargeAttackAbility::InputPressed(const FGameplayAbilitySpecHandle Handle,
     {
         bNoCharge = false;
         PlayNextCharge();
-        DEBUG_LOG(TEXT("Input Pressed - After Recovery"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Input Pressed - After Recovery"));
     }
 }
 
@@ -104,50 +95,15 @@ UAnimMontage* UChargeAttackAbility::SetMontageToPlayTask()
     return Super::SetMontageToPlayTask();
 }
 
-void UChargeAttackAbility::ExecuteMontageTask()
-{
-    UAnimMontage* MontageToPlay = SetMontageToPlayTask();
-        
-    if (!MontageToPlay)
-    {
-        DEBUG_LOG(TEXT("No Montage to Play"));
-        EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
-        return;
-    }
-    
-    if (bCreateTask) //커스텀 태스크 생성
-    {        
-        PlayMontageWithEventsTask = UAbilityTask_PlayMontageWithEvents::CreatePlayMontageWithEventsProxy(
-            this,
-            NAME_None,
-            MontageToPlay,
-            1.0f,
-            NAME_None,
-            1.0f
-        );
-    
-        BindEventsAndReadyMontageTask();
-    }
-
-    else //태스크 중간에 몽타주 바꾸기
-    {
-        PlayMontageWithEventsTask->ChangeMontageAndPlay(MontageToPlay);
-    }
-}
-
 void UChargeAttackAbility::BindEventsAndReadyMontageTask()
 {
-    if (!PlayMontageWithEventsTask)
-    {
-        DEBUG_LOG(TEXT("No MontageWithEvents Task"));
-        EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
-    }
+    Super::BindEventsAndReadyMontageTask();
+
+    if (!MontageDriver) return;
 
     //ResetCombo, ChargeStart 노티파이 이벤트 바인딩
-    PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyResetComboTag);
-    PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyChargeStartTag);
-    
-    Super::BindEventsAndReadyMontageTask();
+    MontageDriver->BindNotifyEventTag(EventNotifyResetComboTag);
+    MontageDriver->BindNotifyEventTag(EventNotifyChargeStartTag);
 }
 
 void UChargeAttackAbility::PlayNextCharge()
@@ -161,7 +117,6 @@ void UChargeAttackAbility::PlayNextCharge()
         ComboCounter = 0;
     }
     
-    bCreateTask = false;
     bIsAttackMontage = false;
     PlayAction();
 }
@@ -173,8 +128,7 @@ void UChargeAttackAbility::OnTaskMontageCompleted()
     {
         bMaxCharged = true;
         
-        DEBUG_LOG(TEXT("Montage Completed - Max Charge"));
-        bCreateTask = true;
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Completed - Max Charge"));
         bIsAttackMontage = true;
         PlayAction();  
         
@@ -198,18 +152,17 @@ void UChargeAttackAbility::OnTaskNotifyEventsReceived(FGameplayEventData Payload
 
 void UChargeAttackAbility::OnNotifyResetCombo(FGameplayEventData Payload)
 {
-    DEBUG_LOG(TEXT("Reset Combo"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Reset Combo"));
     ComboCounter = -1; //어빌리티가 살아있는 동안 입력이 들어오면 PlayNext로 0이 되고, 어빌리티가 죽으면 초기화
 }
 
 void UChargeAttackAbility::OnNotifyChargeStart(FGameplayEventData Payload)
 {
-    DEBUG_LOG(TEXT("Charge Start"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Charge Start"));
     bIsCharging = true;
       
     if (bNoCharge) //이미 뗴져 있다면 바로 공격
     {
-        bCreateTask = false;
         bIsAttackMontage = true;
         PlayAction();
 
@@ -224,7 +177,7 @@ void UChargeAttackAbility::OnEventInputByBuffer(FGameplayEventData Payload)
     
     bNoCharge = Payload.EventMagnitude != 0.0f;
     PlayNextCharge();
-    DEBUG_LOG(TEXT("Input By Buffer - Play Next Charge"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Input By Buffer - Play Next Charge"));
 }
 
 void UChargeAttackAbility::OnHitDetected(AActor* HitActor, const FHitResult& HitResult, FFinalAttackData AttackData)
@@ -239,7 +192,6 @@ void UChargeAttackAbility::InputReleased(const FGameplayAbilitySpecHandle Handle
     //차지를 멈췄을 때
     if (bIsCharging) //차지중이라면
     {
-        bCreateTask = false;
         bIsAttackMontage = true;
         PlayAction();
 
@@ -248,14 +200,14 @@ void UChargeAttackAbility::InputReleased(const FGameplayAbilitySpecHandle Handle
 
     else //차지중이 아니라면 (선딜 전에 뗌)
     {
-        DEBUG_LOG(TEXT("Input Released - No Charge true"));    
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Input Released - No Charge true"));    
         bNoCharge = true;
     }
 }
 
 void UChargeAttackAbility::CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateCancelAbility)
 {
-    DEBUG_LOG(TEXT("AttackAbility Cancelled"));    
+    AP_DEBUG_LOG(LogAPAbility, TEXT("AttackAbility Cancelled"));    
     Super::CancelAbility(Handle, ActorInfo, ActivationInfo, bReplicateCancelAbility);
 }
 
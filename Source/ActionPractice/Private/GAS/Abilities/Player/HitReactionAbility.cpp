@@ -6,15 +6,8 @@
 #include "Items/WeaponDataAsset.h"
 #include "AbilitySystemComponent.h"
 #include "Characters/ActionPracticeCharacter.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogHitReactionAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogHitReactionAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
 
 UHitReactionAbility::UHitReactionAbility()
 {
@@ -29,36 +22,39 @@ void UHitReactionAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorIn
 	StateAbilityBlockingTag = UGameplayTagsSubsystem::GetStateAbilityBlockingTag();
 	if (!StateAbilityBlockingTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateAbilityBlockingTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("StateAbilityBlockingTag is Invalid"));
 	}
 
 	AbilityBlockTag = UGameplayTagsSubsystem::GetAbilityBlockTag();
 	if (!AbilityBlockTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("AbilityBlockTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("AbilityBlockTag is Invalid"));
 	}
 }
 
 void UHitReactionAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	COMBAT_SCOPE(STAT_CombatHitReaction);
+	INC_DWORD_STAT(STAT_CombatHitReactions);
+
 	bIsBlockReaction = false;
 
 	if (TriggerEventData)
 	{
 		const float PoiseValue = TriggerEventData->EventMagnitude;
-		DEBUG_LOG(TEXT("HitReaction activated with Poise=%.1f"), PoiseValue);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("HitReaction activated with Poise=%.1f"), PoiseValue);
 
 		//블로킹 상태 확인
 		if (TriggerEventData->TargetTags.HasTag(StateAbilityBlockingTag))
 		{
 			bIsBlockReaction = true;
-			DEBUG_LOG(TEXT("Block Reaction detected"));
+			AP_DEBUG_LOG(LogAPAbility, TEXT("Block Reaction detected"));
 
 			//BlockReaction 동안 State.Blocking 태그 수동 추가
 			if (StateAbilityBlockingTag.IsValid())
 			{
 				ActorInfo->AbilitySystemComponent->AddLooseGameplayTag(StateAbilityBlockingTag);
-				DEBUG_LOG(TEXT("State.Blocking tag added for BlockReaction"));
+				AP_DEBUG_LOG(LogAPAbility, TEXT("State.Blocking tag added for BlockReaction"));
 			}
 		}
 
@@ -80,13 +76,13 @@ UAnimMontage* UHitReactionAbility::SetMontageToPlayTask()
 			switch (Level)
 			{
 				case EReactionLevel::Heavy:
-					DEBUG_LOG(TEXT("Playing BlockReactionHeavy"));
+					AP_DEBUG_LOG(LogAPAbility, TEXT("Playing BlockReactionHeavy"));
 					return BlockData->BlockReactionHeavyMontage.LoadSynchronous();
 				case EReactionLevel::Middle:
-					DEBUG_LOG(TEXT("Playing BlockReactionMiddle"));
+					AP_DEBUG_LOG(LogAPAbility, TEXT("Playing BlockReactionMiddle"));
 					return BlockData->BlockReactionMiddleMontage.LoadSynchronous();
 				case EReactionLevel::Light:
-					DEBUG_LOG(TEXT("Playing BlockReactionLight"));
+					AP_DEBUG_LOG(LogAPAbility, TEXT("Playing BlockReactionLight"));
 					return BlockData->BlockReactionLightMontage.LoadSynchronous();
 				default:
 					return nullptr;
@@ -112,10 +108,10 @@ void UHitReactionAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, co
 		if (StateAbilityBlockingTag.IsValid())
 		{
 			ActorInfo->AbilitySystemComponent->RemoveLooseGameplayTag(StateAbilityBlockingTag);
-			DEBUG_LOG(TEXT("State.Blocking tag removed after BlockReaction"));
+			AP_DEBUG_LOG(LogAPAbility, TEXT("State.Blocking tag removed after BlockReaction"));
 		}
 
-		DEBUG_LOG(TEXT("bWasCancelled=%d"), bWasCancelled);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("bWasCancelled=%d"), bWasCancelled);
 
 		//BlockAbility Spec 찾기
 		FGameplayAbilitySpec* BlockAbilitySpec = nullptr;
@@ -138,11 +134,11 @@ void UHitReactionAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, co
 				bIsBlockInputPressed = Character->IsBlockInputPressed();
 			}
 
-			DEBUG_LOG(TEXT("bIsBlockInputPressed=%d (real-time check)"), bIsBlockInputPressed);
+			AP_DEBUG_LOG(LogAPAbility, TEXT("bIsBlockInputPressed=%d (real-time check)"), bIsBlockInputPressed);
 
 			if (bIsBlockInputPressed)
 			{
-				DEBUG_LOG(TEXT("Block input still pressed, reactivating BlockAbility"));
+				AP_DEBUG_LOG(LogAPAbility, TEXT("Block input still pressed, reactivating BlockAbility"));
 				ActorInfo->AbilitySystemComponent->TryActivateAbility(BlockAbilitySpec->Handle);
 			}
 		}
@@ -1,12 +1,3 @@
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogJumpAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogJumpAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
-
 #include "GAS/Abilities/Player/JumpAbility.h"
 #include "Characters/ActionPracticeCharacter.h"
 #include "GAS/AttributeSet/ActionPracticeAttributeSet.h"
@@ -6,16 +6,8 @@
 #include "GAS/GameplayTagsSubsystem.h"
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
 #include "GAS/Abilities/Player/WeaponAbilityStatics.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogNormalAttackAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogNormalAttackAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Games/ActionPracticeLog.h"
 
 UNormalAttackAbility::UNormalAttackAbility()
 {
@@ -30,7 +22,7 @@ void UNormalAttackAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorI
 
 	if (!EventNotifyResetComboTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyResetComboTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyResetComboTag is not valid"));
 	}
 }
 
@@ -42,8 +34,6 @@ void UNormalAttackAbility::ActivateInitSettings()
 
     //무기 데이터 적용
     MaxComboCount = WeaponAttackData->ComboSequence.Num();
-    
-    bCreateTask = true;
 }
 
 void UNormalAttackAbility::InputPressed(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo)
@@ -52,7 +42,7 @@ void UNormalAttackAbility::InputPressed(const FGameplayAbilitySpecHandle Handle,
     if (!GetAbilitySystemComponentFromActorInfo()->HasMatchingGameplayTag(StateRecoveringTag))
     {
         PlayNextAttack();
-        DEBUG_LOG(TEXT("Input Pressed - After Recovery"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Input Pressed - After Recovery"));
     }
 }
 
@@ -66,9 +56,8 @@ void UNormalAttackAbility::PlayNextAttack()
         ComboCounter = 0;
     }
     
-    DEBUG_LOG(TEXT("NextAttack - ComboCounter: %d"),ComboCounter);
+    AP_DEBUG_LOG(LogAPAbility, TEXT("NextAttack - ComboCounter: %d"),ComboCounter);
 
-    bCreateTask = false;
     PlayAction();
 }
 
@@ -82,48 +71,14 @@ void UNormalAttackAbility::PlayNextAttack()
  * 5. 몽타주 종료 (ResetCombo와 같지 않음)
  */
 
-void UNormalAttackAbility::ExecuteMontageTask()
-{
-    UAnimMontage* MontageToPlay = SetMontageToPlayTask();
-    if (!MontageToPlay)
-    {
-        DEBUG_LOG(TEXT("No Montage to Play %d"), ComboCounter);
-        EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
-        return;
-    }
-    
-    if (bCreateTask) //커스텀 태스크 생성
-    {        
-        PlayMontageWithEventsTask = UAbilityTask_PlayMontageWithEvents::CreatePlayMontageWithEventsProxy(
-            this,
-            NAME_None,
-            MontageToPlay,
-            1.0f,
-            NAME_None,
-            1.0f
-        );
-
-        BindEventsAndReadyMontageTask();
-    }
-
-    else //태스크 중간에 몽타주 바꾸기
-    {
-        PlayMontageWithEventsTask->ChangeMontageAndPlay(MontageToPlay);
-    }
-}
-
 void UNormalAttackAbility::BindEventsAndReadyMontageTask()
 {
-    if (!PlayMontageWithEventsTask)
-    {
-        DEBUG_LOG(TEXT("No MontageWithEvents Task"));
-        EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
-    }
+    Super::BindEventsAndReadyMontageTask();
+
+    if (!MontageDriver) return;
 
     //ResetCombo 노티파이 이벤트 바인딩
-    PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyResetComboTag);
-    
-    Super::BindEventsAndReadyMontageTask();
+    MontageDriver->BindNotifyEventTag(EventNotifyResetComboTag);
 }
 
 void UNormalAttackAbility::OnTaskNotifyEventsReceived(FGameplayEventData Payload)
@@ -138,18 +93,18 @@ void UNormalAttackAbility::OnEventInputByBuffer(FGameplayEventData Payload)
     if (Payload.OptionalObject && Payload.OptionalObject != this) return;
     
     PlayNextAttack();
-    DEBUG_LOG(TEXT("Attack Recovery End - Play Next Attack"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Attack Recovery End - Play Next Attack"));
 }
 
 void UNormalAttackAbility::OnNotifyResetCombo(FGameplayEventData Payload)
 {
-    DEBUG_LOG(TEXT("Reset Combo"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Reset Combo"));
     ComboCounter = -1; //어빌리티가 살아있는 동안 입력이 들어오면 PlayNext로 0이 되고, 어빌리티가 죽으면 초기화
 }
 
 void UNormalAttackAbility::CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateCancelAbility)
 {
-    DEBUG_LOG(TEXT("AttackAbility Cancelled"));    
+    AP_DEBUG_LOG(LogAPAbility, TEXT("AttackAbility Cancelled"));    
     Super::CancelAbility(Handle, ActorInfo, ActivationInfo, bReplicateCancelAbility);
 }
 
@@ -4,18 +4,9 @@
 #include "Animation/AnimMontage.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "Abilities/Tasks/AbilityTask_WaitGameplayEvent.h"
-#include "GameplayEffect.h"
-#include "GAS/Abilities/Tasks/AbilityTask_PlayMontageWithEvents.h"
-#include "GAS/AbilitySystemComponent/ActionPracticeAbilitySystemComponent.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogRollAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogRollAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Characters/BaseCharacter.h"
+#include "Games/ActionPracticeLog.h"
 
 URollAbility::URollAbility()
 {
@@ -30,20 +21,10 @@ void URollAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, con
 	Super::OnGiveAbility(ActorInfo, Spec);
 
 	EventNotifyInvincibleStartTag = UGameplayTagsSubsystem::GetEventNotifyInvincibleStartTag();
-	EffectInvincibilityDurationTag = UGameplayTagsSubsystem::GetEffectInvincibilityDurationTag();
-	EffectJustRolledDurationTag = UGameplayTagsSubsystem::GetEffectJustRolledDurationTag();
 
 	if (!EventNotifyInvincibleStartTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyInvincibleStartTag is not valid"));
-	}
-	if (!EffectInvincibilityDurationTag.IsValid())
-	{
-		DEBUG_LOG(TEXT("EffectInvincibilityDurationTag is not valid"));
-	}
-	if (!EffectJustRolledDurationTag.IsValid())
-	{
-		DEBUG_LOG(TEXT("EffectJustRolledDurationTag is not valid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EventNotifyInvincibleStartTag is not valid"));
 	}
 }
 
@@ -54,47 +35,31 @@ UAnimMontage* URollAbility::SetMontageToPlayTask()
 
 void URollAbility::BindEventsAndReadyMontageTask()
 {
-	if (!PlayMontageWithEventsTask)
+	if (!MontageDriver)
 	{
-		DEBUG_LOG(TEXT("No MontageWithEvents Task"));
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage Driver"));
+		return;
 	}
 
 	//Invincibility 노티파이 이벤트 바인딩
-	PlayMontageWithEventsTask->BindNotifyEventCallbackWithTag(EventNotifyInvincibleStartTag);
+	MontageDriver->BindNotifyEventTag(EventNotifyInvincibleStartTag);
 	
 	Super::BindEventsAndReadyMontageTask();
 }
 
 void URollAbility::ApplyInvincibilityEffect()
 {
-	if (!InvincibilityEffect)
-	{
-		DEBUG_LOG(TEXT("No InvincibilityEffect set in Blueprint"));
-		return;
-	}
-
-	UActionPracticeAbilitySystemComponent* APASC = GetActionPracticeAbilitySystemComponentFromActorInfo();
-	if (!APASC)
-	{
-		DEBUG_LOG(TEXT("No APASC"));
-		return;
-	}
-
-	// 무적 이펙트 적용
-	const float EffectiveLevel = static_cast<float>(GetAbilityLevel());
-	FGameplayEffectSpecHandle EffectSpec = APASC->CreateGameplayEffectSpec(InvincibilityEffect, EffectiveLevel, this);
-
-	if (!EffectSpec.IsValid())
+	ABaseCharacter* Character = GetBaseCharacterFromActorInfo();
+	if (!Character)
 	{
-		DEBUG_LOG(TEXT("Failed to create Invincibility Effect Spec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No Character"));
 		return;
 	}
 
-	APASC->SetSpecSetByCallerMagnitude(EffectSpec, EffectInvincibilityDurationTag, InvincibilityDuration);
-	InvincibilityEffectHandle = APASC->ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get());
+	//무적 구간 기록, 피격 판정이 대미지 스펙 생성 전에 확인
+	Character->OpenHurtboxWindow(EHurtboxWindow::Invulnerable, InvincibilityDuration);
 
-	DEBUG_LOG(TEXT("Invincibility Effect Applied with Duration: %f"), InvincibilityDuration)
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Invincibility Window Opened with Duration: %f"), InvincibilityDuration)
 }
 
 void URollAbility::OnTaskNotifyEventsReceived(FGameplayEventData Payload)
@@ -106,58 +71,29 @@ void URollAbility::OnTaskNotifyEventsReceived(FGameplayEventData Payload)
 
 void URollAbility::OnEventActionRecoveryEnd(FGameplayEventData Payload)
 {
-	//JustRolled 태그 부여
-	UActionPracticeAbilitySystemComponent* APASC = GetActionPracticeAbilitySystemComponentFromActorInfo();
-	if (!APASC)
-	{
-		DEBUG_LOG(TEXT("No APASC"));
-		Super::OnEventActionRecoveryEnd(Payload);
-		return;
-	}
-
-	if (!JustRolledWindowEffect)
-	{
-		DEBUG_LOG(TEXT("No JustRolledWindowEffect"));
-		Super::OnEventActionRecoveryEnd(Payload);
-		return;
-	}
-
-	const float EffectiveLevel = static_cast<float>(GetAbilityLevel());
-	FGameplayEffectSpecHandle EffectSpec = APASC->CreateGameplayEffectSpec(JustRolledWindowEffect, EffectiveLevel, this);
-
-	if (!EffectSpec.IsValid())
+	//JustRolled 구간 기록
+	if (ABaseCharacter* Character = GetBaseCharacterFromActorInfo())
 	{
-		DEBUG_LOG(TEXT("Failed to create JustRolled Effect Spec"));
-		Super::OnEventActionRecoveryEnd(Payload);
-		return;
+		Character->OpenHurtboxWindow(EHurtboxWindow::JustRolled, JustRolledWindowDuration);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("JustRolled Window Opened"));
 	}
-
-	APASC->SetSpecSetByCallerMagnitude(EffectSpec, EffectJustRolledDurationTag, JustRolledWindowDuration);
-	APASC->ApplyGameplayEffectSpecToSelf(*EffectSpec.Data.Get());
-	DEBUG_LOG(TEXT("JustRolled EffectWindow Attached"));
 	
 	Super::OnEventActionRecoveryEnd(Payload);
 }
 
 void URollAbility::OnNotifyInvincibleStart(FGameplayEventData Payload)
 {
-	DEBUG_LOG(TEXT("Invincible Start - Event Received"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Invincible Start - Event Received"));
 	ApplyInvincibilityEffect();
 }
 
 void URollAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
-	
-	DEBUG_LOG(TEXT("Roll Ability End"));
-	// 무적 이펙트 제거
-	if (InvincibilityEffectHandle.IsValid())
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Roll Ability End"));
+	// 무적 구간 종료
+	if (ABaseCharacter* Character = ActorInfo ? GetBaseCharacterFromActorInfo(ActorInfo) : nullptr)
 	{
-		if (ASC)
-		{
-			ASC->RemoveActiveGameplayEffect(InvincibilityEffectHandle);
-			InvincibilityEffectHandle = FActiveGameplayEffectHandle();
-		}
+		Character->CloseHurtboxWindow(EHurtboxWindow::Invulnerable);
 	}
 	
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -3,19 +3,9 @@
 #include "GAS/AttributeSet/ActionPracticeAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Engine/World.h"
-#include "TimerManager.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "GAS/AbilitySystemComponent/ActionPracticeAbilitySystemComponent.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogSprintAbility, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogSprintAbility, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 USprintAbility::USprintAbility()
 {
@@ -30,7 +20,7 @@ void USprintAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, c
 	EffectSprintSpeedMultiplierTag = UGameplayTagsSubsystem::GetEffectSprintSpeedMultiplierTag();
 	if (!EffectSprintSpeedMultiplierTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EffectSprintSpeedMultiplierTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EffectSprintSpeedMultiplierTag is Invalid"));
 	}
 }
 
@@ -38,7 +28,7 @@ void USprintAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, co
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 	
-	DEBUG_LOG(TEXT("Sprint Ability Activated"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Sprint Ability Activated"));
 	StartSprinting();
 }
 
@@ -70,32 +60,18 @@ void USprintAbility::StartSprinting()
 		return;
 	}
 	
-	//스프린트 조건 확인 타이머
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().SetTimer(
-			SprintCheckTimer,
-			this,
-			&USprintAbility::CheckSprintConditions,
-			0.1f,
-			true
-		);
-	}
+	//스프린트 조건 확인
+	RunLatent(SprintConditionFlow());
 
-	DEBUG_LOG(TEXT("Sprint started"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Sprint started"));
 }
 
 void USprintAbility::StopSprinting()
 {
 	StopSprintEffect();
 	StopStaminaDrainEffect();
-	
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(SprintCheckTimer);
-	}
 
-	DEBUG_LOG(TEXT("Sprint ended"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Sprint ended"));
 }
 
 void USprintAbility::HandleSprinting()
@@ -116,16 +92,16 @@ bool USprintAbility::CanContinueSprinting() const
 	//스테미나 부족
 	if (AttributeSet->GetStamina() <= 0)
 	{
-		DEBUG_LOG(TEXT("CanContinueSprinting Stop - No Stamina"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("CanContinueSprinting Stop - No Stamina"));
 		return false;
 	}
 
 	//이동 입력이 없으면
 	FVector2D MovementInput = Character->GetCurrentMovementInput();
-	DEBUG_LOG(TEXT("Real-time MovementInput: %f"), MovementInput.Size());
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Real-time MovementInput: %f"), MovementInput.Size());
 	if (MovementInput.Size() < 0.1f)
 	{
-		DEBUG_LOG(TEXT("CanContinueSprinting Stop - No Movement Input"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("CanContinueSprinting Stop - No Movement Input"));
 		return false;
 	}
 
@@ -133,7 +109,7 @@ bool USprintAbility::CanContinueSprinting() const
 	UCharacterMovementComponent* MovementComp = Character->GetCharacterMovement();
 	if (MovementComp && MovementComp->IsFalling())
 	{
-		DEBUG_LOG(TEXT("CanContinueSprinting Stop - Is Falling"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("CanContinueSprinting Stop - Is Falling"));
 		return false;
 	}
 
@@ -145,7 +121,7 @@ bool USprintAbility::StartSprintEffect()
 	UActionPracticeAbilitySystemComponent* APASC = GetActionPracticeAbilitySystemComponentFromActorInfo();
 	if (!APASC)
 	{
-		DEBUG_LOG(TEXT("No APASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No APASC"));
 		return false;
 	}
 
@@ -161,7 +137,7 @@ bool USprintAbility::StartSprintEffect()
 
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("failed Sprint GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("failed Sprint GameplayEffectSpec"));
 		return false;
 	}
 
@@ -169,7 +145,7 @@ bool USprintAbility::StartSprintEffect()
 	SprintHandle = APASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 	const bool bApplied = SprintHandle.IsValid();
 
-	DEBUG_LOG(TEXT("SprintEffect applied=%s, SpeedMultiplier=%.2f"), bApplied ? TEXT("true") : TEXT("false"), SprintSpeedMultiplier);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("SprintEffect applied=%s, SpeedMultiplier=%.2f"), bApplied ? TEXT("true") : TEXT("false"), SprintSpeedMultiplier);
 
 	return bApplied;
 }
@@ -179,7 +155,7 @@ void USprintAbility::StopSprintEffect()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("No ASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No ASC"));
 		SprintHandle = FActiveGameplayEffectHandle();
 		return;
 	}
@@ -188,7 +164,7 @@ void USprintAbility::StopSprintEffect()
 	{
 		const int32 Removed = ASC->RemoveActiveGameplayEffect(SprintHandle);
 		SprintHandle = FActiveGameplayEffectHandle();
-		DEBUG_LOG(TEXT("SprintEffect removed=%d"), Removed);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("SprintEffect removed=%d"), Removed);
 	}
 }
 
@@ -197,7 +173,7 @@ bool USprintAbility::StartStaminaDrainEffect()
 	UActionPracticeAbilitySystemComponent* APASC = GetActionPracticeAbilitySystemComponentFromActorInfo();
 	if (!APASC)
 	{
-		DEBUG_LOG(TEXT("No APASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No APASC"));
 		return false;
 	}
 
@@ -213,7 +189,7 @@ bool USprintAbility::StartStaminaDrainEffect()
 
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("failed StaminaDrain GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("failed StaminaDrain GameplayEffectSpec"));
 		return false;
 	}
 
@@ -221,7 +197,7 @@ bool USprintAbility::StartStaminaDrainEffect()
 	StaminaDrainHandle = APASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 	const bool bApplied = StaminaDrainHandle.IsValid();
 
-	DEBUG_LOG(TEXT("StaminaDrainEffect applied=%s, DrainPerPeriod=%.2f"), bApplied ? TEXT("true") : TEXT("false"), StaminaCost);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("StaminaDrainEffect applied=%s, DrainPerPeriod=%.2f"), bApplied ? TEXT("true") : TEXT("false"), StaminaCost);
 
 	return bApplied;
 }
@@ -231,7 +207,7 @@ void USprintAbility::StopStaminaDrainEffect()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("No ASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("No ASC"));
 		StaminaDrainHandle = FActiveGameplayEffectHandle();
 		return;
 	}
@@ -240,33 +216,39 @@ void USprintAbility::StopStaminaDrainEffect()
 	{
 		const int32 Removed = ASC->RemoveActiveGameplayEffect(StaminaDrainHandle);
 		StaminaDrainHandle = FActiveGameplayEffectHandle();
-		DEBUG_LOG(TEXT("StaminaDrainEffect removed=%d"), Removed);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("StaminaDrainEffect removed=%d"), Removed);
 	}
 }
 
-void USprintAbility::CheckSprintConditions()
+FAbilityCoroutine USprintAbility::SprintConditionFlow()
 {
-	if (!CanContinueSprinting())
+	//종료 조건이 바뀔 수 있는 이벤트(스테미나 변경, 이동 모드 변경, 이동 입력 해제)마다 재확인
+	while (CanContinueSprinting())
 	{
-		EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+		co_await AbilityLatent::WaitAny(
+			AbilityLatent::WaitAttributeChange(this, UActionPracticeAttributeSet::GetStaminaAttribute()),
+			AbilityLatent::WaitMovementModeChanged(this),
+			AbilityLatent::WaitMoveInputReleased(this));
 	}
+
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
 }
 
 void USprintAbility::InputReleased(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo)
 {
-	DEBUG_LOG(TEXT("Sprint Input Released - End Ability"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Sprint Input Released - End Ability"));
 	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
 }
 
 void USprintAbility::CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,	const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateCancelAbility)
 {
-	DEBUG_LOG(TEXT("sprint cancel"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("sprint cancel"));
 	Super::CancelAbility(Handle, ActorInfo, ActivationInfo, bReplicateCancelAbility);
 }
 
 void USprintAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
 	StopSprinting();
-	DEBUG_LOG(TEXT("sprint end"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("sprint end"));
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
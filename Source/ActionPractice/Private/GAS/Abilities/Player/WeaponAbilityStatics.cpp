@@ -3,15 +3,7 @@
 #include "GAS/Abilities/Player/ActionPracticeAbility.h"
 #include "Items/Weapon.h"
 #include "Items/WeaponDataAsset.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogWeaponAbilityStatics, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogWeaponAbilityStatics, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 AWeapon* FWeaponAbilityStatics::GetWeaponFromAbility(const UGameplayAbility* Ability, bool bIsLeft)
 {
@@ -24,14 +16,14 @@ const FTaggedAttackData* FWeaponAbilityStatics::GetAttackDataFromAbility(const U
 	AWeapon* Weapon = GetWeaponFromAbility(Ability, false);
 	if (!Weapon)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No Weapon"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No Weapon"))
 		return nullptr;
 	}
 
 	FGameplayTagContainer AssetTag = Ability->GetAssetTags();
 	if (AssetTag.IsEmpty())
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No AssetTags"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No AssetTags"))
 		return nullptr;
 	}
 
@@ -39,13 +31,13 @@ const FTaggedAttackData* FWeaponAbilityStatics::GetAttackDataFromAbility(const U
 	const FTaggedAttackData* WeaponAttackData = Weapon->GetWeaponAttackDataByTag(AssetTag);
 	if (!WeaponAttackData)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No AttackData"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No AttackData"))
 		return nullptr;
 	}
 
 	if (WeaponAttackData->ComboSequence.IsEmpty() || !WeaponAttackData->ComboSequence[0].AttackMontage)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No Attack Montage"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No Attack Montage"))
 		return nullptr;
 	}
 
@@ -57,7 +49,7 @@ const FBlockActionData* FWeaponAbilityStatics::GetBlockDataFromAbility(const UGa
 	AWeapon* Weapon = GetWeaponFromAbility(Ability, true);
 	if (!Weapon)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No Weapon"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No Weapon"))
 		return nullptr;
 	}
 	
@@ -65,14 +57,14 @@ const FBlockActionData* FWeaponAbilityStatics::GetBlockDataFromAbility(const UGa
 	const FBlockActionData* WeaponBlockData = Weapon->GetWeaponBlockData();
 	if (!WeaponBlockData)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No BlockData"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No BlockData"))
 		return nullptr;
 	}
 
 	if (!WeaponBlockData->BlockIdleMontage || !WeaponBlockData->BlockReactionLightMontage ||
 		!WeaponBlockData->BlockReactionMiddleMontage || !WeaponBlockData->BlockReactionHeavyMontage)
 	{
-		DEBUG_LOG(TEXT("WeaponAbilityStatics: No Block Montages"))
+		AP_DEBUG_LOG(LogAPAbility, TEXT("WeaponAbilityStatics: No Block Montages"))
 		return nullptr;
 	}
 
@@ -0,0 +1,225 @@
+#include "GAS/Abilities/Tasks/AbilityMontageDriver.h"
+#include "Abilities/GameplayAbility.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Animation/AnimMontage.h"
+#include "GameFramework/Character.h"
+#include "Games/ActionPracticeLog.h"
+
+void UAbilityMontageDriver::Initialize(UGameplayAbility* InAbility)
+{
+	OwningAbility = InAbility;
+
+	BlendingOutDelegate = FOnMontageBlendingOutStarted::CreateUObject(this, &UAbilityMontageDriver::HandleBlendingOut);
+	MontageEndedDelegate = FOnMontageEnded::CreateUObject(this, &UAbilityMontageDriver::HandleMontageEnded);
+}
+
+#pragma region "Play Functions"
+bool UAbilityMontageDriver::Play(UAnimMontage* Montage, float Rate, FName StartSection, float AnimRootMotionTranslationScale)
+{
+	UGameplayAbility* Ability = OwningAbility.Get();
+	const FGameplayAbilityActorInfo* ActorInfo = Ability ? Ability->GetCurrentActorInfo() : nullptr;
+	UAnimInstance* AnimInstance = ActorInfo ? ActorInfo->GetAnimInstance() : nullptr;
+	if (!AnimInstance || !Montage)
+	{
+		AP_DEBUG_LOG(LogAPAbility, TEXT("MontageDriver: No AnimInstance or Montage"));
+		return false;
+	}
+
+	//ASC가 바뀐 경우에만 노티파이 이벤트 재바인딩
+	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
+	if (ASC != BoundASC.Get())
+	{
+		ReleaseBindings();
+		BoundASC = ASC;
+		for (const FGameplayTag& EventTag : EventTagsToReceive)
+		{
+			BindEventCallback(EventTag);
+		}
+	}
+
+	//이전 몽타주는 콜백을 떼어낸 뒤 정지, 전환으로 인한 Interrupted는 어빌리티에 전달되지 않음
+	if (bPlaying)
+	{
+		ClearMontageCallbacks();
+		if (CurrentMontage)
+		{
+			AnimInstance->Montage_Stop(CurrentMontage->BlendOut.GetBlendTime(), CurrentMontage);
+		}
+	}
+
+	UAbilitySystemGlobals::NonShipping_ApplyGlobalAbilityScaler_Rate(Rate);
+	const float PlayLength = AnimInstance->Montage_Play(Montage, Rate);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("MontageDriver: Play %s (%.2f), switched=%s"), *Montage->GetName(), PlayLength, bPlaying ? TEXT("true") : TEXT("false"));
+
+	if (PlayLength <= 0.0f)
+	{
+		bPlaying = false;
+		CurrentMontage = nullptr;
+		return false;
+	}
+
+	if (StartSection != NAME_None)
+	{
+		AnimInstance->Montage_JumpToSection(StartSection, Montage);
+	}
+
+	CurrentMontage = Montage;
+	CurrentAnimInstance = AnimInstance;
+	bPlaying = true;
+
+	//델리게이트는 생성해 둔 것을 새 몽타주 인스턴스에 지정만 함
+	AnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, Montage);
+	AnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, Montage);
+
+	SetRootMotionTranslationScale(AnimRootMotionTranslationScale);
+	return true;
+}
+
+bool UAbilityMontageDriver::JumpToSection(FName SectionName)
+{
+	UAnimInstance* AnimInstance = CurrentAnimInstance.Get();
+	if (!bPlaying || !AnimInstance || !CurrentMontage) return false;
+
+	AnimInstance->Montage_JumpToSection(SectionName, CurrentMontage);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("MontageDriver: Jump %s -> %s"), *CurrentMontage->GetName(), *SectionName.ToString());
+	return true;
+}
+
+void UAbilityMontageDriver::Stop()
+{
+	if (bPlaying)
+	{
+		ClearMontageCallbacks();
+
+		UAnimInstance* AnimInstance = CurrentAnimInstance.Get();
+		if (bStopMontageWhenAbilityCancelled && AnimInstance && CurrentMontage)
+		{
+			AnimInstance->Montage_Stop(CurrentMontage->BlendOut.GetBlendTime(), CurrentMontage);
+		}
+	}
+
+	bPlaying = false;
+	bStopMontageWhenAbilityCancelled = false;
+	CurrentMontage = nullptr;
+	CurrentAnimInstance.Reset();
+}
+
+void UAbilityMontageDriver::ClearMontageCallbacks()
+{
+	UAnimInstance* AnimInstance = CurrentAnimInstance.Get();
+	if (!AnimInstance || !CurrentMontage) return;
+
+	FOnMontageBlendingOutStarted EmptyBlendDelegate;
+	AnimInstance->Montage_SetBlendingOutDelegate(EmptyBlendDelegate, CurrentMontage);
+
+	FOnMontageEnded EmptyEndDelegate;
+	AnimInstance->Montage_SetEndDelegate(EmptyEndDelegate, CurrentMontage);
+}
+
+void UAbilityMontageDriver::SetRootMotionTranslationScale(float Scale) const
+{
+	const UGameplayAbility* Ability = OwningAbility.Get();
+	const FGameplayAbilityActorInfo* ActorInfo = Ability ? Ability->GetCurrentActorInfo() : nullptr;
+	ACharacter* Character = ActorInfo ? Cast<ACharacter>(ActorInfo->AvatarActor.Get()) : nullptr;
+
+	if (Character && (Character->GetLocalRole() == ROLE_Authority ||
+		(Character->GetLocalRole() == ROLE_AutonomousProxy &&
+		 Ability->GetNetExecutionPolicy() == EGameplayAbilityNetExecutionPolicy::LocalPredicted)))
+	{
+		Character->SetAnimRootMotionTranslationScale(Scale);
+	}
+}
+#pragma endregion
+
+#pragma region "Event Binding Functions"
+void UAbilityMontageDriver::BindNotifyEventTag(const FGameplayTag& EventTag)
+{
+	if (!EventTag.IsValid() || EventTagsToReceive.HasTagExact(EventTag)) return;
+
+	EventTagsToReceive.AddTag(EventTag);
+
+	if (BoundASC.IsValid())
+	{
+		BindEventCallback(EventTag);
+	}
+}
+
+void UAbilityMontageDriver::BindEventCallback(const FGameplayTag& EventTag)
+{
+	UAbilitySystemComponent* ASC = BoundASC.Get();
+	if (!ASC) return;
+
+	const FDelegateHandle Handle = ASC->GenericGameplayEventCallbacks.FindOrAdd(EventTag)
+		.AddUObject(this, &UAbilityMontageDriver::HandleNotifyEvent);
+
+	EventHandles.Emplace(EventTag, Handle);
+	AP_DEBUG_LOG(LogAPAbility, TEXT("MontageDriver: Event Callback Bound - Tag: %s"), *EventTag.ToString());
+}
+
+void UAbilityMontageDriver::ReleaseBindings()
+{
+	if (UAbilitySystemComponent* ASC = BoundASC.Get())
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Pair : EventHandles)
+		{
+			if (FGameplayEventMulticastDelegate* Delegate = ASC->GenericGameplayEventCallbacks.Find(Pair.Key))
+			{
+				Delegate->Remove(Pair.Value);
+			}
+		}
+	}
+
+	EventHandles.Reset();
+	BoundASC.Reset();
+}
+#pragma endregion
+
+#pragma region "Event Calling Functions"
+bool UAbilityMontageDriver::ShouldBroadcast() const
+{
+	const UGameplayAbility* Ability = OwningAbility.Get();
+	return Ability && Ability->IsActive();
+}
+
+void UAbilityMontageDriver::HandleBlendingOut(UAnimMontage* Montage, bool bInterrupted)
+{
+	if (Montage != CurrentMontage) return;
+
+	UGameplayAbility* Ability = OwningAbility.Get();
+	UAbilitySystemComponent* ASC = BoundASC.Get();
+	if (Ability && ASC && Ability->GetCurrentMontage() == CurrentMontage)
+	{
+		ASC->ClearAnimatingAbility(Ability);
+		SetRootMotionTranslationScale(1.0f);
+	}
+}
+
+void UAbilityMontageDriver::HandleMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+{
+	AP_DEBUG_LOG(LogAPAbility, TEXT("MontageDriver: Ended %s, Interrupted: %s"),
+		*GetNameSafe(Montage), bInterrupted ? TEXT("True") : TEXT("False"));
+
+	if (!bPlaying || Montage != CurrentMontage) return;
+
+	bPlaying = false;
+	if (!ShouldBroadcast()) return;
+
+	//콜백 안에서 다음 몽타주를 재생할 수 있으므로 상태 정리 후 호출
+	if (bInterrupted)
+	{
+		OnMontageInterrupted.ExecuteIfBound();
+	}
+	else
+	{
+		OnMontageCompleted.ExecuteIfBound();
+	}
+}
+
+void UAbilityMontageDriver::HandleNotifyEvent(const FGameplayEventData* Payload)
+{
+	if (!Payload || !bPlaying || !ShouldBroadcast()) return;
+
+	OnNotifyEventReceived.ExecuteIfBound(*Payload);
+}
+#pragma endregion
@@ -5,15 +5,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GAS/GameplayTagsSubsystem.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogAbilityTask_PlayMontageWithEvents, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogAbilityTask_PlayMontageWithEvents, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UAbilityTask_PlayMontageWithEvents::UAbilityTask_PlayMontageWithEvents(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -47,7 +39,7 @@ void UAbilityTask_PlayMontageWithEvents::Activate()
         return;
     }
     
-    DEBUG_LOG(TEXT("Task Activate"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Task Activate"));
     
     bool bPlayedMontage = false;
     
@@ -87,13 +79,13 @@ void UAbilityTask_PlayMontageWithEvents::PlayMontage()
     
     if (!MontageToPlay)
     {
-        DEBUG_LOG(TEXT("Invalid montage"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Invalid montage"));
         EndTask();
         return;
     }
     
     float PlayLength = AnimInstance->Montage_Play(MontageToPlay, Rate);
-    DEBUG_LOG(TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
 
     BindMontageCallbacks();
 
@@ -111,7 +103,7 @@ void UAbilityTask_PlayMontageWithEvents::ChangeMontageAndPlay(UAnimMontage* NewM
     UAnimInstance* AnimInstance = Ability->GetCurrentActorInfo()->GetAnimInstance();
     if (!NewMontage || !IsActive() || !AnimInstance)
     {
-        DEBUG_LOG(TEXT("No Montage or AnimInstance or Task"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("No Montage or AnimInstance or Task"));
         //return;
     }
     
@@ -121,7 +113,7 @@ void UAbilityTask_PlayMontageWithEvents::ChangeMontageAndPlay(UAnimMontage* NewM
 
     MontageToPlay = NewMontage;
     float PlayLength = AnimInstance->Montage_Play(MontageToPlay, Rate);
-    DEBUG_LOG(TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
     
     if (PlayLength > 0.0f)
     {
@@ -151,7 +143,7 @@ void UAbilityTask_PlayMontageWithEvents::StopPlayingMontage()
 #pragma region "Event Calling Functions"
 void UAbilityTask_PlayMontageWithEvents::OnMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted)
 {
-    DEBUG_LOG(TEXT("OnMontageBlendingOut Called - Montage: %s, Interrupted: %s"), 
+    AP_DEBUG_LOG(LogAPAbility, TEXT("OnMontageBlendingOut Called - Montage: %s, Interrupted: %s"), 
            Montage ? *Montage->GetName() : TEXT("None"), 
            bInterrupted ? TEXT("True") : TEXT("False"));
            
@@ -179,7 +171,7 @@ void UAbilityTask_PlayMontageWithEvents::OnMontageBlendingOut(UAnimMontage* Mont
 
 void UAbilityTask_PlayMontageWithEvents::OnMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
-    DEBUG_LOG(TEXT("OnMontageEnded Called - Montage: %s, Interrupted: %s"), 
+    AP_DEBUG_LOG(LogAPAbility, TEXT("OnMontageEnded Called - Montage: %s, Interrupted: %s"), 
            Montage ? *Montage->GetName() : TEXT("None"), 
            bInterrupted ? TEXT("True") : TEXT("False"));
            
@@ -234,7 +226,7 @@ void UAbilityTask_PlayMontageWithEvents::BindNotifyEventCallbackWithTag(FGamepla
 
     //Map에 핸들 저장
     EventHandles.Add(EventTag, Handle);
-    DEBUG_LOG(TEXT("Event Callback Bound - Tag: %s"), *EventTag.ToString());
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Event Callback Bound - Tag: %s"), *EventTag.ToString());
 }
 
 void UAbilityTask_PlayMontageWithEvents::UnbindNotifyEventCallbackWithTag(FGameplayTag EventTag)
@@ -249,7 +241,7 @@ void UAbilityTask_PlayMontageWithEvents::UnbindNotifyEventCallbackWithTag(FGamep
     if (EventHandles.RemoveAndCopyValue(EventTag, Handle) && Handle.IsValid())
     {
         AbilitySystemComponent->GenericGameplayEventCallbacks.FindOrAdd(EventTag).Remove(Handle);
-        DEBUG_LOG(TEXT("Event Callback Unbound - Tag: %s"), *EventTag.ToString());
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Event Callback Unbound - Tag: %s"), *EventTag.ToString());
     }
 
     EventTagsToReceive.RemoveTag(EventTag);
@@ -277,7 +269,7 @@ void UAbilityTask_PlayMontageWithEvents::BindAllEventCallbacks()
 
         //Map에 핸들 저장
         EventHandles.Add(Tag, Handle);
-        DEBUG_LOG(TEXT("All Event Callback Bound - Tag: %s"), *Tag.ToString());
+        AP_DEBUG_LOG(LogAPAbility, TEXT("All Event Callback Bound - Tag: %s"), *Tag.ToString());
     }
 }
 
@@ -297,7 +289,7 @@ void UAbilityTask_PlayMontageWithEvents::UnbindAllEventCallbacks()
         if (Handle.IsValid())
         {
             AbilitySystemComponent->GenericGameplayEventCallbacks.FindOrAdd(Tag).Remove(Handle);
-            DEBUG_LOG(TEXT("All Event Callback Unbound - Tag: %s"), *Tag.ToString());
+            AP_DEBUG_LOG(LogAPAbility, TEXT("All Event Callback Unbound - Tag: %s"), *Tag.ToString());
         }
     }
 
@@ -316,11 +308,11 @@ void UAbilityTask_PlayMontageWithEvents::BindMontageCallbacks()
 
     OnBlendingOutInternal = FOnMontageBlendingOutStarted::CreateUObject(this, &UAbilityTask_PlayMontageWithEvents::OnMontageBlendingOut);
     AnimInstance->Montage_SetBlendingOutDelegate(OnBlendingOutInternal, MontageToPlay);
-    DEBUG_LOG(TEXT("BlendingOutDelegate Bound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("BlendingOutDelegate Bound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
 
     OnMontageEndedInternal = FOnMontageEnded::CreateUObject(this, &UAbilityTask_PlayMontageWithEvents::OnMontageEnded);
     AnimInstance->Montage_SetEndDelegate(OnMontageEndedInternal, MontageToPlay);
-    DEBUG_LOG(TEXT("MontageEndedDelegate Bound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("MontageEndedDelegate Bound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
 }
 
 void UAbilityTask_PlayMontageWithEvents::UnbindMontageCallbacks()
@@ -339,7 +331,7 @@ void UAbilityTask_PlayMontageWithEvents::UnbindMontageCallbacks()
             FOnMontageBlendingOutStarted EmptyBlendDelegate;
             AnimInstance->Montage_SetBlendingOutDelegate(EmptyBlendDelegate, MontageToPlay);
             OnBlendingOutInternal.Unbind();
-            DEBUG_LOG(TEXT("BlendingOutDelegate Unbound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+            AP_DEBUG_LOG(LogAPAbility, TEXT("BlendingOutDelegate Unbound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
         }
         
         if (OnMontageEndedInternal.IsBound())
@@ -347,7 +339,7 @@ void UAbilityTask_PlayMontageWithEvents::UnbindMontageCallbacks()
             FOnMontageEnded EmptyEndDelegate;
             AnimInstance->Montage_SetEndDelegate(EmptyEndDelegate, MontageToPlay);
             OnMontageEndedInternal.Unbind();
-            DEBUG_LOG(TEXT("MontageEndedDelegate Unbound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
+            AP_DEBUG_LOG(LogAPAbility, TEXT("MontageEndedDelegate Unbound Successfully, Montage Name: %s") ,MontageToPlay ? *MontageToPlay->GetName() : TEXT("NULL"));
         }
     }
 }
@@ -355,7 +347,7 @@ void UAbilityTask_PlayMontageWithEvents::UnbindMontageCallbacks()
 
 void UAbilityTask_PlayMontageWithEvents::OnDestroy(bool AbilityEnded)
 {
-    DEBUG_LOG(TEXT("Montage With Events Task Destroyed"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Montage With Events Task Destroyed"));
 
     if (bStopMontageWhenAbilityCancelled)
     {
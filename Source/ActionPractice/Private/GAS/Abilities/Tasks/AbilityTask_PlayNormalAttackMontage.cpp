@@ -5,16 +5,9 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GAS/GameplayTagsSubsystem.h"
+#include "Games/ActionPracticeLog.h"
 
 // 디버그 로그 활성화/비활성화 (0: 비활성화, 1: 활성화)
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogAbilityTask_PlayNormalAttackMontage, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogAbilityTask_PlayNormalAttackMontage, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
 
 UAbilityTask_PlayNormalAttackMontage::UAbilityTask_PlayNormalAttackMontage(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -58,7 +51,7 @@ void UAbilityTask_PlayNormalAttackMontage::Activate()
         return;
     }
     
-    DEBUG_LOG(TEXT("Task Activate"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Task Activate"));
     
     bool bPlayedMontage = false;
     
@@ -105,7 +98,7 @@ void UAbilityTask_PlayNormalAttackMontage::PlayAttackMontage()
     // 몽타주 배열 검증
     if (MontagesToPlay.IsEmpty() || ComboCounter >= MontagesToPlay.Num())
     {
-        DEBUG_LOG(TEXT("Invalid montage array or combo counter"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Invalid montage array or combo counter"));
         EndTask();
         return;
     }
@@ -126,14 +119,14 @@ void UAbilityTask_PlayNormalAttackMontage::PlayAttackMontage()
             AnimInstance->Montage_SetEndDelegate(EmptyEndDelegate, PreviousMontage);
             MontageEndedDelegate.Unbind();
         }
-        DEBUG_LOG(TEXT("Cleared delegates for previous montage: %s"), *PreviousMontage->GetName());
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Cleared delegates for previous montage: %s"), *PreviousMontage->GetName());
     }
     
     // 현재 콤보에 해당하는 몽타주 로드
     CurrentMontage = MontagesToPlay[ComboCounter].LoadSynchronous();
     if (!CurrentMontage)
     {
-        DEBUG_LOG(TEXT("Failed to load montage at index %d"), ComboCounter);
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to load montage at index %d"), ComboCounter);
         EndTask();
         return;
     }
@@ -149,17 +142,17 @@ void UAbilityTask_PlayNormalAttackMontage::PlayAttackMontage()
     }
     
     float PlayLength = AnimInstance->Montage_Play(CurrentMontage, Rate);
-    DEBUG_LOG(TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, CurrentMontage ? *CurrentMontage->GetName() : TEXT("NULL"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Montage Play Result: %f, Montage Name: %s"), PlayLength, CurrentMontage ? *CurrentMontage->GetName() : TEXT("NULL"));
 
     // 블렌드 아웃 델리게이트 바인딩
     BlendingOutDelegate = FOnMontageBlendingOutStarted::CreateUObject(this, &UAbilityTask_PlayNormalAttackMontage::OnMontageBlendingOut);
     AnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, CurrentMontage);
-    DEBUG_LOG(TEXT("BlendingOutDelegate Bound Successfully"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("BlendingOutDelegate Bound Successfully"));
 
     // 몽타주 종료 델리게이트 바인딩
     MontageEndedDelegate = FOnMontageEnded::CreateUObject(this, &UAbilityTask_PlayNormalAttackMontage::OnMontageEnded);
     AnimInstance->Montage_SetEndDelegate(MontageEndedDelegate, CurrentMontage);
-    DEBUG_LOG(TEXT("MontageEndedDelegate Bound Successfully"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("MontageEndedDelegate Bound Successfully"));
 
     ACharacter* Character = Cast<ACharacter>(GetAvatarActor());
     if (Character && (Character->GetLocalRole() == ROLE_Authority ||
@@ -175,7 +168,7 @@ void UAbilityTask_PlayNormalAttackMontage::PlayAttackMontage()
         OnComboPerformed.Broadcast();
     }
     
-    DEBUG_LOG(TEXT("Attack Monatage First Played"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Attack Monatage First Played"));
 }
 
 void UAbilityTask_PlayNormalAttackMontage::PlayNextAttackCombo()
@@ -184,7 +177,7 @@ void UAbilityTask_PlayNormalAttackMontage::PlayNextAttackCombo()
     
     if (ComboCounter >= MaxComboCount)
     {
-        DEBUG_LOG(TEXT("Max combo reached - ending task"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Max combo reached - ending task"));
         EndTask();
         return;
     }
@@ -192,7 +185,7 @@ void UAbilityTask_PlayNormalAttackMontage::PlayNextAttackCombo()
     // 몽타주 전환 플래그 설정 (델리게이트에서 OnInterrupted 무시하기 위함)
     bIsTransitioningToNextCombo = true;
     
-    DEBUG_LOG(TEXT("Starting combo %d transition"), ComboCounter + 1);
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Starting combo %d transition"), ComboCounter + 1);
     
     // PlayAttackMontage를 재사용하여 다음 몽타주 재생
     PlayAttackMontage();
@@ -206,14 +199,14 @@ void UAbilityTask_PlayNormalAttackMontage::CheckComboInputPreseed() //어빌리
         bComboInputSaved = true;
         bCanComboSave = false;
         
-        DEBUG_LOG(TEXT("Combo Saved"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Combo Saved"));
     }
     // 3-2. ActionRecoveryEnd 이후 구간에서 입력이 들어오면 콤보 실행
     else if (bIsInCancellableRecovery)
     {
         PlayNextAttackCombo();
 
-        DEBUG_LOG(TEXT("Combo Played After Recovery"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Combo Played After Recovery"));
     }
 }
 
@@ -234,7 +227,7 @@ void UAbilityTask_PlayNormalAttackMontage::HandleActionRecoveryEndEvent(const FG
     {
         PlayNextAttackCombo();
 
-        DEBUG_LOG(TEXT("Combo Played With Saved"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Combo Played With Saved"));
     }
     // 3-2. 저장한 행동이 없을 경우
     else
@@ -246,7 +239,7 @@ void UAbilityTask_PlayNormalAttackMontage::HandleActionRecoveryEndEvent(const FG
             {
                 AbilitySystemComponent->RemoveLooseGameplayTag(UGameplayTagsSubsystem::GetStateRecoveringTag());
             }
-            DEBUG_LOG(TEXT("Can ABP Interrupt Attack Montage"));
+            AP_DEBUG_LOG(LogAPAbility, TEXT("Can ABP Interrupt Attack Montage"));
         }
  
         bIsInCancellableRecovery = true;
@@ -343,7 +336,7 @@ void UAbilityTask_PlayNormalAttackMontage::StopPlayingMontage()
 
 void UAbilityTask_PlayNormalAttackMontage::OnMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted)
 {
-    DEBUG_LOG(TEXT("OnMontageBlendingOut Called - Montage: %s, Interrupted: %s"), 
+    AP_DEBUG_LOG(LogAPAbility, TEXT("OnMontageBlendingOut Called - Montage: %s, Interrupted: %s"), 
            Montage ? *Montage->GetName() : TEXT("None"), 
            bInterrupted ? TEXT("True") : TEXT("False"));
            
@@ -382,14 +375,14 @@ void UAbilityTask_PlayNormalAttackMontage::OnMontageBlendingOut(UAnimMontage* Mo
 
 void UAbilityTask_PlayNormalAttackMontage::OnMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
-    DEBUG_LOG(TEXT("OnMontageEnded Called - Montage: %s, Interrupted: %s"), 
+    AP_DEBUG_LOG(LogAPAbility, TEXT("OnMontageEnded Called - Montage: %s, Interrupted: %s"), 
            Montage ? *Montage->GetName() : TEXT("None"), 
            bInterrupted ? TEXT("True") : TEXT("False"));
     
     // 콤보 전환으로 인한 종료인지 확인
     if (bIsTransitioningToNextCombo && bInterrupted)
     {
-        DEBUG_LOG(TEXT("Combo transition detected - not ending task"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("Combo transition detected - not ending task"));
         bIsTransitioningToNextCombo = false; // 플래그 리셋
         return; // 콤보 진행 중이므로 태스크 종료하지 않음
     }
@@ -426,7 +419,7 @@ void UAbilityTask_PlayNormalAttackMontage::ExternalCancel()
 
 void UAbilityTask_PlayNormalAttackMontage::OnDestroy(bool AbilityEnded)
 {
-    DEBUG_LOG(TEXT("Normal Attack Task Destroyed"));
+    AP_DEBUG_LOG(LogAPAbility, TEXT("Normal Attack Task Destroyed"));
 
     // 몽타주 정지
     if (bStopMontageWhenAbilityCancelled)
@@ -466,7 +459,7 @@ void UAbilityTask_PlayNormalAttackMontage::OnDestroy(bool AbilityEnded)
         {
             AbilitySystemComponent->RemoveLooseGameplayTag(UGameplayTagsSubsystem::GetStateRecoveringTag());
         }
-        DEBUG_LOG(TEXT("All StateRecovering tags removed"));
+        AP_DEBUG_LOG(LogAPAbility, TEXT("All StateRecovering tags removed"));
     }
     
     bCanComboSave = false;
@@ -7,15 +7,7 @@
 #include "Items/Weapon.h"
 #include "Items/WeaponDataAsset.h"
 #include "Items/AttackData.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseAbilitySystemComponent, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseAbilitySystemComponent, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UActionPracticeAbilitySystemComponent::UActionPracticeAbilitySystemComponent()
 {
@@ -33,13 +25,13 @@ void UActionPracticeAbilitySystemComponent::BeginPlay()
 	EffectStaminaRegenBlockDurationTag = UGameplayTagsSubsystem::GetEffectStaminaRegenBlockDurationTag();
 	if (!EffectStaminaRegenBlockDurationTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EffectStaminaRegenBlockDurationTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("EffectStaminaRegenBlockDurationTag is Invalid"));
 	}
 
 	StateAbilityBlockingTag = UGameplayTagsSubsystem::GetStateAbilityBlockingTag();
 	if (!StateAbilityBlockingTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("StateAbilityBlockingTag is Invalid"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("StateAbilityBlockingTag is Invalid"));
 	}
 }
 
@@ -93,7 +85,7 @@ void UActionPracticeAbilitySystemComponent::CalculateAndSetAttributes(AActor* So
 			APAttributeSet->SetPoise(FMath::Clamp(OldPoise - FinalAttackData.PoiseDamage, 0.0f, APAttributeSet->GetMaxPoise()));
 		}
 
-		DEBUG_LOG(TEXT("Blocked: Damage=%.1f, FinalDamage=%.1f, DamageReduction=%.1f%%, Health=%.1f/%.1f"),
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Blocked: Damage=%.1f, FinalDamage=%.1f, DamageReduction=%.1f%%, Health=%.1f/%.1f"),
 			FinalAttackData.FinalDamage, FinalDamage, DamageReduction,
 			APAttributeSet->GetHealth(), APAttributeSet->GetMaxHealth());
 		return;
@@ -111,7 +103,7 @@ void UActionPracticeAbilitySystemComponent::PrepareHitReactionEventData(FGamepla
 	if (bBlockedLastAttack)
 	{
 		OutEventData.TargetTags.AddTag(StateAbilityBlockingTag);
-		DEBUG_LOG(TEXT("Block Reaction triggered"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Block Reaction triggered"));
 	}
 }
 
@@ -124,8 +116,8 @@ void UActionPracticeAbilitySystemComponent::CheckBlockSuccess(AActor* SourceActo
 		return;
 	}
 
-	//방어 태그 확인
-	const bool bIsBlocking = HasMatchingGameplayTag(StateAbilityBlockingTag);
+	//방어 구간 먼저 확인, 방어 반응 중 부여되는 태그는 그 다음
+	const bool bIsBlocking = CachedAPCharacter->IsHurtboxWindowActive(EHurtboxWindow::Guard) || HasMatchingGameplayTag(StateAbilityBlockingTag);
 
 	if (!bIsBlocking || !CachedAPCharacter->GetLeftWeapon())
 	{
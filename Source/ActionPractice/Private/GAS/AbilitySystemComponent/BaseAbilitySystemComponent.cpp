@@ -6,15 +6,8 @@
 #include "GameplayEffect.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "GAS/AttributeSet/BaseAttributeSet.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseAbilitySystemComponent, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseAbilitySystemComponent, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/CombatStats.h"
+#include "Games/ActionPracticeLog.h"
 
 UBaseAbilitySystemComponent::UBaseAbilitySystemComponent()
 {
@@ -61,7 +54,7 @@ FGameplayEffectSpecHandle UBaseAbilitySystemComponent::CreateGameplayEffectSpec(
 {
 	if (!GameplayEffectClass)
 	{
-		DEBUG_LOG(TEXT("GameplayEffectClass is null"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("GameplayEffectClass is null"));
 		return FGameplayEffectSpecHandle();
 	}
 
@@ -77,7 +70,7 @@ FGameplayEffectSpecHandle UBaseAbilitySystemComponent::CreateGameplayEffectSpec(
 
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("Failed to create GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to create GameplayEffectSpec"));
 		return FGameplayEffectSpecHandle();
 	}
 
@@ -95,7 +88,7 @@ FGameplayEffectSpecHandle UBaseAbilitySystemComponent::CreateAttackGameplayEffec
 
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("Failed to create Attack GameplayEffectSpec"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to create Attack GameplayEffectSpec"));
 		return FGameplayEffectSpecHandle();
 	}
 
@@ -113,7 +106,7 @@ FGameplayEffectSpecHandle UBaseAbilitySystemComponent::CreateAttackGameplayEffec
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("Failed to cast to FActionPracticeGameplayEffectContext"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Failed to cast to FActionPracticeGameplayEffectContext"));
 	}
 
 	return SpecHandle;
@@ -123,13 +116,13 @@ void UBaseAbilitySystemComponent::SetSpecSetByCallerMagnitude(FGameplayEffectSpe
 {
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("Invalid SpecHandle"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Invalid SpecHandle"));
 		return;
 	}
 
 	if (!Tag.IsValid())
 	{
-		DEBUG_LOG(TEXT("Invalid Tag"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Invalid Tag"));
 		return;
 	}
 
@@ -140,7 +133,7 @@ void UBaseAbilitySystemComponent::SetSpecSetByCallerMagnitudes(FGameplayEffectSp
 {
 	if (!SpecHandle.IsValid())
 	{
-		DEBUG_LOG(TEXT("Invalid SpecHandle"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Invalid SpecHandle"));
 		return;
 	}
 
@@ -155,6 +148,9 @@ void UBaseAbilitySystemComponent::SetSpecSetByCallerMagnitudes(FGameplayEffectSp
 
 void UBaseAbilitySystemComponent::OnDamaged(AActor* SourceActor, const FFinalAttackData& FinalAttackData)
 {
+	COMBAT_SCOPE(STAT_CombatDamageResolution);
+	INC_DWORD_STAT(STAT_CombatDamageResolved);
+
 	//방어력 계산 및 Attribute 설정
 	CalculateAndSetAttributes(SourceActor, FinalAttackData);
 
@@ -192,7 +188,7 @@ void UBaseAbilitySystemComponent::CalculateAndSetAttributes(AActor* SourceActor,
 		BaseAttributeSet->SetPoise(FMath::Clamp(OldPoise - FinalAttackData.PoiseDamage, 0.0f, BaseAttributeSet->GetMaxPoise()));
 	}
 
-	DEBUG_LOG(TEXT("OnDamaged: Damage=%.1f, FinalDamage=%.1f, Health=%.1f/%.1f, Poise=%.1f/%.1f"),
+	AP_DEBUG_LOG(LogAPAbility, TEXT("OnDamaged: Damage=%.1f, FinalDamage=%.1f, Health=%.1f/%.1f, Poise=%.1f/%.1f"),
 		FinalAttackData.FinalDamage, FinalDamage,
 		BaseAttributeSet->GetHealth(), BaseAttributeSet->GetMaxHealth(),
 		BaseAttributeSet->GetPoise(), BaseAttributeSet->GetMaxPoise());
@@ -215,7 +211,7 @@ void UBaseAbilitySystemComponent::HandleOnDamagedResolved(AActor* SourceActor, c
 	//죽음 체크
 	if (BaseAttributeSet->GetHealth() <= 0.0f)
 	{
-		DEBUG_LOG(TEXT("HandleOnDamagedResolved: Character died"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("HandleOnDamagedResolved: Character died"));
 		//TODO: 죽음 처리
 		return;
 	}
@@ -223,7 +219,7 @@ void UBaseAbilitySystemComponent::HandleOnDamagedResolved(AActor* SourceActor, c
 	//포이즈 브레이크 체크
 	if (BaseAttributeSet->GetPoise() <= 0.0f)
 	{
-		DEBUG_LOG(TEXT("HandleOnDamagedResolved: Poise broken, Poise=%.1f"), BaseAttributeSet->GetPoise());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("HandleOnDamagedResolved: Poise broken, Poise=%.1f"), BaseAttributeSet->GetPoise());
 
 		//HitReaction Ability 활성화
 		if (AbilityHitReactionTag.IsValid())
@@ -249,12 +245,12 @@ void UBaseAbilitySystemComponent::HandleOnDamagedResolved(AActor* SourceActor, c
 						&EventData,
 						*this
 					);
-					DEBUG_LOG(TEXT("HitReaction Ability activated with Poise=%.1f"), EventData.EventMagnitude);
+					AP_DEBUG_LOG(LogAPAbility, TEXT("HitReaction Ability activated with Poise=%.1f"), EventData.EventMagnitude);
 				}
 			}
 			else
 			{
-				DEBUG_LOG(TEXT("HitReaction Ability not found"));
+				AP_DEBUG_LOG(LogAPAbility, TEXT("HitReaction Ability not found"));
 			}
 		}
 	}
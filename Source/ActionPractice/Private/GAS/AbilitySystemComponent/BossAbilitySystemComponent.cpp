@@ -4,15 +4,6 @@
 #include "Characters/BossCharacter.h"
 #include "GAS/AttributeSet/BossAttributeSet.h"
 
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossAbilitySystemComponent, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogBossAbilitySystemComponent, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
-
 UBossAbilitySystemComponent::UBossAbilitySystemComponent()
 {
 }
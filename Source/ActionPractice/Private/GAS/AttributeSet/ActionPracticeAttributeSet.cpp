@@ -3,15 +3,6 @@
 #include "GameplayEffectExtension.h"
 #include "Net/UnrealNetwork.h"
 
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogPlayerStatsWidget, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogPlayerStatsWidget, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
-
 UActionPracticeAttributeSet::UActionPracticeAttributeSet()
 {
 	InitStrength(10.0f);
@@ -22,8 +13,17 @@ void UActionPracticeAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimePro
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UActionPracticeAttributeSet, Strength, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UActionPracticeAttributeSet, Dexterity, COND_None, REPNOTIFY_Always);
+	if (!IsCompactReplicationEnabled())
+	{
+		DOREPLIFETIME_CONDITION_NOTIFY(UActionPracticeAttributeSet, Strength, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UActionPracticeAttributeSet, Dexterity, COND_None, REPNOTIFY_Always);
+		return;
+	}
+
+	//능력치는 Owner만 필요
+	const FDoRepLifetimeParams OwnerOnlyParams = MakeAttributeRepParams(true);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UActionPracticeAttributeSet, Strength, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UActionPracticeAttributeSet, Dexterity, OwnerOnlyParams);
 }
 
 void UActionPracticeAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -2,19 +2,37 @@
 #include "GameplayEffect.h"
 #include "GameplayEffectExtension.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GAS/Effects/ActionPracticeGameplayEffectContext.h"
 #include "Items/AttackData.h"
+#include "Games/ActionPracticeLog.h"
 
-#define ENABLE_DEBUG_LOG 0
+namespace AttributeReplication
+{
+	//0: 기존 방식 (모든 값 COND_None), 1: Push Model + Owner 조건 + 임계값 + 양자화
+	static int32 CompactAttributeReplication = 1;
+	static FAutoConsoleVariableRef CVarCompactAttributeReplication(
+		TEXT("ap.Net.CompactAttributeReplication"),
+		CompactAttributeReplication,
+		TEXT("0: replicate every attribute to everyone on change. 1: push model, owner-only private stats, change thresholds and quantized percents. Read when replication layouts are built, set it on the command line or in DefaultEngine.ini."),
+		ECVF_ReadOnly);
+
+	//연속 변화 값(지속 소모/회복)의 복제 임계값
+	constexpr float ContinuousValueThreshold = 1.0f;
+
+	//임계값 미만 변화가 생략된 뒤 마지막 값을 보내기까지의 시간 (회복/소모가 멈춘 경우)
+	constexpr float ThresholdFlushDelay = 0.25f;
+}
 
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBaseAttributeSet, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBaseAttributeSet, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+bool UBaseAttributeSet::IsCompactReplicationEnabled()
+{
+	return AttributeReplication::CompactAttributeReplication != 0;
+}
 
 UBaseAttributeSet::UBaseAttributeSet()
 {
@@ -34,16 +52,56 @@ void UBaseAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Stamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxStamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, StaminaRegenRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Defense, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Poise, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxPoise, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, PoiseRegenRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MovementSpeed, COND_None, REPNOTIFY_Always);
+	if (!IsCompactReplicationEnabled())
+	{
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Health, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Stamina, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxStamina, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, StaminaRegenRate, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Defense, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, Poise, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MaxPoise, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, PoiseRegenRate, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION_NOTIFY(UBaseAttributeSet, MovementSpeed, COND_None, REPNOTIFY_Always);
+		DOREPLIFETIME_CONDITION(UBaseAttributeSet, HealthPercentQuantized, COND_Never);
+		DOREPLIFETIME_CONDITION(UBaseAttributeSet, PoisePercentQuantized, COND_Never);
+		return;
+	}
+
+	const FDoRepLifetimeParams PublicParams = MakeAttributeRepParams(false);
+	const FDoRepLifetimeParams OwnerOnlyParams = MakeAttributeRepParams(true);
+
+	//Owner는 정확한 값, 나머지는 양자화된 비율
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, Health, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, Poise, OwnerOnlyParams);
+
+	FDoRepLifetimeParams QuantizedParams;
+	QuantizedParams.bIsPushBased = true;
+	QuantizedParams.Condition = COND_SkipOwner;
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, HealthPercentQuantized, QuantizedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, PoisePercentQuantized, QuantizedParams);
+
+	//다른 클라이언트도 필요한 값
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, MaxHealth, PublicParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, MaxPoise, PublicParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, MovementSpeed, PublicParams);
+
+	//Owner만 필요한 값
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, Stamina, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, MaxStamina, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, StaminaRegenRate, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, Defense, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBaseAttributeSet, PoiseRegenRate, OwnerOnlyParams);
+}
+
+FDoRepLifetimeParams UBaseAttributeSet::MakeAttributeRepParams(bool bOwnerOnly)
+{
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = bOwnerOnly ? COND_OwnerOnly : COND_None;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+	return Params;
 }
 
 void UBaseAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -54,12 +112,12 @@ void UBaseAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute,
 	{
 		NewValue = FMath::Max(NewValue, 1.0f);
 		//AdjustAttributeForMaxChange(Health, MaxHealth, NewValue, GetHealthAttribute());
-		DEBUG_LOG(TEXT("PreAttribute Change MaxHealth: %f"), NewValue);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PreAttribute Change MaxHealth: %f"), NewValue);
 	}
 	else if (Attribute == GetHealthAttribute())
 	{
 		NewValue = FMath::Clamp(NewValue, 0.0f, GetMaxHealth());
-		DEBUG_LOG(TEXT("PreAttribute Change Health: %f"), NewValue);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PreAttribute Change Health: %f"), NewValue);
 	}
 	else if (Attribute == GetMaxStaminaAttribute())
 	{
@@ -113,12 +171,12 @@ void UBaseAttributeSet::PreAttributeBaseChange(const FGameplayAttribute& Attribu
 	if (Attribute == GetMaxHealthAttribute())
 	{
 		NewValue = FMath::Max(NewValue, 1.0f);
-		DEBUG_LOG(TEXT("PreAttributeBase Change MaxHealth: %f"), NewValue);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PreAttributeBase Change MaxHealth: %f"), NewValue);
 	}
 	else if (Attribute == GetHealthAttribute())
 	{
 		NewValue = FMath::Clamp(NewValue, 0.0f, GetMaxHealth());
-		DEBUG_LOG(TEXT("PreAttributeBase Change Health: %f"), NewValue);
+		AP_DEBUG_LOG(LogAPAbility, TEXT("PreAttributeBase Change Health: %f"), NewValue);
 	}
 	else if (Attribute == GetMaxStaminaAttribute())
 	{
@@ -259,6 +317,120 @@ void UBaseAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 	}*/
 }
 
+void UBaseAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	MarkAttributeDirty(Attribute, NewValue);
+
+	if (Attribute == GetHealthAttribute() || Attribute == GetMaxHealthAttribute()
+		|| Attribute == GetPoiseAttribute() || Attribute == GetMaxPoiseAttribute())
+	{
+		UpdateQuantizedPercents();
+	}
+}
+
+void UBaseAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	MarkAttributeDirty(Attribute, NewValue);
+}
+
+float UBaseAttributeSet::GetReplicationThreshold(const FGameplayAttribute& Attribute) const
+{
+	//지속적으로 조금씩 변하는 값은 작은 변화 생략
+	if (Attribute == GetStaminaAttribute() || Attribute == GetPoiseAttribute())
+	{
+		return AttributeReplication::ContinuousValueThreshold;
+	}
+
+	return 0.0f;
+}
+
+void UBaseAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute, float NewValue) const
+{
+	if (!IsCompactReplicationEnabled()) return;
+
+	FProperty* Property = Attribute.GetUProperty();
+	if (!Property || !Property->HasAnyPropertyFlags(CPF_Net)) return;
+
+	const float Threshold = GetReplicationThreshold(Attribute);
+	if (Threshold > 0.0f)
+	{
+		const float* LastValue = LastDirtyValues.Find(Attribute);
+
+		//경계값(0 또는 Max 도달)은 항상 전송해서 최종 값이 어긋나지 않도록
+		const float MaxValue = Attribute == GetStaminaAttribute() ? GetMaxStamina() : Attribute == GetPoiseAttribute() ? GetMaxPoise() : -1.0f;
+		const bool bIsBoundary = FMath::IsNearlyZero(NewValue) || FMath::IsNearlyEqual(NewValue, MaxValue);
+		if (LastValue && FMath::Abs(NewValue - *LastValue) < Threshold && !bIsBoundary)
+		{
+			//회복/소모가 임계값 안에서 멈추면 클라이언트 값이 어긋나므로 잠시 뒤 마지막 값 전송
+			UWorld* World = GetWorld();
+			if (World && !World->GetTimerManager().IsTimerActive(ThresholdFlushTimer))
+			{
+				World->GetTimerManager().SetTimer(ThresholdFlushTimer,
+					FTimerDelegate::CreateUObject(this, &UBaseAttributeSet::FlushThresholdedAttributes),
+					AttributeReplication::ThresholdFlushDelay, false);
+			}
+			return;
+		}
+	}
+
+	LastDirtyValues.Add(Attribute, NewValue);
+	MARK_PROPERTY_DIRTY(this, Property);
+}
+
+void UBaseAttributeSet::FlushThresholdedAttributes() const
+{
+	for (const FGameplayAttribute& Attribute : { GetStaminaAttribute(), GetPoiseAttribute() })
+	{
+		FProperty* Property = Attribute.GetUProperty();
+		if (!Property || !Property->HasAnyPropertyFlags(CPF_Net)) continue;
+
+		const float CurrentValue = Attribute.GetNumericValue(this);
+		const float* LastValue = LastDirtyValues.Find(Attribute);
+		if (LastValue && *LastValue == CurrentValue) continue;
+
+		LastDirtyValues.Add(Attribute, CurrentValue);
+		MARK_PROPERTY_DIRTY(this, Property);
+	}
+}
+
+void UBaseAttributeSet::UpdateQuantizedPercents()
+{
+	if (!IsCompactReplicationEnabled()) return;
+
+	//서버에서만 계산, 클라이언트는 받은 값을 그대로 유지
+	const AActor* OwnerActor = GetOwningActor();
+	if (!OwnerActor || !OwnerActor->HasAuthority()) return;
+
+	const uint16 NewHealthPercent = static_cast<uint16>(FMath::RoundToInt(GetHealthPercent() * MAX_uint16));
+	if (NewHealthPercent != HealthPercentQuantized)
+	{
+		HealthPercentQuantized = NewHealthPercent;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UBaseAttributeSet, HealthPercentQuantized, this);
+	}
+
+	const float PoisePercent = GetMaxPoise() > 0.0f ? FMath::Clamp(GetPoise() / GetMaxPoise(), 0.0f, 1.0f) : 0.0f;
+	const uint8 NewPoisePercent = static_cast<uint8>(FMath::RoundToInt(PoisePercent * MAX_uint8));
+	if (NewPoisePercent != PoisePercentQuantized)
+	{
+		PoisePercentQuantized = NewPoisePercent;
+		MARK_PROPERTY_DIRTY_FROM_NAME(UBaseAttributeSet, PoisePercentQuantized, this);
+	}
+}
+
+void UBaseAttributeSet::ApplyQuantizedPercent(const FGameplayAttribute& Attribute, float Percent, float MaxValue) const
+{
+	UAbilitySystemComponent* ASC = GetOwningAbilitySystemComponent();
+	if (!ASC || MaxValue <= 0.0f) return;
+
+	//Owner가 아닌 클라이언트는 원본 값을 받지 않으므로 비율로 복원해서 로컬 값 갱신 (변경 델리게이트 발생)
+	const float RestoredValue = Percent * MaxValue;
+	ASC->SetNumericAttributeBase(Attribute, RestoredValue);
+}
+
 float UBaseAttributeSet::GetHealthPercent() const
 {
 	return GetMaxHealth() > 0.0f ? GetHealth() / GetMaxHealth() : 0.0f;
@@ -278,6 +450,12 @@ void UBaseAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth)
 void UBaseAttributeSet::OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UBaseAttributeSet, MaxHealth, OldMaxHealth);
+
+	//Owner가 아닌 클라이언트는 Max 변경 시 체력도 비율로 다시 복원
+	if (IsCompactReplicationEnabled() && GetOwningActor() && !GetOwningActor()->HasLocalNetOwner())
+	{
+		ApplyQuantizedPercent(GetHealthAttribute(), static_cast<float>(HealthPercentQuantized) / MAX_uint16, GetMaxHealth());
+	}
 }
 
 void UBaseAttributeSet::OnRep_Stamina(const FGameplayAttributeData& OldStamina)
@@ -308,6 +486,11 @@ void UBaseAttributeSet::OnRep_Poise(const FGameplayAttributeData& OldPoise)
 void UBaseAttributeSet::OnRep_MaxPoise(const FGameplayAttributeData& OldMaxPoise)
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UBaseAttributeSet, MaxPoise, OldMaxPoise);
+
+	if (IsCompactReplicationEnabled() && GetOwningActor() && !GetOwningActor()->HasLocalNetOwner())
+	{
+		ApplyQuantizedPercent(GetPoiseAttribute(), static_cast<float>(PoisePercentQuantized) / MAX_uint8, GetMaxPoise());
+	}
 }
 
 void UBaseAttributeSet::OnRep_PoiseRegenRate(const FGameplayAttributeData& OldPoiseRegenRate)
@@ -320,6 +503,16 @@ void UBaseAttributeSet::OnRep_MovementSpeed(const FGameplayAttributeData& OldMov
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UBaseAttributeSet, MovementSpeed, OldMovementSpeed);
 }
 
+void UBaseAttributeSet::OnRep_HealthPercentQuantized()
+{
+	ApplyQuantizedPercent(GetHealthAttribute(), static_cast<float>(HealthPercentQuantized) / MAX_uint16, GetMaxHealth());
+}
+
+void UBaseAttributeSet::OnRep_PoisePercentQuantized()
+{
+	ApplyQuantizedPercent(GetPoiseAttribute(), static_cast<float>(PoisePercentQuantized) / MAX_uint8, GetMaxPoise());
+}
+
 void UBaseAttributeSet::AdjustAttributeForMaxChange(const FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty) const
 {
 	UAbilitySystemComponent* AbilityComp = GetOwningAbilitySystemComponent();
@@ -3,15 +3,6 @@
 #include "GameplayEffectExtension.h"
 #include "Net/UnrealNetwork.h"
 
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossAttributeSet, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBossAttributeSet, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
-
 UBossAttributeSet::UBossAttributeSet()
 {
 	InitPhysicalAttackPower(50.0f);
@@ -21,7 +12,15 @@ void UBossAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UBossAttributeSet, PhysicalAttackPower, COND_None, REPNOTIFY_Always);
+	if (!IsCompactReplicationEnabled())
+	{
+		DOREPLIFETIME_CONDITION_NOTIFY(UBossAttributeSet, PhysicalAttackPower, COND_None, REPNOTIFY_Always);
+		return;
+	}
+
+	//공격력은 서버 계산에만 쓰이므로 Owner에게만 전송
+	const FDoRepLifetimeParams OwnerOnlyParams = MakeAttributeRepParams(true);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UBossAttributeSet, PhysicalAttackPower, OwnerOnlyParams);
 }
 
 void UBossAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
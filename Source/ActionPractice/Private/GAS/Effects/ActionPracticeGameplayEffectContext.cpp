@@ -1,22 +1,105 @@
 #include "GAS/Effects/ActionPracticeGameplayEffectContext.h"
+#include "Engine/NetSerialization.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+
+namespace EffectContextSerialization
+{
+	//직렬화 플래그 (설정된 필드만 전송)
+	enum ERepFlags : uint32
+	{
+		RepInstigator			= 1 << 0,
+		RepEffectCauser			= 1 << 1,
+		RepCauserIsInstigator	= 1 << 2,
+		RepAbilityCDO			= 1 << 3,
+		RepSourceObject			= 1 << 4,
+		RepActors				= 1 << 5,
+		RepHitResult			= 1 << 6,
+		RepWorldOrigin			= 1 << 7,
+		RepPoiseDamage			= 1 << 8,
+	};
+	constexpr uint32 NumRepFlagBits = 9;
+
+	//None/Slash/Strike/Pierce
+	constexpr uint32 DamageTypeBits = 2;
+	static_assert(static_cast<uint8>(EAttackDamageType::Pierce) < (1 << DamageTypeBits), "EAttackDamageType no longer fits in DamageTypeBits");
+
+	//PoiseDamage 0.1 단위 양자화
+	constexpr float PoiseDamageQuantizeScale = 10.0f;
+}
 
 bool FActionPracticeGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
-	Super::NetSerialize(Ar, Map, bOutSuccess);
+	using namespace EffectContextSerialization;
+
+	bOutSuccess = true;
+
+	uint32 RepBits = 0;
+	uint32 QuantizedPoiseDamage = 0;
+	if (Ar.IsSaving())
+	{
+		if (bReplicateInstigator && Instigator.IsValid()) RepBits |= RepInstigator;
+		if (bReplicateEffectCauser && EffectCauser.IsValid())
+		{
+			//대부분 Instigator == EffectCauser, 같은 참조를 두 번 보내지 않음
+			RepBits |= (RepBits & RepInstigator) && EffectCauser == Instigator ? RepCauserIsInstigator : RepEffectCauser;
+		}
+		if (AbilityCDO.IsValid()) RepBits |= RepAbilityCDO;
+		if (bReplicateSourceObject && SourceObject.IsValid()) RepBits |= RepSourceObject;
+		if (Actors.Num() > 0) RepBits |= RepActors;
+		if (bReplicateHitResult && HitResult.IsValid()) RepBits |= RepHitResult;
+		if (bReplicateWorldOrigin && bHasWorldOrigin) RepBits |= RepWorldOrigin;
+
+		QuantizedPoiseDamage = static_cast<uint32>(FMath::RoundToInt(FMath::Max(PoiseDamage, 0.0f) * PoiseDamageQuantizeScale));
+		if (QuantizedPoiseDamage > 0) RepBits |= RepPoiseDamage;
+	}
+
+	Ar.SerializeBits(&RepBits, NumRepFlagBits);
 
-	//AttackDamageType 직렬화
 	uint8 DamageTypeValue = static_cast<uint8>(AttackDamageType);
-	Ar << DamageTypeValue;
+	Ar.SerializeBits(&DamageTypeValue, DamageTypeBits);
+
+	if (RepBits & RepInstigator) Ar << Instigator;
+	if (RepBits & RepEffectCauser) Ar << EffectCauser;
+	if (RepBits & RepAbilityCDO) Ar << AbilityCDO;
+	if (RepBits & RepSourceObject) Ar << SourceObject;
+	if (RepBits & RepActors) SafeNetSerializeTArray_Default<31>(Ar, Actors);
+
+	if (RepBits & RepHitResult)
+	{
+		if (Ar.IsLoading() && !HitResult.IsValid())
+		{
+			HitResult = MakeShared<FHitResult>();
+		}
+		HitResult->NetSerialize(Ar, Map, bOutSuccess);
+	}
+
+	if (RepBits & RepWorldOrigin)
+	{
+		bOutSuccess &= SerializePackedVector<10, 24>(WorldOrigin, Ar);
+	}
+
+	if (RepBits & RepPoiseDamage)
+	{
+		Ar.SerializeIntPacked(QuantizedPoiseDamage);
+	}
 
 	if (Ar.IsLoading())
 	{
 		AttackDamageType = static_cast<EAttackDamageType>(DamageTypeValue);
-	}
+		PoiseDamage = QuantizedPoiseDamage / PoiseDamageQuantizeScale;
 
-	//PoiseDamage 직렬화
-	Ar << PoiseDamage;
+		if (RepBits & RepCauserIsInstigator) EffectCauser = Instigator;
+		if (!(RepBits & RepHitResult)) HitResult.Reset();
+		bHasWorldOrigin = (RepBits & RepWorldOrigin) != 0;
+		bReplicateHitResult = (RepBits & RepHitResult) != 0;
+		bReplicateWorldOrigin = bHasWorldOrigin;
 
-	bOutSuccess = true;
+		//InstigatorAbilitySystemComponent 복원
+		AddInstigator(Instigator.Get(), EffectCauser.Get());
+	}
+
+	bOutSuccess &= !Ar.IsError();
 	return true;
 }
 
@@ -33,7 +116,7 @@ FGameplayEffectContext* FActionPracticeGameplayEffectContext::Duplicate() const
 
 UScriptStruct* FActionPracticeGameplayEffectContext::GetScriptStruct() const
 {
-	return FGameplayEffectContext::GetScriptStruct();
+	return StaticStruct();
 }
 
 FActionPracticeGameplayEffectContext* FActionPracticeGameplayEffectContext::GetActionPracticeEffectContext(FGameplayEffectContextHandle& Handle)
@@ -57,3 +140,64 @@ const FActionPracticeGameplayEffectContext* FActionPracticeGameplayEffectContext
 
 	return nullptr;
 }
+
+#if WITH_DEV_AUTOMATION_TESTS
+//직렬화 왕복 검증, 오브젝트 참조가 없는 필드만 검사 (PackageMap 불필요)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEffectContextRoundTripTest, "ActionPractice.Net.EffectContextRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FEffectContextRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace EffectContextSerialization;
+
+	const EAttackDamageType DamageTypes[] = { EAttackDamageType::None, EAttackDamageType::Slash, EAttackDamageType::Strike, EAttackDamageType::Pierce };
+	const float PoiseDamages[] = { 0.0f, 0.05f, 1.0f, 12.34f, 250.0f, 9999.9f };
+	const FVector Origin(1234.5f, -678.9f, 42.0f);
+
+	for (const EAttackDamageType DamageType : DamageTypes)
+	{
+		for (const float Poise : PoiseDamages)
+		{
+			for (int32 WithOrigin = 0; WithOrigin <= 1; ++WithOrigin)
+			{
+				const FString Case = FString::Printf(TEXT("DamageType=%d Poise=%.2f Origin=%d"), static_cast<int32>(DamageType), Poise, WithOrigin);
+
+				FActionPracticeGameplayEffectContext Source;
+				Source.SetAttackDamageType(DamageType);
+				Source.SetPoiseDamage(Poise);
+				Source.AddOrigin(Origin);
+				Source.SetReplicateWorldOrigin(WithOrigin != 0);
+
+				bool bWriteSuccess = false;
+				FNetBitWriter Writer(nullptr, 256);
+				Source.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+				bool bReadSuccess = false;
+				FActionPracticeGameplayEffectContext Result;
+				FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+				Result.NetSerialize(Reader, nullptr, bReadSuccess);
+
+				TestTrue(Case + TEXT(" write"), bWriteSuccess);
+				TestTrue(Case + TEXT(" read"), bReadSuccess);
+				TestEqual(Case + TEXT(" consumed bits"), Reader.GetPosBits(), Writer.GetNumBits());
+				TestEqual(Case + TEXT(" DamageType"), static_cast<int32>(Result.GetAttackDamageType()), static_cast<int32>(DamageType));
+				TestEqual(Case + TEXT(" PoiseDamage"), Result.GetPoiseDamage(), Poise, 0.5f / PoiseDamageQuantizeScale);
+				TestEqual(Case + TEXT(" HasOrigin"), Result.HasOrigin(), WithOrigin != 0);
+				if (WithOrigin)
+				{
+					TestEqual(Case + TEXT(" Origin"), Result.GetOrigin(), Source.GetOrigin(), 0.1f);
+				}
+				TestNull(Case + TEXT(" HitResult"), Result.GetHitResult());
+
+				//플래그 + 대미지 타입만 보내는 경우의 최소 크기
+				if (!WithOrigin && Poise * PoiseDamageQuantizeScale < 0.5f)
+				{
+					TestEqual(Case + TEXT(" bits"), Writer.GetNumBits(), static_cast<int64>(NumRepFlagBits + DamageTypeBits));
+				}
+			}
+		}
+	}
+
+	return true;
+}
+#endif
@@ -1,16 +1,9 @@
 ﻿#include "GAS/Effects/ShortDurationTagManager.h"
 #include "AbilitySystemComponent.h"
 #include "Engine/World.h"
+#include "Games/CombatStats.h"
 #include "TimerManager.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogShortDurationTagManager, Log, All);
-	#define DEBUG_LOG(Format, ...) UE_LOG(LogShortDurationTagManager, Warning, Format, ##__VA_ARGS__)
-#else
-	#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UShortDurationTagManager::UShortDurationTagManager()
 {
@@ -21,14 +14,14 @@ void UShortDurationTagManager::Initialize(UAbilitySystemComponent* InOwnerASC)
 {
 	if (!InOwnerASC)
 	{
-		DEBUG_LOG(TEXT("Initialize failed: Invalid ASC"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Initialize failed: Invalid ASC"));
 		return;
 	}
 
 	OwnerASC = InOwnerASC;
 	ActiveTags.Empty();
 	
-	DEBUG_LOG(TEXT("ShortDurationTagManager initialized for ASC: %s"), *GetNameSafe(InOwnerASC->GetOwner()));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("ShortDurationTagManager initialized for ASC: %s"), *GetNameSafe(InOwnerASC->GetOwner()));
 }
 
 void UShortDurationTagManager::Cleanup()
@@ -37,7 +30,7 @@ void UShortDurationTagManager::Cleanup()
 	StopUpdateTimer();
 	OwnerASC = nullptr;
 	
-	DEBUG_LOG(TEXT("ShortDurationTagManager cleaned up"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("ShortDurationTagManager cleaned up"));
 }
 
 void UShortDurationTagManager::ApplyTag(
@@ -48,7 +41,7 @@ void UShortDurationTagManager::ApplyTag(
 {
 	if (!ASC || !Tag.IsValid() || Duration <= 0.0f)
 	{
-		DEBUG_LOG(TEXT("ApplyTag failed: Invalid parameters"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ApplyTag failed: Invalid parameters"));
 		return;
 	}
 
@@ -59,14 +52,14 @@ void UShortDurationTagManager::ApplyTag(
 	}
 	else if (OwnerASC != ASC)
 	{
-		DEBUG_LOG(TEXT("Warning: Different ASC provided than initialized"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Warning: Different ASC provided than initialized"));
 		return;
 	}
 
 	UWorld* World = ASC->GetWorld();
 	if (!World)
 	{
-		DEBUG_LOG(TEXT("ApplyTag failed: No World"));
+		AP_DEBUG_LOG(LogAPAbility, TEXT("ApplyTag failed: No World"));
 		return;
 	}
 
@@ -81,7 +74,7 @@ void UShortDurationTagManager::ApplyTag(
 			//스택 모드: 시간 누적
 			float RemainingTime = FMath::Max(0.0f, ExistingInfo->EndTime - CurrentTime);
 			NewEndTime = CurrentTime + RemainingTime + Duration;
-			DEBUG_LOG(TEXT("Stacking tag %s: Remaining(%.3f) + New(%.3f) = Total(%.3f)"),
+			AP_DEBUG_LOG(LogAPAbility, TEXT("Stacking tag %s: Remaining(%.3f) + New(%.3f) = Total(%.3f)"),
 				*Tag.ToString(), RemainingTime, Duration, NewEndTime - CurrentTime);
 		}
 		else
@@ -89,11 +82,11 @@ void UShortDurationTagManager::ApplyTag(
 			//비스택 모드: 더 긴 시간 적용
 			if (NewEndTime <= ExistingInfo->EndTime)
 			{
-				DEBUG_LOG(TEXT("Skip tag %s: New duration(%.3f) <= Remaining(%.3f)"),
+				AP_DEBUG_LOG(LogAPAbility, TEXT("Skip tag %s: New duration(%.3f) <= Remaining(%.3f)"),
 					*Tag.ToString(), Duration, ExistingInfo->EndTime - CurrentTime);
 				return;
 			}
-			DEBUG_LOG(TEXT("Extending tag %s: New duration(%.3f) > Remaining(%.3f)"),
+			AP_DEBUG_LOG(LogAPAbility, TEXT("Extending tag %s: New duration(%.3f) > Remaining(%.3f)"),
 				*Tag.ToString(), Duration, ExistingInfo->EndTime - CurrentTime);
 		}
 
@@ -113,8 +106,10 @@ void UShortDurationTagManager::ApplyTag(
 		
 		//ASC에 태그 추가
 		ASC->AddLooseGameplayTag(Tag);
+		INC_DWORD_STAT(STAT_CombatShortDurationTagChanges);
+		COMBAT_TRACE_EVENT(TEXT("ShortTag+ %s"), *Tag.ToString());
 		
-		DEBUG_LOG(TEXT("Added new tag %s for %.3f seconds (Stack: %s)"),
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Added new tag %s for %.3f seconds (Stack: %s)"),
 			*Tag.ToString(), Duration, bIsStack ? TEXT("true") : TEXT("false"));
 	}
 
@@ -135,7 +130,7 @@ void UShortDurationTagManager::RemoveTag(UAbilitySystemComponent* ASC, const FGa
 	if (ActiveTags.Contains(Tag))
 	{
 		RemoveTagInternal(Tag);
-		DEBUG_LOG(TEXT("Manually removed tag: %s"), *Tag.ToString());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Manually removed tag: %s"), *Tag.ToString());
 	}
 }
 
@@ -169,7 +164,7 @@ void UShortDurationTagManager::RemoveAllTags()
 	for (const auto& Pair : ActiveTags)
 	{
 		OwnerASC->RemoveLooseGameplayTag(Pair.Key);
-		DEBUG_LOG(TEXT("Removed tag on cleanup: %s"), *Pair.Key.ToString());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Removed tag on cleanup: %s"), *Pair.Key.ToString());
 	}
 
 	ActiveTags.Empty();
@@ -178,6 +173,8 @@ void UShortDurationTagManager::RemoveAllTags()
 
 void UShortDurationTagManager::UpdateTags()
 {
+	COMBAT_SCOPE(STAT_CombatShortDurationTags);
+
 	if (!OwnerASC.IsValid())
 	{
 		StopUpdateTimer();
@@ -206,7 +203,7 @@ void UShortDurationTagManager::UpdateTags()
 	for (const FGameplayTag& Tag : TagsToRemove)
 	{
 		RemoveTagInternal(Tag);
-		DEBUG_LOG(TEXT("Tag expired and removed: %s"), *Tag.ToString());
+		AP_DEBUG_LOG(LogAPAbility, TEXT("Tag expired and removed: %s"), *Tag.ToString());
 	}
 
 	//모든 태그가 제거되면 타이머 정지
@@ -226,6 +223,8 @@ void UShortDurationTagManager::RemoveTagInternal(const FGameplayTag& Tag)
 	if (ActiveTags.Remove(Tag) > 0)
 	{
 		OwnerASC->RemoveLooseGameplayTag(Tag);
+		INC_DWORD_STAT(STAT_CombatShortDurationTagChanges);
+		COMBAT_TRACE_EVENT(TEXT("ShortTag- %s"), *Tag.ToString());
 	}
 }
 
@@ -250,7 +249,7 @@ void UShortDurationTagManager::StartUpdateTimer()
 		true //반복
 	);
 	
-	DEBUG_LOG(TEXT("Update timer started"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Update timer started"));
 }
 
 void UShortDurationTagManager::StopUpdateTimer()
@@ -269,5 +268,5 @@ void UShortDurationTagManager::StopUpdateTimer()
 	}
 	
 	UpdateTimerHandle.Invalidate();
-	DEBUG_LOG(TEXT("Update timer stopped"));
+	AP_DEBUG_LOG(LogAPAbility, TEXT("Update timer stopped"));
 }
\ No newline at end of file
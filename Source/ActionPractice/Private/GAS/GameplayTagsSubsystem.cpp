@@ -2,6 +2,7 @@
 #include "GAS/GameplayTagsDataAsset.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "Games/ActionPracticeLog.h"
 
 void UGameplayTagsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -14,7 +15,7 @@ void UGameplayTagsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	
 	if (!GameplayTagsDataAsset)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GameplayTagsDataAsset could not be loaded from path: %s"), *DataAssetPath);
+		UE_LOG(LogAPAbility, Warning, TEXT("GameplayTagsDataAsset could not be loaded from path: %s"), *DataAssetPath);
 	}
 }
 
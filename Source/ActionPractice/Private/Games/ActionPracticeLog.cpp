@@ -0,0 +1,150 @@
+#include "Games/ActionPracticeLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY(LogAPAbility);
+DEFINE_LOG_CATEGORY(LogAPHitDetection);
+DEFINE_LOG_CATEGORY(LogAPCharacter);
+DEFINE_LOG_CATEGORY(LogAPAI);
+DEFINE_LOG_CATEGORY(LogAPAnim);
+DEFINE_LOG_CATEGORY(LogAPInput);
+DEFINE_LOG_CATEGORY(LogAPUI);
+DEFINE_LOG_CATEGORY(LogAPNet);
+DEFINE_LOG_CATEGORY(LogAPGame);
+
+#if !NO_LOGGING
+namespace ActionPracticeLog
+{
+	/**
+	 * LogAP* 카테고리 전용 메모리 링 버퍼
+	 * 쓰기는 원자적 인덱스 증가 + 시퀀스 번호로 락 없이 처리, 읽기는 시퀀스가 바뀐 항목을 건너뜀
+	 */
+	class FLogRingBuffer : public FOutputDevice
+	{
+	public:
+		static constexpr int32 Capacity = 512;
+		static constexpr int32 MaxMessageLength = 256;
+
+		FLogRingBuffer()
+		{
+			TrackedCategories = {
+				LogAPAbility.GetCategoryName(), LogAPHitDetection.GetCategoryName(), LogAPCharacter.GetCategoryName(),
+				LogAPAI.GetCategoryName(), LogAPAnim.GetCategoryName(), LogAPInput.GetCategoryName(),
+				LogAPUI.GetCategoryName(), LogAPNet.GetCategoryName(), LogAPGame.GetCategoryName()
+			};
+		}
+
+		virtual void Serialize(const TCHAR* Message, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			if (!Message || !TrackedCategories.Contains(Category)) return;
+
+			const uint64 Index = WriteIndex.fetch_add(1, std::memory_order_relaxed);
+			FEntry& Entry = Entries[Index % Capacity];
+
+			//쓰는 동안 무효 표시
+			Entry.Sequence.store(0, std::memory_order_release);
+			Entry.Time = FPlatformTime::Seconds();
+			Entry.Frame = GFrameCounter;
+			Entry.Category = Category;
+			Entry.Verbosity = Verbosity;
+			FCString::Strncpy(Entry.Message, Message, MaxMessageLength);
+			Entry.Sequence.store(Index + 1, std::memory_order_release);
+		}
+
+		virtual bool CanBeUsedOnAnyThread() const override { return true; }
+		virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+		void Dump(TArray<FString>& OutLines, int32 MaxEntries) const
+		{
+			const uint64 End = WriteIndex.load(std::memory_order_acquire);
+			const uint64 Count = FMath::Min<uint64>(End, FMath::Clamp(MaxEntries, 1, Capacity));
+
+			for (uint64 Index = End - Count; Index < End; ++Index)
+			{
+				const FEntry& Entry = Entries[Index % Capacity];
+				if (Entry.Sequence.load(std::memory_order_acquire) != Index + 1) continue;
+
+				FEntrySnapshot Snapshot;
+				Snapshot.Time = Entry.Time;
+				Snapshot.Frame = Entry.Frame;
+				Snapshot.Category = Entry.Category;
+				Snapshot.Verbosity = Entry.Verbosity;
+				FCString::Strncpy(Snapshot.Message, Entry.Message, MaxMessageLength);
+
+				//복사 중 덮어써졌으면 버림
+				if (Entry.Sequence.load(std::memory_order_acquire) != Index + 1) continue;
+
+				OutLines.Add(FString::Printf(TEXT("[%.3f][%llu] %s: %s: %s"), Snapshot.Time, Snapshot.Frame,
+					*Snapshot.Category.ToString(), ToString(Snapshot.Verbosity), Snapshot.Message));
+			}
+		}
+
+	private:
+		struct FEntrySnapshot
+		{
+			double Time = 0.0;
+			uint64 Frame = 0;
+			FName Category;
+			ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+			TCHAR Message[MaxMessageLength] = {};
+		};
+
+		struct FEntry : FEntrySnapshot
+		{
+			std::atomic<uint64> Sequence{0};
+		};
+
+		FEntry Entries[Capacity];
+		std::atomic<uint64> WriteIndex{0};
+		TArray<FName, TInlineAllocator<16>> TrackedCategories;
+	};
+
+	static FLogRingBuffer& GetRingBuffer()
+	{
+		static FLogRingBuffer RingBuffer;
+		return RingBuffer;
+	}
+
+	//엔진 초기화 이후 GLog에 등록, 종료 전 해제
+	static FDelayedAutoRegisterHelper RegisterRingBuffer(EDelayedRegisterRunPhase::EndOfEngineInit, []()
+	{
+		GLog->AddOutputDevice(&GetRingBuffer());
+		FCoreDelegates::OnPreExit.AddLambda([]()
+		{
+			if (GLog) GLog->RemoveOutputDevice(&GetRingBuffer());
+		});
+	});
+
+	static FAutoConsoleCommandWithArgsAndOutputDevice CmdDump(
+		TEXT("ap.Log.Dump"),
+		TEXT("Dumps the in-memory LogAP* ring buffer. Args: [Count=200] [File] - 'File' also saves to Saved/Logs."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+		{
+			const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+
+			TArray<FString> Lines;
+			GetRingBuffer().Dump(Lines, Count > 0 ? Count : 200);
+
+			//링 버퍼에 다시 기록되지 않도록 출력 장치로 직접 출력
+			for (const FString& Line : Lines)
+			{
+				Ar.Log(Line);
+			}
+
+			if (Args.ContainsByPredicate([](const FString& Arg) { return Arg.Equals(TEXT("File"), ESearchCase::IgnoreCase); }))
+			{
+				const FString Path = FPaths::Combine(FPaths::ProjectLogDir(),
+					FString::Printf(TEXT("APLogRing_%s.log"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+				FFileHelper::SaveStringArrayToFile(Lines, *Path);
+				Ar.Logf(TEXT("Saved %d lines to %s"), Lines.Num(), *Path);
+			}
+		}));
+}
+#endif
@@ -0,0 +1,173 @@
+#include "Games/CameraQuerySubsystem.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "HAL/IConsoleManager.h"
+#include "Games/CombatStats.h"
+
+namespace CameraQuery
+{
+	static float MoveTolerance = 0.5f;
+	static FAutoConsoleVariableRef CVarMoveTolerance(
+		TEXT("ap.Camera.Probe.MoveTolerance"),
+		MoveTolerance,
+		TEXT("A camera probe whose start and end moved less than this since its last trace reuses the previous result."));
+
+	static float RefreshInterval = 0.2f;
+	static FAutoConsoleVariableRef CVarRefreshInterval(
+		TEXT("ap.Camera.Probe.RefreshInterval"),
+		RefreshInterval,
+		TEXT("Seconds after which an unmoved camera probe is traced again, to pick up moving geometry."));
+
+	//이 프레임 수 동안 갱신되지 않은 프로브는 제거
+	static constexpr uint64 StaleFrames = 30;
+}
+
+#pragma region "Subsystem Functions"
+bool UCameraQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCameraQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UCameraQuerySubsystem::HandleTraceDone);
+}
+
+void UCameraQuerySubsystem::Deinitialize()
+{
+	//진행 중인 트레이스 결과는 HandleTraceDone에서 찾지 못하고 버려짐
+	TraceDelegate.Unbind();
+	Probes.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UCameraQuerySubsystem::IsTickable() const
+{
+	return Super::IsTickable() && Probes.Num() > 0;
+}
+
+TStatId UCameraQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCameraQuerySubsystem, STATGROUP_Tickables);
+}
+
+void UCameraQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	for (auto It = Probes.CreateIterator(); It; ++It)
+	{
+		if (GFrameCounter - It->Value.LastUpdateFrame > CameraQuery::StaleFrames)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SubmitProbes();
+}
+
+void UCameraQuerySubsystem::UpdateProbe(UWorld* World, int32& InOutProbeId, const FCameraProbeDesc& Desc)
+{
+	UCameraQuerySubsystem* Subsystem = World ? World->GetSubsystem<UCameraQuerySubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	FCameraProbe* Probe = Subsystem->Probes.Find(InOutProbeId);
+	if (!Probe)
+	{
+		InOutProbeId = Subsystem->NextProbeId++;
+		Probe = &Subsystem->Probes.Add(InOutProbeId);
+	}
+
+	Probe->Desc = Desc;
+	Probe->LastUpdateFrame = GFrameCounter;
+}
+
+bool UCameraQuerySubsystem::GetProbeResult(const UWorld* World, int32 ProbeId, bool& bOutHit, float& OutHitFraction)
+{
+	const UCameraQuerySubsystem* Subsystem = World ? World->GetSubsystem<UCameraQuerySubsystem>() : nullptr;
+	const FCameraProbe* Probe = Subsystem ? Subsystem->Probes.Find(ProbeId) : nullptr;
+	if (!Probe || !Probe->bHasResult) return false;
+
+	bOutHit = Probe->bHit;
+	OutHitFraction = Probe->HitFraction;
+	return true;
+}
+#pragma endregion
+
+#pragma region "Async Traces"
+void UCameraQuerySubsystem::SubmitProbes()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	const double Now = World->GetTimeSeconds();
+	const float ToleranceSq = FMath::Square(CameraQuery::MoveTolerance);
+
+	//이번 프레임의 카메라 쿼리를 한 번에 제출, 비동기 트레이스 배치로 함께 실행
+	for (TPair<int32, FCameraProbe>& Pair : Probes)
+	{
+		FCameraProbe& Probe = Pair.Value;
+		if (Probe.bPending) continue;
+
+		const bool bUnmoved = Probe.bHasResult
+			&& FVector::DistSquared(Probe.Desc.Start, Probe.SubmittedStart) <= ToleranceSq
+			&& FVector::DistSquared(Probe.Desc.End, Probe.SubmittedEnd) <= ToleranceSq;
+		if (bUnmoved && Now - Probe.SubmittedTime < CameraQuery::RefreshInterval)
+		{
+			INC_DWORD_STAT(STAT_CombatCameraProbesSkipped);
+			continue;
+		}
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(CameraProbe), false);
+		if (const AActor* IgnoredActor = Probe.Desc.IgnoredActor.Get())
+		{
+			Params.AddIgnoredActor(IgnoredActor);
+		}
+
+		const uint32 UserData = static_cast<uint32>(Pair.Key);
+		if (Probe.Desc.Radius > 0.0f)
+		{
+			World->AsyncSweepByChannel(EAsyncTraceType::Single, Probe.Desc.Start, Probe.Desc.End, FQuat::Identity, Probe.Desc.Channel,
+				FCollisionShape::MakeSphere(Probe.Desc.Radius), Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, UserData);
+		}
+		else
+		{
+			World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Probe.Desc.Start, Probe.Desc.End, Probe.Desc.Channel,
+				Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, UserData);
+		}
+
+		Probe.SubmittedStart = Probe.Desc.Start;
+		Probe.SubmittedEnd = Probe.Desc.End;
+		Probe.SubmittedTime = Now;
+		Probe.bPending = true;
+
+		INC_DWORD_STAT(STAT_CombatCameraProbesSubmitted);
+		++FCombatQueryCounters::CameraProbesAsync;
+	}
+}
+
+void UCameraQuerySubsystem::HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Data)
+{
+	FCameraProbe* Probe = Probes.Find(static_cast<int32>(Data.UserData));
+	if (!Probe) return;
+
+	Probe->bPending = false;
+	Probe->bHasResult = true;
+	Probe->bHit = false;
+	Probe->HitFraction = 1.0f;
+
+	for (const FHitResult& Hit : Data.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			Probe->bHit = true;
+			Probe->HitFraction = Hit.Time;
+			break;
+		}
+	}
+}
+#pragma endregion
@@ -0,0 +1,565 @@
+#include "Games/CombatBenchmarkSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "Characters/BaseCharacter.h"
+#include "Characters/HitDetection/AttackTraceComponent.h"
+#include "Games/CombatStats.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerStart.h"
+#include "GAS/GameplayTagsSubsystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "Games/ActionPracticeLog.h"
+
+#if !UE_BUILD_SHIPPING
+namespace CombatBenchmark
+{
+	static FAutoConsoleCommandWithWorldAndArgs CmdRun(
+		TEXT("ap.CombatBench"),
+		TEXT("Runs the combat benchmark. Args (Key=Value): Bosses, Players, Warmup, Duration, Interval, Radius, BossClass, PlayerClass, Output, ")
+		TEXT("MaxP95Ms, MaxP99Ms, MaxGameThreadMs, MaxSweepsPerFrame, MaxQueriesPerFrame, MaxGCMs, MaxTraceScratchGrowth, Exit=1. 'ap.CombatBench Cancel' stops a running benchmark."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UCombatBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UCombatBenchmarkSubsystem>() : nullptr;
+			if (!Benchmark)
+			{
+				UE_LOG(LogAPGame, Warning, TEXT("Combat benchmark is not available in this world"));
+				return;
+			}
+
+			if (Args.Num() > 0 && Args[0].Equals(TEXT("Cancel"), ESearchCase::IgnoreCase))
+			{
+				Benchmark->CancelBenchmark();
+				return;
+			}
+
+			FCombatBenchmarkSettings Settings;
+			Settings.Parse(*FString::Join(Args, TEXT(" ")));
+			Benchmark->StartBenchmark(Settings);
+		}));
+
+	static float Percentile(TArray<float>& SortedValues, float Percent)
+	{
+		if (SortedValues.Num() == 0) return 0.0f;
+
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percent * SortedValues.Num()) - 1, 0, SortedValues.Num() - 1);
+		return SortedValues[Index];
+	}
+
+	static float Average(const TArray<float>& Values)
+	{
+		if (Values.Num() == 0) return 0.0f;
+
+		double Sum = 0.0;
+		for (const float Value : Values) Sum += Value;
+		return static_cast<float>(Sum / Values.Num());
+	}
+
+	//임계값 검사, 0이면 통과
+	static bool CheckThreshold(const TCHAR* Name, float Value, float Threshold, TArray<FString>& OutFailures)
+	{
+		if (Threshold <= 0.0f || Value <= Threshold) return true;
+
+		OutFailures.Add(FString::Printf(TEXT("%s %.3f > %.3f"), Name, Value, Threshold));
+		return false;
+	}
+}
+#endif
+
+void FCombatBenchmarkSettings::Parse(const TCHAR* Params)
+{
+	FParse::Value(Params, TEXT("Bosses="), NumBosses);
+	FParse::Value(Params, TEXT("Players="), NumPlayerBots);
+	FParse::Value(Params, TEXT("Warmup="), WarmupSeconds);
+	FParse::Value(Params, TEXT("Duration="), DurationSeconds);
+	FParse::Value(Params, TEXT("Interval="), ActionInterval);
+	FParse::Value(Params, TEXT("Radius="), SpawnRadius);
+	FParse::Value(Params, TEXT("BossClass="), BossClassPath);
+	FParse::Value(Params, TEXT("PlayerClass="), PlayerClassPath);
+	FParse::Value(Params, TEXT("Output="), OutputName);
+	FParse::Value(Params, TEXT("MaxP95Ms="), MaxP95FrameMs);
+	FParse::Value(Params, TEXT("MaxP99Ms="), MaxP99FrameMs);
+	FParse::Value(Params, TEXT("MaxGameThreadMs="), MaxAvgGameThreadMs);
+	FParse::Value(Params, TEXT("MaxSweepsPerFrame="), MaxSweepsPerFrame);
+	FParse::Value(Params, TEXT("MaxQueriesPerFrame="), MaxQueriesPerFrame);
+	FParse::Value(Params, TEXT("MaxGCMs="), MaxTotalGCMs);
+	FParse::Value(Params, TEXT("MaxTraceScratchGrowth="), MaxTraceScratchGrowth);
+	FParse::Bool(Params, TEXT("Exit="), bExitOnFinish);
+
+	NumBosses = FMath::Max(0, NumBosses);
+	NumPlayerBots = FMath::Max(0, NumPlayerBots);
+	DurationSeconds = FMath::Max(1.0f, DurationSeconds);
+	ActionInterval = FMath::Max(0.1f, ActionInterval);
+}
+
+FCombatBenchmarkQueries FCombatBenchmarkQueries::Capture()
+{
+	FCombatBenchmarkQueries Queries;
+	Queries.WeaponSweeps = UAttackTraceComponent::TotalSweepTraceCounter;
+	Queries.HurtboxQueries = FCombatQueryCounters::HurtboxQueries;
+	Queries.CameraProbesAsync = FCombatQueryCounters::CameraProbesAsync;
+	Queries.CameraProbesSync = FCombatQueryCounters::CameraProbesSync;
+	Queries.PathQueries = FCombatQueryCounters::PathQueries;
+	return Queries;
+}
+
+FCombatBenchmarkQueries FCombatBenchmarkQueries::operator-(const FCombatBenchmarkQueries& Other) const
+{
+	FCombatBenchmarkQueries Delta;
+	Delta.WeaponSweeps = WeaponSweeps - Other.WeaponSweeps;
+	Delta.HurtboxQueries = HurtboxQueries - Other.HurtboxQueries;
+	Delta.CameraProbesAsync = CameraProbesAsync - Other.CameraProbesAsync;
+	Delta.CameraProbesSync = CameraProbesSync - Other.CameraProbesSync;
+	Delta.PathQueries = PathQueries - Other.PathQueries;
+	return Delta;
+}
+
+#pragma region "Subsystem Functions"
+bool UCombatBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+bool UCombatBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatBenchmarkSubsystem::Deinitialize()
+{
+	Cleanup();
+
+	Super::Deinitialize();
+}
+
+bool UCombatBenchmarkSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && bIsRunning;
+}
+
+TStatId UCombatBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double Elapsed = Now - StartTime;
+
+	TickBots(Now);
+
+	//워밍업 종료 시점부터 측정
+	if (!bIsMeasuring)
+	{
+		if (Elapsed < Settings.WarmupSeconds) return;
+
+		bIsMeasuring = true;
+		QueriesAtStart = FCombatBenchmarkQueries::Capture();
+		TraceScratchGrowthAtStart = UAttackTraceComponent::TotalTraceScratchGrowthCounter;
+		UsedPhysicalAtStart = FPlatformMemory::GetStats().UsedPhysical;
+		PeakUsedPhysical = UsedPhysicalAtStart;
+		BindMeasurementDelegates();
+		return;
+	}
+
+	FrameTimesMs.Add(static_cast<float>(FApp::GetDeltaTime() * 1000.0));
+	PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+
+	if (Elapsed >= Settings.WarmupSeconds + Settings.DurationSeconds)
+	{
+		FinishBenchmark();
+	}
+}
+#pragma endregion
+
+#pragma region "Benchmark Functions"
+void UCombatBenchmarkSubsystem::StartBenchmark(const FCombatBenchmarkSettings& InSettings)
+{
+	if (bIsRunning)
+	{
+		UE_LOG(LogAPGame, Warning, TEXT("Combat benchmark already running"));
+		return;
+	}
+
+	Settings = InSettings;
+	bIsRunning = true;
+	bIsMeasuring = false;
+	StartTime = GetWorld()->GetTimeSeconds();
+
+	FrameTimesMs.Reset();
+	GameThreadTimesMs.Reset();
+	FrameTimesMs.Reserve(FMath::CeilToInt(Settings.DurationSeconds * 144.0f));
+	GameThreadTimesMs.Reserve(FrameTimesMs.Max());
+	GCTimeMs = 0.0;
+	GCCount = 0;
+
+	if (!SpawnParticipants())
+	{
+		FailBenchmark(TEXT("participants could not be spawned"));
+		return;
+	}
+
+	UE_LOG(LogAPGame, Log, TEXT("Combat benchmark started: %d bosses, %d player bots, %.1fs warmup, %.1fs duration"),
+		Settings.NumBosses, Settings.NumPlayerBots, Settings.WarmupSeconds, Settings.DurationSeconds);
+}
+
+void UCombatBenchmarkSubsystem::CancelBenchmark()
+{
+	if (!bIsRunning) return;
+
+	UE_LOG(LogAPGame, Log, TEXT("Combat benchmark cancelled"));
+	Cleanup();
+}
+
+void UCombatBenchmarkSubsystem::FailBenchmark(const FString& Reason)
+{
+	UE_LOG(LogAPGame, Error, TEXT("Combat benchmark failed: %s"), *Reason);
+
+	const bool bExitOnFinish = Settings.bExitOnFinish;
+	Cleanup();
+
+	if (bExitOnFinish)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, 1);
+	}
+}
+
+bool UCombatBenchmarkSubsystem::SpawnParticipants()
+{
+	UWorld* World = GetWorld();
+
+	//PlayerStart 기준으로 원형 배치
+	FVector Center = FVector::ZeroVector;
+	if (TActorIterator<APlayerStart> It(World); It)
+	{
+		Center = It->GetActorLocation();
+	}
+
+	UClass* BossClass = LoadClass<ABaseCharacter>(nullptr, *Settings.BossClassPath);
+	UClass* PlayerClass = LoadClass<ABaseCharacter>(nullptr, *Settings.PlayerClassPath);
+	//클래스가 없으면 참가자 없이 통과하지 않도록 실패 처리
+	bool bClassesLoaded = true;
+	if (!BossClass && Settings.NumBosses > 0)
+	{
+		UE_LOG(LogAPGame, Error, TEXT("Boss class not found: %s"), *Settings.BossClassPath);
+		bClassesLoaded = false;
+	}
+	if (!PlayerClass && Settings.NumPlayerBots > 0)
+	{
+		UE_LOG(LogAPGame, Error, TEXT("Player class not found: %s"), *Settings.PlayerClassPath);
+		bClassesLoaded = false;
+	}
+	if (!bClassesLoaded)
+	{
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	auto SpawnRing = [&](UClass* Class, int32 Count, float Radius, bool bIsBot)
+	{
+		if (!Class) return;
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const float Angle = 2.0f * PI * Index / FMath::Max(1, Count);
+			const FVector Location = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Radius;
+			const FRotator Rotation = (Center - Location).GetSafeNormal2D().Rotation();
+
+			ABaseCharacter* Character = World->SpawnActor<ABaseCharacter>(Class, Location + FVector(0.0f, 0.0f, 100.0f), Rotation, SpawnParams);
+			if (!Character) continue;
+
+			if (!Character->GetController())
+			{
+				Character->SpawnDefaultController();
+			}
+			SpawnedActors.Add(Character);
+
+			if (bIsBot)
+			{
+				FCombatBenchmarkBot& Bot = Bots.AddDefaulted_GetRef();
+				Bot.Character = Character;
+				//봇 간 행동 시점을 분산
+				Bot.NextActionTime = StartTime + Settings.ActionInterval * Index / FMath::Max(1, Count);
+			}
+		}
+	};
+
+	//보스는 중앙 근처, 봇은 바깥 원
+	SpawnRing(BossClass, Settings.NumBosses, Settings.NumBosses > 1 ? Settings.SpawnRadius * 0.3f : 0.0f, false);
+	SpawnRing(PlayerClass, Settings.NumPlayerBots, Settings.SpawnRadius, true);
+
+	const int32 NumRequested = Settings.NumBosses + Settings.NumPlayerBots;
+	if (SpawnedActors.Num() < NumRequested)
+	{
+		UE_LOG(LogAPGame, Error, TEXT("Combat benchmark spawned %d of %d participants"), SpawnedActors.Num(), NumRequested);
+		return false;
+	}
+	return true;
+}
+
+void UCombatBenchmarkSubsystem::TickBots(double Now)
+{
+	//공격 -> 공격 -> 구르기 -> 가드 순환
+	const FGameplayTag ActionTags[] = {
+		UGameplayTagsSubsystem::GetAbilityAttackNormalTag(),
+		UGameplayTagsSubsystem::GetAbilityAttackNormalTag(),
+		UGameplayTagsSubsystem::GetAbilityRollTag(),
+		UGameplayTagsSubsystem::GetAbilityBlockTag()
+	};
+
+	for (FCombatBenchmarkBot& Bot : Bots)
+	{
+		ABaseCharacter* Character = Bot.Character.Get();
+		if (!Character) continue;
+
+		UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		if (!ASC) continue;
+
+		//가드 해제 (입력을 떼면 가드 종료)
+		if (Bot.BlockReleaseTime > 0.0 && Now >= Bot.BlockReleaseTime)
+		{
+			Bot.BlockReleaseTime = 0.0;
+			ReleaseAbilityByTag(Character, UGameplayTagsSubsystem::GetAbilityBlockTag());
+		}
+
+		if (Now < Bot.NextActionTime) continue;
+		Bot.NextActionTime = Now + Settings.ActionInterval;
+
+		const FGameplayTag& ActionTag = ActionTags[Bot.ActionIndex];
+		Bot.ActionIndex = (Bot.ActionIndex + 1) % UE_ARRAY_COUNT(ActionTags);
+
+		const bool bHold = ActionTag == UGameplayTagsSubsystem::GetAbilityBlockTag();
+		ActivateAbilityByTag(Character, ActionTag, bHold);
+
+		if (bHold)
+		{
+			Bot.BlockReleaseTime = Now + Settings.BlockHoldSeconds;
+		}
+	}
+}
+
+void UCombatBenchmarkSubsystem::ActivateAbilityByTag(ABaseCharacter* Character, const FGameplayTag& Tag, bool bHold) const
+{
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+
+	FGameplayAbilitySpecHandle Handle;
+	for (FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+	{
+		if (!Spec.Ability || !Spec.Ability->GetAssetTags().HasTagExact(Tag)) continue;
+
+		//실행 중이면 입력 이벤트로 전달 (콤보 진행)
+		Handle = Spec.Handle;
+		if (Spec.IsActive())
+		{
+			ASC->AbilitySpecInputPressed(Spec);
+		}
+		else if (ASC->TryActivateAbility(Handle))
+		{
+			Spec.InputPressed = true;
+		}
+		else
+		{
+			AP_DEBUG_LOG(LogAPGame, TEXT("Bot %s failed to activate %s"), *Character->GetName(), *Tag.ToString());
+		}
+		break;
+	}
+
+	//탭 입력은 바로 뗌, 활성화 중 스펙 배열이 바뀌었을 수 있으므로 핸들로 다시 찾음
+	FGameplayAbilitySpec* Spec = Handle.IsValid() && !bHold ? ASC->FindAbilitySpecFromHandle(Handle) : nullptr;
+	if (Spec && Spec->InputPressed)
+	{
+		ASC->AbilitySpecInputReleased(*Spec);
+	}
+}
+
+void UCombatBenchmarkSubsystem::ReleaseAbilityByTag(ABaseCharacter* Character, const FGameplayTag& Tag) const
+{
+	UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	if (!ASC) return;
+
+	for (FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+	{
+		if (Spec.Ability && Spec.Ability->GetAssetTags().HasTagExact(Tag) && Spec.InputPressed)
+		{
+			ASC->AbilitySpecInputReleased(Spec);
+		}
+	}
+}
+
+void UCombatBenchmarkSubsystem::BindMeasurementDelegates()
+{
+	//월드 Tick 시작 ~ 액터 Tick 종료 = 게임 스레드 시뮬레이션 시간
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddWeakLambda(this, [this](UWorld* World, ELevelTick, float)
+	{
+		if (World == GetWorld()) WorldTickStartTime = FPlatformTime::Seconds();
+	});
+
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddWeakLambda(this, [this](UWorld* World, ELevelTick, float)
+	{
+		if (World == GetWorld() && WorldTickStartTime > 0.0)
+		{
+			GameThreadTimesMs.Add(static_cast<float>((FPlatformTime::Seconds() - WorldTickStartTime) * 1000.0));
+		}
+	});
+
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddWeakLambda(this, [this]()
+	{
+		GCStartTime = FPlatformTime::Seconds();
+	});
+
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddWeakLambda(this, [this]()
+	{
+		if (GCStartTime <= 0.0) return;
+
+		GCTimeMs += (FPlatformTime::Seconds() - GCStartTime) * 1000.0;
+		++GCCount;
+		GCStartTime = 0.0;
+	});
+}
+
+void UCombatBenchmarkSubsystem::UnbindMeasurementDelegates()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	WorldTickStartHandle.Reset();
+	WorldPostActorTickHandle.Reset();
+	PreGCHandle.Reset();
+	PostGCHandle.Reset();
+	WorldTickStartTime = 0.0;
+	GCStartTime = 0.0;
+}
+
+void UCombatBenchmarkSubsystem::FinishBenchmark()
+{
+#if !UE_BUILD_SHIPPING
+	using namespace CombatBenchmark;
+
+	const int32 NumFrames = FrameTimesMs.Num();
+	const FCombatBenchmarkQueries Queries = FCombatBenchmarkQueries::Capture() - QueriesAtStart;
+	const int64 NumSweeps = Queries.WeaponSweeps;
+	const float SweepsPerFrame = NumFrames > 0 ? static_cast<float>(NumSweeps) / NumFrames : 0.0f;
+	const int64 NumQueries = Queries.GetTotal();
+	const float QueriesPerFrame = NumFrames > 0 ? static_cast<float>(NumQueries) / NumFrames : 0.0f;
+	const int64 NumTraceScratchGrowth = UAttackTraceComponent::TotalTraceScratchGrowthCounter - TraceScratchGrowthAtStart;
+
+	const float AvgFrameMs = Average(FrameTimesMs);
+	const float AvgGameThreadMs = Average(GameThreadTimesMs);
+	FrameTimesMs.Sort();
+	const float P50FrameMs = Percentile(FrameTimesMs, 0.50f);
+	const float P95FrameMs = Percentile(FrameTimesMs, 0.95f);
+	const float P99FrameMs = Percentile(FrameTimesMs, 0.99f);
+	const float MaxFrameMs = NumFrames > 0 ? FrameTimesMs.Last() : 0.0f;
+	const double UsedMemoryMB = UsedPhysicalAtStart / (1024.0 * 1024.0);
+	const double PeakMemoryMB = PeakUsedPhysical / (1024.0 * 1024.0);
+
+	TArray<FString> Failures;
+	CheckThreshold(TEXT("P95FrameMs"), P95FrameMs, Settings.MaxP95FrameMs, Failures);
+	CheckThreshold(TEXT("P99FrameMs"), P99FrameMs, Settings.MaxP99FrameMs, Failures);
+	CheckThreshold(TEXT("AvgGameThreadMs"), AvgGameThreadMs, Settings.MaxAvgGameThreadMs, Failures);
+	CheckThreshold(TEXT("SweepsPerFrame"), SweepsPerFrame, Settings.MaxSweepsPerFrame, Failures);
+	CheckThreshold(TEXT("QueriesPerFrame"), QueriesPerFrame, Settings.MaxQueriesPerFrame, Failures);
+	CheckThreshold(TEXT("TotalGCMs"), static_cast<float>(GCTimeMs), Settings.MaxTotalGCMs, Failures);
+	if (Settings.MaxTraceScratchGrowth >= 0 && NumTraceScratchGrowth > Settings.MaxTraceScratchGrowth)
+	{
+		Failures.Add(FString::Printf(TEXT("TraceScratchGrowth %lld > %d"), NumTraceScratchGrowth, Settings.MaxTraceScratchGrowth));
+	}
+	const bool bPassed = Failures.Num() == 0;
+
+	//JSON (실행별) + CSV (누적, 추이 비교용)
+	const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString OutputDir = FPaths::Combine(FPaths::ProfilingDir(), TEXT("CombatBench"));
+
+	FString FailuresJson;
+	for (const FString& Failure : Failures)
+	{
+		FailuresJson += FString::Printf(TEXT("%s\"%s\""), FailuresJson.IsEmpty() ? TEXT("") : TEXT(", "), *Failure);
+	}
+
+	const FString Json = FString::Printf(
+		TEXT("{\n")
+		TEXT("  \"name\": \"%s\",\n  \"timestamp\": \"%s\",\n  \"map\": \"%s\",\n")
+		TEXT("  \"bosses\": %d,\n  \"playerBots\": %d,\n  \"durationSeconds\": %.2f,\n  \"frames\": %d,\n")
+		TEXT("  \"frameMs\": { \"avg\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"p99\": %.3f, \"max\": %.3f },\n")
+		TEXT("  \"gameThreadMsAvg\": %.3f,\n  \"sweeps\": %lld,\n  \"sweepsPerFrame\": %.3f,\n  \"traceScratchGrowth\": %lld,\n")
+		TEXT("  \"sceneQueries\": { \"weaponSweeps\": %lld, \"hurtbox\": %lld, \"cameraAsync\": %lld, \"cameraSync\": %lld, \"path\": %lld, \"total\": %lld, \"perFrame\": %.3f },\n")
+		TEXT("  \"gc\": { \"count\": %d, \"totalMs\": %.3f },\n")
+		TEXT("  \"memoryMB\": { \"start\": %.1f, \"peak\": %.1f },\n")
+		TEXT("  \"passed\": %s,\n  \"failures\": [%s]\n}\n"),
+		*Settings.OutputName, *Timestamp, *GetWorld()->GetMapName(),
+		Settings.NumBosses, Settings.NumPlayerBots, Settings.DurationSeconds, NumFrames,
+		AvgFrameMs, P50FrameMs, P95FrameMs, P99FrameMs, MaxFrameMs,
+		AvgGameThreadMs, NumSweeps, SweepsPerFrame, NumTraceScratchGrowth,
+		Queries.WeaponSweeps, Queries.HurtboxQueries, Queries.CameraProbesAsync, Queries.CameraProbesSync, Queries.PathQueries, NumQueries, QueriesPerFrame,
+		GCCount, GCTimeMs,
+		UsedMemoryMB, PeakMemoryMB,
+		bPassed ? TEXT("true") : TEXT("false"), *FailuresJson);
+
+	const FString JsonPath = FPaths::Combine(OutputDir, FString::Printf(TEXT("%s_%s.json"), *Settings.OutputName, *Timestamp));
+	FFileHelper::SaveStringToFile(Json, *JsonPath);
+
+	const FString CsvPath = FPaths::Combine(OutputDir, Settings.OutputName + TEXT(".csv"));
+	if (!FPaths::FileExists(CsvPath))
+	{
+		FFileHelper::SaveStringToFile(TEXT("Timestamp,Map,Bosses,PlayerBots,Frames,AvgFrameMs,P50FrameMs,P95FrameMs,P99FrameMs,MaxFrameMs,AvgGameThreadMs,Sweeps,SweepsPerFrame,GCCount,GCMs,StartMemoryMB,PeakMemoryMB,Passed,SceneQueries,QueriesPerFrame\n"), *CsvPath);
+	}
+	const FString CsvRow = FString::Printf(TEXT("%s,%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lld,%.3f,%d,%.3f,%.1f,%.1f,%d,%lld,%.3f\n"),
+		*Timestamp, *GetWorld()->GetMapName(), Settings.NumBosses, Settings.NumPlayerBots, NumFrames,
+		AvgFrameMs, P50FrameMs, P95FrameMs, P99FrameMs, MaxFrameMs, AvgGameThreadMs, NumSweeps, SweepsPerFrame,
+		GCCount, GCTimeMs, UsedMemoryMB, PeakMemoryMB, bPassed ? 1 : 0, NumQueries, QueriesPerFrame);
+	FFileHelper::SaveStringToFile(CsvRow, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+
+	UE_LOG(LogAPGame, Log, TEXT("Combat benchmark: frame avg %.2f / p95 %.2f / p99 %.2f ms, game thread %.2f ms, %.2f sweeps/frame, %.2f scene queries/frame, %lld trace scratch growths, GC %d (%.1f ms)"),
+		AvgFrameMs, P95FrameMs, P99FrameMs, AvgGameThreadMs, SweepsPerFrame, QueriesPerFrame, NumTraceScratchGrowth, GCCount, GCTimeMs);
+	UE_LOG(LogAPGame, Log, TEXT("Combat benchmark results: %s"), *JsonPath);
+
+	for (const FString& Failure : Failures)
+	{
+		UE_LOG(LogAPGame, Error, TEXT("Combat benchmark regression: %s"), *Failure);
+	}
+
+	const bool bExitOnFinish = Settings.bExitOnFinish;
+	Cleanup();
+
+	if (bExitOnFinish)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+#endif
+}
+
+void UCombatBenchmarkSubsystem::Cleanup()
+{
+	UnbindMeasurementDelegates();
+
+	for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+
+	SpawnedActors.Reset();
+	Bots.Reset();
+	bIsRunning = false;
+	bIsMeasuring = false;
+}
+#pragma endregion
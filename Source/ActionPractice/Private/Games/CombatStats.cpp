@@ -0,0 +1,54 @@
+#include "Games/CombatStats.h"
+
+DEFINE_STAT(STAT_CombatAbilityCanActivate);
+DEFINE_STAT(STAT_CombatAbilityActivate);
+DEFINE_STAT(STAT_CombatTraceTick);
+DEFINE_STAT(STAT_CombatSweep);
+DEFINE_STAT(STAT_CombatHitValidation);
+DEFINE_STAT(STAT_CombatProcessHit);
+DEFINE_STAT(STAT_CombatDamageResolution);
+DEFINE_STAT(STAT_CombatHitReaction);
+DEFINE_STAT(STAT_CombatShortDurationTags);
+DEFINE_STAT(STAT_CombatHurtboxQuery);
+DEFINE_STAT(STAT_CombatImpactFlush);
+DEFINE_STAT(STAT_CombatBrainGather);
+DEFINE_STAT(STAT_CombatBrainEvaluate);
+DEFINE_STAT(STAT_CombatBrainApply);
+
+DEFINE_STAT(STAT_CombatAbilitiesActivated);
+DEFINE_STAT(STAT_CombatAbilitiesFailed);
+DEFINE_STAT(STAT_CombatSweeps);
+DEFINE_STAT(STAT_CombatHitsValidated);
+DEFINE_STAT(STAT_CombatHitsRejected);
+DEFINE_STAT(STAT_CombatDamageResolved);
+DEFINE_STAT(STAT_CombatHitReactions);
+DEFINE_STAT(STAT_CombatShortDurationTagChanges);
+DEFINE_STAT(STAT_CombatTraceScratchGrowth);
+DEFINE_STAT(STAT_CombatBudgetDegraded);
+DEFINE_STAT(STAT_CombatBudgetDeferred);
+DEFINE_STAT(STAT_CombatBudgetOverrun);
+DEFINE_STAT(STAT_CombatLatentFrameAllocations);
+DEFINE_STAT(STAT_CombatHurtboxTests);
+DEFINE_STAT(STAT_CombatBackendSweep);
+DEFINE_STAT(STAT_CombatBackendCCD);
+DEFINE_STAT(STAT_CombatImpactsQueued);
+DEFINE_STAT(STAT_CombatImpactsMerged);
+DEFINE_STAT(STAT_CombatImpactsCulled);
+DEFINE_STAT(STAT_CombatImpactsPlayed);
+DEFINE_STAT(STAT_CombatImpactPoolAllocations);
+DEFINE_STAT(STAT_CombatBrainAgents);
+DEFINE_STAT(STAT_CombatPathQueries);
+DEFINE_STAT(STAT_CombatPathShared);
+DEFINE_STAT(STAT_CombatPathDeferred);
+DEFINE_STAT(STAT_CombatCameraProbesSubmitted);
+DEFINE_STAT(STAT_CombatCameraProbesSkipped);
+DEFINE_STAT(STAT_CombatCameraProbesSync);
+
+int64 FCombatQueryCounters::HurtboxQueries = 0;
+int64 FCombatQueryCounters::CameraProbesAsync = 0;
+int64 FCombatQueryCounters::CameraProbesSync = 0;
+int64 FCombatQueryCounters::PathQueries = 0;
+
+#if COMBAT_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(CombatChannel);
+#endif
@@ -0,0 +1,175 @@
+#include "CoreMinimal.h"
+#include "Games/ActionPracticeLog.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GAS/AttributeSet/BaseAttributeSet.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
+
+/**
+ * 개발 빌드 전용 복제 대역폭 측정
+ * 멀티 클라이언트 PIE에서 서버 월드 기준으로 연결별 송신 bytes/s 평균을 출력
+ * 결과는 Saved/Profiling/NetBandwidthProbe.csv에 누적, 같은 맵에서 반대 모드로 측정한 최근 결과가 있으면 차이를 출력
+ * 복제 레이아웃은 시작 시 고정되므로 모드마다 한 번씩 실행해 비교
+ *   -dpcvars=ap.Net.CompactAttributeReplication=0 으로 실행 후 측정, 기본값(1)으로 다시 실행 후 측정
+ * 사용: ap.Net.BandwidthProbe [Seconds=10]
+ */
+#if !UE_BUILD_SHIPPING
+
+namespace NetBandwidthProbe
+{
+	struct FProbeState
+	{
+		TWeakObjectPtr<UWorld> World;
+		FTimerHandle TimerHandle;
+		int32 RemainingSamples = 0;
+		int32 SampleCount = 0;
+		int32 Seconds = 0;
+		TMap<FString, int64> OutBytesSum;
+	};
+
+	static FProbeState State;
+
+	static FString GetCsvPath()
+	{
+		return FPaths::Combine(FPaths::ProfilingDir(), TEXT("NetBandwidthProbe.csv"));
+	}
+
+	//같은 맵에서 반대 모드로 측정한 가장 최근 결과 (클라이언트 1명당 bytes/s)
+	static bool FindLastResult(const FString& MapName, bool bCompact, double& OutBytesPerClient, int32& OutClients)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *GetCsvPath())) return false;
+
+		//Timestamp,Map,Compact,Seconds,Clients,BytesPerClient
+		for (int32 Index = Lines.Num() - 1; Index >= 1; --Index)
+		{
+			TArray<FString> Columns;
+			Lines[Index].ParseIntoArray(Columns, TEXT(","));
+			if (Columns.Num() < 6 || Columns[1] != MapName || FCString::Atoi(*Columns[2]) != (bCompact ? 1 : 0)) continue;
+
+			OutClients = FCString::Atoi(*Columns[4]);
+			OutBytesPerClient = FCString::Atod(*Columns[5]);
+			return true;
+		}
+		return false;
+	}
+
+	static void Finish()
+	{
+		const bool bCompact = UBaseAttributeSet::IsCompactReplicationEnabled();
+		UE_LOG(LogAPNet, Log, TEXT("Bandwidth probe (CompactAttributeReplication=%d, %d samples)"),
+			bCompact ? 1 : 0, State.SampleCount);
+
+		double TotalAverage = 0.0;
+		for (const TPair<FString, int64>& Pair : State.OutBytesSum)
+		{
+			const double Average = State.SampleCount > 0 ? static_cast<double>(Pair.Value) / State.SampleCount : 0.0;
+			TotalAverage += Average;
+			UE_LOG(LogAPNet, Log, TEXT("  %s: %.1f bytes/s"), *Pair.Key, Average);
+		}
+
+		const int32 NumClients = State.OutBytesSum.Num();
+		const double BytesPerClient = NumClients > 0 ? TotalAverage / NumClients : 0.0;
+		UWorld* World = State.World.Get();
+		const FString MapName = World ? World->GetMapName() : FString();
+
+		//반대 모드 결과와 비교 (행 추가 전에 검색)
+		double OtherBytesPerClient = 0.0;
+		int32 OtherClients = 0;
+		if (NumClients > 0 && FindLastResult(MapName, !bCompact, OtherBytesPerClient, OtherClients))
+		{
+			const double OffBytes = bCompact ? OtherBytesPerClient : BytesPerClient;
+			const double OnBytes = bCompact ? BytesPerClient : OtherBytesPerClient;
+			const double DeltaPercent = OffBytes > 0.0 ? (OnBytes - OffBytes) / OffBytes * 100.0 : 0.0;
+			UE_LOG(LogAPNet, Log, TEXT("Bandwidth per client: compact off %.1f, on %.1f bytes/s (%+.1f bytes/s, %+.1f%%)"),
+				OffBytes, OnBytes, OnBytes - OffBytes, DeltaPercent);
+
+			if (OtherClients != NumClients)
+			{
+				UE_LOG(LogAPNet, Warning, TEXT("Bandwidth probe compared runs with different client counts (%d vs %d)"), NumClients, OtherClients);
+			}
+		}
+		else if (NumClients > 0)
+		{
+			UE_LOG(LogAPNet, Log, TEXT("No CompactAttributeReplication=%d result for %s yet, rerun with -dpcvars=ap.Net.CompactAttributeReplication=%d to compare"),
+				bCompact ? 0 : 1, *MapName, bCompact ? 0 : 1);
+		}
+
+		if (NumClients > 0)
+		{
+			const FString CsvPath = GetCsvPath();
+			if (!FPaths::FileExists(CsvPath))
+			{
+				FFileHelper::SaveStringToFile(TEXT("Timestamp,Map,Compact,Seconds,Clients,BytesPerClient\n"), *CsvPath);
+			}
+			const FString CsvRow = FString::Printf(TEXT("%s,%s,%d,%d,%d,%.1f\n"),
+				*FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")), *MapName, bCompact ? 1 : 0, State.Seconds, NumClients, BytesPerClient);
+			FFileHelper::SaveStringToFile(CsvRow, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+		}
+
+		State.OutBytesSum.Reset();
+		State.SampleCount = 0;
+	}
+
+	static void Sample()
+	{
+		UWorld* World = State.World.Get();
+		UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+		if (!NetDriver)
+		{
+			UE_LOG(LogAPNet, Warning, TEXT("Bandwidth probe stopped: no net driver"));
+			State.RemainingSamples = 0;
+			return;
+		}
+
+		//OutBytesPerSecond는 StatPeriod(1초)마다 갱신
+		for (UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			if (!Connection) continue;
+			State.OutBytesSum.FindOrAdd(Connection->LowLevelGetRemoteAddress(true)) += Connection->OutBytesPerSecond;
+		}
+		++State.SampleCount;
+
+		if (--State.RemainingSamples <= 0)
+		{
+			World->GetTimerManager().ClearTimer(State.TimerHandle);
+			Finish();
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdBandwidthProbe(
+		TEXT("ap.Net.BandwidthProbe"),
+		TEXT("Samples outgoing bytes/s per client connection on the server for N seconds (default 10) and logs the averages."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone)
+			{
+				UE_LOG(LogAPNet, Warning, TEXT("Run on the server world (listen or dedicated)"));
+				return;
+			}
+
+			const int32 Seconds = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+
+			if (UWorld* PrevWorld = State.World.Get())
+			{
+				PrevWorld->GetTimerManager().ClearTimer(State.TimerHandle);
+			}
+
+			State.World = World;
+			State.RemainingSamples = Seconds;
+			State.SampleCount = 0;
+			State.Seconds = Seconds;
+			State.OutBytesSum.Reset();
+
+			World->GetTimerManager().SetTimer(State.TimerHandle, FTimerDelegate::CreateStatic(&Sample), 1.0f, true);
+			UE_LOG(LogAPNet, Log, TEXT("Bandwidth probe started for %d seconds"), Seconds);
+		}));
+}
+
+#endif
@@ -0,0 +1,247 @@
+#include "Games/TickAuditSubsystem.h"
+#include "Characters/BaseCharacter.h"
+#include "Characters/HitDetection/AttackTraceComponent.h"
+#include "Characters/HitDetection/WeaponCCDComponent.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/MovementComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+#include "Games/ActionPracticeLog.h"
+
+#if !UE_BUILD_SHIPPING
+namespace TickAudit
+{
+	//주기 감사 간격 (초), 0이면 비활성
+	static float AuditInterval = 0.0f;
+	static FAutoConsoleVariableRef CVarAuditInterval(
+		TEXT("ap.TickAudit.Interval"),
+		AuditInterval,
+		TEXT("Tick audit interval in seconds. 0 disables periodic audit. Applied on world BeginPlay."));
+
+	static FAutoConsoleCommandWithWorld CmdRunAudit(
+		TEXT("ap.TickAudit"),
+		TEXT("Logs ticking actors/components and idle ticks per class."),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			if (UTickAuditSubsystem* Audit = World ? World->GetSubsystem<UTickAuditSubsystem>() : nullptr)
+			{
+				Audit->RunAudit();
+			}
+		}));
+
+	//네이티브 Tick이 비어 있는 엔진 기본 클래스인지 (블루프린트 전용 클래스가 ReceiveTick 없이 Tick만 켠 경우)
+	static bool HasOnlyEmptyTick(const UClass* Class, const UClass* EmptyTickBase, FName ScriptTickName)
+	{
+		const UClass* NativeClass = Class;
+		while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+		{
+			NativeClass = NativeClass->GetSuperClass();
+		}
+		return NativeClass == EmptyTickBase && !Class->IsFunctionImplementedInScript(ScriptTickName);
+	}
+
+	//직접 보고하는 클래스는 중복 집계하지 않음
+	static bool ReportsOwnIdleTicks(const UObject* Ticker)
+	{
+		return Ticker->IsA<ABaseCharacter>() || Ticker->IsA<UAttackTraceComponent>() || Ticker->IsA<UWeaponCCDComponent>();
+	}
+
+	static bool IsIdleActor(const AActor* Actor)
+	{
+		if (const ABaseCharacter* Character = Cast<ABaseCharacter>(Actor))
+		{
+			return !Character->HasTickWork();
+		}
+		return HasOnlyEmptyTick(Actor->GetClass(), AActor::StaticClass(), GET_FUNCTION_NAME_CHECKED(AActor, ReceiveTick));
+	}
+
+	static bool IsIdleComponent(const UActorComponent* Component)
+	{
+		if (!Component->IsRegistered() || !Component->IsActive())
+		{
+			return true;
+		}
+
+		//캐릭터 이동은 정지 중에도 바닥 검사/네트워크 보정을 하므로 제외
+		const UMovementComponent* Movement = Cast<UMovementComponent>(Component);
+		if (Movement && !Movement->IsA<UCharacterMovementComponent>())
+		{
+			return !Movement->UpdatedComponent || Movement->Velocity.IsNearlyZero();
+		}
+
+		const FName ScriptTickName = GET_FUNCTION_NAME_CHECKED(UActorComponent, ReceiveTick);
+		return HasOnlyEmptyTick(Component->GetClass(), UActorComponent::StaticClass(), ScriptTickName)
+			|| HasOnlyEmptyTick(Component->GetClass(), USceneComponent::StaticClass(), ScriptTickName);
+	}
+
+	static void LogCounts(const TCHAR* Label, TMap<FName, int32>& Counts)
+	{
+		Counts.ValueSort(TGreater<int32>());
+		for (const TPair<FName, int32>& Pair : Counts)
+		{
+			UE_LOG(LogAPGame, Log, TEXT("  [%s] %s: %d"), Label, *Pair.Key.ToString(), Pair.Value);
+		}
+	}
+}
+#endif
+
+bool UTickAuditSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UTickAuditSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+#if !UE_BUILD_SHIPPING
+	if (TickAudit::AuditInterval > 0.0f)
+	{
+		bSampling = true;
+		InWorld.GetTimerManager().SetTimer(AuditTimerHandle, this, &UTickAuditSubsystem::RunAudit, TickAudit::AuditInterval, true);
+	}
+#endif
+}
+
+void UTickAuditSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(AuditTimerHandle);
+	}
+
+	bSampling = false;
+
+	Super::Deinitialize();
+}
+
+bool UTickAuditSubsystem::IsTickable() const
+{
+	return Super::IsTickable() && bSampling;
+}
+
+TStatId UTickAuditSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTickAuditSubsystem, STATGROUP_Tickables);
+}
+
+void UTickAuditSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//월드 Tick 이후 호출, 이번 프레임에 Tick 함수가 켜져 있던 대상 기준
+	SampleIdleTicks(IdleTickCounts);
+}
+
+void UTickAuditSubsystem::SampleIdleTicks(TMap<FName, int32>& OutCounts) const
+{
+#if !UE_BUILD_SHIPPING
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	for (FActorIterator It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!IsValid(Actor)) continue;
+
+		if (Actor->PrimaryActorTick.IsTickFunctionEnabled() && !TickAudit::ReportsOwnIdleTicks(Actor) && TickAudit::IsIdleActor(Actor))
+		{
+			++OutCounts.FindOrAdd(Actor->GetClass()->GetFName());
+		}
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component && Component->PrimaryComponentTick.IsTickFunctionEnabled()
+				&& !TickAudit::ReportsOwnIdleTicks(Component) && TickAudit::IsIdleComponent(Component))
+			{
+				++OutCounts.FindOrAdd(Component->GetClass()->GetFName());
+			}
+		}
+	}
+#endif
+}
+
+void UTickAuditSubsystem::ReportIdleTick(const UObject* Ticker)
+{
+#if !UE_BUILD_SHIPPING
+	if (!Ticker) return;
+
+	UWorld* World = Ticker->GetWorld();
+	if (UTickAuditSubsystem* Audit = World ? World->GetSubsystem<UTickAuditSubsystem>() : nullptr)
+	{
+		++Audit->IdleTickCounts.FindOrAdd(Ticker->GetClass()->GetFName());
+	}
+#endif
+}
+
+void UTickAuditSubsystem::RunAudit()
+{
+#if !UE_BUILD_SHIPPING
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	TMap<FName, int32> TickingActors;
+	TMap<FName, int32> TickingComponents;
+	TMap<FName, int32> IdleTickers;
+	int32 TotalActors = 0;
+	int32 TotalComponents = 0;
+
+	for (FActorIterator It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!IsValid(Actor)) continue;
+
+		if (Actor->IsActorTickEnabled())
+		{
+			++TickingActors.FindOrAdd(Actor->GetClass()->GetFName());
+			++TotalActors;
+
+			//지금 Tick이 필요한지도 확인
+			if (TickAudit::IsIdleActor(Actor))
+			{
+				++IdleTickers.FindOrAdd(Actor->GetClass()->GetFName());
+			}
+		}
+
+		for (UActorComponent* Component : Actor->GetComponents())
+		{
+			if (Component && Component->IsComponentTickEnabled())
+			{
+				++TickingComponents.FindOrAdd(Component->GetClass()->GetFName());
+				++TotalComponents;
+
+				//히트 판정 컴포넌트는 판정 중이 아닐 때 Tick이 꺼져야 함
+				const UAttackTraceComponent* Trace = Cast<UAttackTraceComponent>(Component);
+				const UWeaponCCDComponent* CCD = Cast<UWeaponCCDComponent>(Component);
+				const bool bIdle = Trace ? !Trace->IsTracing() : CCD ? !CCD->IsDetecting() : TickAudit::IsIdleComponent(Component);
+				if (bIdle)
+				{
+					++IdleTickers.FindOrAdd(Component->GetClass()->GetFName());
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogAPGame, Log, TEXT("Tick Audit: %d ticking actors, %d ticking components"), TotalActors, TotalComponents);
+	TickAudit::LogCounts(TEXT("Actor"), TickingActors);
+	TickAudit::LogCounts(TEXT("Component"), TickingComponents);
+
+	//유휴 Tick은 회귀로 간주하고 경고
+	if (IdleTickers.Num() > 0 || IdleTickCounts.Num() > 0)
+	{
+		UE_LOG(LogAPGame, Warning, TEXT("Tick Audit: idle tickers detected"));
+		TickAudit::LogCounts(TEXT("IdleNow"), IdleTickers);
+		TickAudit::LogCounts(TEXT("IdleTicks"), IdleTickCounts);
+	}
+
+	IdleTickCounts.Reset();
+#endif
+}
@@ -4,15 +4,7 @@
 #include "Abilities/GameplayAbility.h"
 #include "GAS/GameplayTagsSubsystem.h"
 #include "Input/InputActionDataAsset.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogInputBufferComponent, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogInputBufferComponent, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 UInputBufferComponent::UInputBufferComponent()
 {
@@ -36,15 +28,15 @@ void UInputBufferComponent::BeginPlay()
 
 	if (!EventNotifyEnableBufferInputTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventNotifyEnableBufferInputTag is not valid"));
+		AP_DEBUG_LOG(LogAPInput, TEXT("EventNotifyEnableBufferInputTag is not valid"));
 	}
 	if (!EventActionInputByBufferTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventActionInputByBufferTag is not valid"));
+		AP_DEBUG_LOG(LogAPInput, TEXT("EventActionInputByBufferTag is not valid"));
 	}
 	if (!EventActionPlayBufferTag.IsValid())
 	{
-		DEBUG_LOG(TEXT("EventActionPlayBufferTag is not valid"));
+		AP_DEBUG_LOG(LogAPInput, TEXT("EventActionPlayBufferTag is not valid"));
 	}
 
 	if (UAbilitySystemComponent* ASC = OwnerCharacter->GetAbilitySystemComponent())
@@ -70,7 +62,7 @@ void UInputBufferComponent::BeginPlay()
 			});
 	}
 
-	else DEBUG_LOG(TEXT("No ASC"));
+	else AP_DEBUG_LOG(LogAPInput, TEXT("No ASC"));
 	
 	Super::BeginPlay();
 }
@@ -113,14 +105,14 @@ void UInputBufferComponent::BufferNextAction(const UInputAction* InputedAction)
 	bool bIsHoldAction;
 	if (!CanBufferAction(InputedAction, NewActionPriority, bIsHoldAction))
 	{
-		DEBUG_LOG(TEXT("Cannot buffer action, bCanBuffered is false - Action: %s"), *InputedAction->GetName());
+		AP_DEBUG_LOG(LogAPInput, TEXT("Cannot buffer action, bCanBuffered is false - Action: %s"), *InputedAction->GetName());
 		return;
 	}
 
 	if (bIsHoldAction)
 	{
 		BufferedHoldAction.Add(InputedAction);
-		DEBUG_LOG(TEXT("Buffered hold action added - Action: %s"), *InputedAction->GetName());
+		AP_DEBUG_LOG(LogAPInput, TEXT("Buffered hold action added - Action: %s"), *InputedAction->GetName());
 	}
 	
 	else if (NewActionPriority >= CurrentBufferPriority)
@@ -128,11 +120,11 @@ void UInputBufferComponent::BufferNextAction(const UInputAction* InputedAction)
 		bBufferActionReleased = false;
 		BufferedAction = InputedAction;
 		CurrentBufferPriority = NewActionPriority;
-		DEBUG_LOG(TEXT("Buffered action updated - Action: %s"), *InputedAction->GetName());
+		AP_DEBUG_LOG(LogAPInput, TEXT("Buffered action updated - Action: %s"), *InputedAction->GetName());
 	}
 	else
 	{
-		DEBUG_LOG(TEXT("Buffer action ignored - Lower priority: %d vs %d"), NewActionPriority, CurrentBufferPriority);
+		AP_DEBUG_LOG(LogAPInput, TEXT("Buffer action ignored - Lower priority: %d vs %d"), NewActionPriority, CurrentBufferPriority);
 	}
 }
 
@@ -140,7 +132,7 @@ void UInputBufferComponent::UnBufferHoldAction(const UInputAction* InputedAction
 {
 	bBufferActionReleased = true;
 	BufferedHoldAction.Remove(InputedAction);
-	DEBUG_LOG(TEXT("Buffered hold action removed - Action: %s"), *InputedAction->GetName());
+	AP_DEBUG_LOG(LogAPInput, TEXT("Buffered hold action removed - Action: %s"), *InputedAction->GetName());
 }
 
 void UInputBufferComponent::ActivateAbility(const UInputAction* InputAction)
@@ -158,14 +150,14 @@ void UInputBufferComponent::ActivateAbility(const UInputAction* InputAction)
 		//첫 실행이거나, bRetriggerInstancedAbility = true여서 재실행될 때
 		if (ASC->TryActivateAbility(Spec->Handle))
 		{
-			DEBUG_LOG(TEXT("Play Buffer - Activate Ability: %s"), *GetNameSafe(Spec->Ability->GetClass()));
+			AP_DEBUG_LOG(LogAPInput, TEXT("Play Buffer - Activate Ability: %s"), *GetNameSafe(Spec->Ability->GetClass()));
 			Spec->InputPressed = true;
 		}
 
 		//어빌리티가 이미 실행중 / bRetriggerInstancedAbility = false여서 Try를 실패했을 때 (콤보 공격)
 		else if (Spec->IsActive()) //CanActivateAbility 실패로 활성화하지 못했을 때를 거르기 위해 실행 중 체크
 		{
-			DEBUG_LOG(TEXT("Play Buffer - Play Buffer Event: %s"), *GetNameSafe(Spec->Ability->GetClass()));
+			AP_DEBUG_LOG(LogAPInput, TEXT("Play Buffer - Play Buffer Event: %s"), *GetNameSafe(Spec->Ability->GetClass()));
 			Spec->InputPressed = true;
 
 			//현재 Spec인 어빌리티만 OnInputByBuffer가 활성화되도록 자기 자신을 EventData로 넘김
@@ -182,7 +174,7 @@ void UInputBufferComponent::ActivateAbility(const UInputAction* InputAction)
 		}
 
 		//다 아닐때
-		else DEBUG_LOG(TEXT("Play Buffer Activate Failed: %s"), *GetNameSafe(Spec->Ability->GetClass()));
+		else AP_DEBUG_LOG(LogAPInput, TEXT("Play Buffer Activate Failed: %s"), *GetNameSafe(Spec->Ability->GetClass()));
 	}
 }
 
@@ -218,7 +210,7 @@ bool UInputBufferComponent::IsBufferWaiting()
 void UInputBufferComponent::OnEnableBufferInput(const FGameplayEventData& EventData)
 {
 	bCanBufferInput = true;
-	DEBUG_LOG(TEXT("Enable Buffer Input - Can Buffer Action"));
+	AP_DEBUG_LOG(LogAPInput, TEXT("Enable Buffer Input - Can Buffer Action"));
 }
 
 void UInputBufferComponent::OnPlayBuffer(const FGameplayEventData& EventData)
@@ -227,11 +219,11 @@ void UInputBufferComponent::OnPlayBuffer(const FGameplayEventData& EventData)
 	
 	if (BufferedAction || BufferedHoldAction.Num() > 0) //저장한 행동이 있을 경우
 	{
-		DEBUG_LOG(TEXT("Play Buffer"));
+		AP_DEBUG_LOG(LogAPInput, TEXT("Play Buffer"));
 		ActivateBufferAction();
 	}
 
-	else DEBUG_LOG(TEXT("Play Buffer - No Buffered Action"));
+	else AP_DEBUG_LOG(LogAPInput, TEXT("Play Buffer - No Buffered Action"));
 }
 
 void UInputBufferComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
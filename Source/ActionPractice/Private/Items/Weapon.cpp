@@ -9,20 +9,15 @@
 #include "Characters/ActionPracticeCharacter.h"
 #include "Characters/HitDetection/WeaponAttackComponent.h"
 #include "Characters/HitDetection/WeaponCCDComponent.h"
+#include "Characters/HitDetection/HitDetectionSelectorComponent.h"
+#include "Characters/HitDetection/HitImpactSubsystem.h"
 #include "GAS/AttributeSet/ActionPracticeAttributeSet.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogWeapon, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogWeapon, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 AWeapon::AWeapon()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    //무기 자체는 프레임마다 할 일이 없음, 판정은 컴포넌트 Tick에서 처리
+    PrimaryActorTick.bCanEverTick = false;
 
 	// Scene Component를 Root로 설정
 	USceneComponent* SceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
@@ -35,6 +30,7 @@ AWeapon::AWeapon()
     // 콜리전 컴포넌트 추가
     AttackTraceComponent = CreateDefaultSubobject<UWeaponAttackComponent>(TEXT("TraceComponent"));
     CCDComponent = CreateDefaultSubobject<UWeaponCCDComponent>(TEXT("CCDComponent"));
+    HitDetectionSelector = CreateDefaultSubobject<UHitDetectionSelectorComponent>(TEXT("HitDetectionSelector"));
     
     // 기본 콜리전 설정
     WeaponMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -46,20 +42,19 @@ void AWeapon::BeginPlay()
     OwnerCharacter = Cast<AActionPracticeCharacter>(GetOwner());
     if (!OwnerCharacter)
     {
-        DEBUG_LOG(TEXT("No Owner Character In Weapon"));
+        AP_DEBUG_LOG(LogAPCharacter, TEXT("No Owner Character In Weapon"));
         return;
     }
 
 	CalculateCalculatedDamage();
 	BindDelegates();
 
-    Super::BeginPlay();
-}
-
+    //자동 선택을 끄면 bIsTraceDetectionOrNot 백엔드로 고정
+    HitDetectionSelector->SetBackends(AttackTraceComponent, CCDComponent);
+    HitDetectionSelector->bAutoSelect = bAutoSelectHitDetection;
+    HitDetectionSelector->FixedBackend = bIsTraceDetectionOrNot ? EHitDetectionBackend::Sweep : EHitDetectionBackend::CCD;
 
-void AWeapon::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
+    Super::BeginPlay();
 }
 
 EWeaponEnums AWeapon::GetWeaponType() const
@@ -113,8 +108,7 @@ const FTaggedAttackData* AWeapon::GetWeaponAttackDataByTag(const FGameplayTagCon
 
 TScriptInterface<IHitDetectionInterface> AWeapon::GetHitDetectionComponent() const
 {
-    if (bIsTraceDetectionOrNot) return AttackTraceComponent;
-    return CCDComponent;
+    return HitDetectionSelector;
 }
 
 
@@ -122,20 +116,20 @@ void AWeapon::CalculateCalculatedDamage()
 {
 	if (!WeaponData)
 	{
-		DEBUG_LOG(TEXT("WeaponData is null"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("WeaponData is null"));
 		return;
 	}
 
 	if (!OwnerCharacter)
 	{
-		DEBUG_LOG(TEXT("OwnerCharacter is null"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("OwnerCharacter is null"));
 		return;
 	}
 
 	UActionPracticeAttributeSet* AttributeSet = OwnerCharacter->GetAttributeSet();
 	if (!AttributeSet)
 	{
-		DEBUG_LOG(TEXT("APAttributeSet is null"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("APAttributeSet is null"));
 		return;
 	}
 
@@ -151,7 +145,7 @@ void AWeapon::CalculateCalculatedDamage()
 
 	CalculatedDamage = WeaponData->BaseDamage + StrengthBonus + DexterityBonus;
 
-	DEBUG_LOG(TEXT("Calculated Damage: %.2f (Base: %.2f, Str Bonus: %.2f, Dex Bonus: %.2f)"),
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("Calculated Damage: %.2f (Base: %.2f, Str Bonus: %.2f, Dex Bonus: %.2f)"),
 		CalculatedDamage, WeaponData->BaseDamage, StrengthBonus, DexterityBonus);
 }
 
@@ -161,18 +155,10 @@ void AWeapon::EquipWeapon()
 }
 
 
-void AWeapon::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
-{
-    if (OtherActor && OtherActor != this)
-    {
-        DEBUG_LOG(TEXT("Weapon %s hit %s"), *WeaponName, *OtherActor->GetName());
-        //이펙트, 사운드 등 히트 로직 추가
-    }
-}
-
 void AWeapon::HandleWeaponHit(AActor* HitActor, const FHitResult& HitResult, FFinalAttackData FinalAttackData)
 {
-    //OnHit();
+    //이펙트/사운드는 프레임 끝에 병합, 컬링 후 풀에서 재생 (서버 히트는 모든 클라이언트에 전달)
+    UHitImpactSubsystem::BroadcastImpact(OwnerCharacter, WeaponData ? WeaponData->ImpactTable.Get() : nullptr, HitActor, HitResult, FinalAttackData);
 }
 
 void AWeapon::OnStrengthChanged(const FOnAttributeChangeData& Data)
@@ -202,21 +188,21 @@ void AWeapon::BindDelegates()
 	
 	if (!OwnerCharacter)
 	{
-		DEBUG_LOG(TEXT("BindDelegates: No Owner Character"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BindDelegates: No Owner Character"));
 		return;
 	}
 
 	UActionPracticeAttributeSet* AttributeSet = OwnerCharacter->GetAttributeSet();
 	if (!AttributeSet)
 	{
-		DEBUG_LOG(TEXT("BindDelegates: No AttributeSet"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BindDelegates: No AttributeSet"));
 		return;
 	}
 
 	UAbilitySystemComponent* ASC = OwnerCharacter->GetAbilitySystemComponent();
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("BindDelegates: No ASC"));
+		AP_DEBUG_LOG(LogAPCharacter, TEXT("BindDelegates: No ASC"));
 		return;
 	}
 
@@ -224,7 +210,7 @@ void AWeapon::BindDelegates()
 	PlayerStrengthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetStrengthAttribute()).AddUObject(this, &AWeapon::OnStrengthChanged);
 	PlayerDexterityChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetDexterityAttribute()).AddUObject(this, &AWeapon::OnDexterityChanged);
 
-	DEBUG_LOG(TEXT("BindDelegates: Successfully bound all delegates"));
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("BindDelegates: Successfully bound all delegates"));
 }
 
 void AWeapon::UnbindDelegates()
@@ -274,7 +260,7 @@ void AWeapon::UnbindDelegates()
 		PlayerDexterityChangedHandle.Reset();
 	}
 
-	DEBUG_LOG(TEXT("UnbindDelegates: Successfully unbound all delegates"));
+	AP_DEBUG_LOG(LogAPCharacter, TEXT("UnbindDelegates: Successfully unbound all delegates"));
 }
 
 void AWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -2,19 +2,11 @@
 #include "GameFramework/Actor.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameplayTagAssetInterface.h"
-#include "AbilitySystemComponent.h"
 #include "GAS/GameplayTagsDataAsset.h"
-#include "AbilitySystemBlueprintLibrary.h"
 #include "GAS/GameplayTagsSubsystem.h"
-
-#define ENABLE_DEBUG_LOG 1
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogAnimNotifyState_HitDetection, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogAnimNotifyState_HitDetection, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Characters/BaseCharacter.h"
+#include "Notifies/NotifyEventSubsystem.h"
+#include "Games/ActionPracticeLog.h"
 
 UAnimNotifyState_HitDetection::UAnimNotifyState_HitDetection()
 {
@@ -27,7 +19,7 @@ void UAnimNotifyState_HitDetection::NotifyBegin(USkeletalMeshComponent* MeshComp
 {
     Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-    DEBUG_LOG(TEXT("HitDetection NotifyBegin: Anim=%s, Duration=%.3f"),
+    AP_DEBUG_LOG(LogAPAnim, TEXT("HitDetection NotifyBegin: Anim=%s, Duration=%.3f"),
         *GetNameSafe(Animation), TotalDuration);
 
     if (!MeshComp || !MeshComp->GetOwner())
@@ -37,35 +29,24 @@ void UAnimNotifyState_HitDetection::NotifyBegin(USkeletalMeshComponent* MeshComp
     if (!IsValid(Owner))
         return;
 
-    UAbilitySystemComponent* ASC = Owner->FindComponentByClass<UAbilitySystemComponent>();
-    if (!ASC || !IsValid(ASC))
-        return;
+    // 판정 구간 동안 애니메이션 풀 레이트 평가
+    if (ABaseCharacter* Character = Cast<ABaseCharacter>(Owner))
+    {
+        Character->PushFullRateAnimation();
+    }
 
     // AddCombo 이벤트 송신 (HitDetectionStart 이벤트 전에)
-    FGameplayEventData AddComboEventData;
-    AddComboEventData.Instigator = Owner;
-    AddComboEventData.Target = Owner;
-    AddComboEventData.EventTag = UGameplayTagsSubsystem::GetEventNotifyAddComboTag();
-
-    ASC->HandleGameplayEvent(UGameplayTagsSubsystem::GetEventNotifyAddComboTag(), &AddComboEventData);
+    UNotifyEventSubsystem::QueueNotifyEvent(MeshComp, UGameplayTagsSubsystem::GetEventNotifyAddComboTag());
 
-    // HitDetectionStart 이벤트 송신
-    FGameplayEventData EventData;
-    EventData.Instigator = Owner;
-    EventData.Target = Owner;
-    EventData.EventTag = UGameplayTagsSubsystem::GetEventNotifyHitDetectionStartTag();
-
-    // Duration을 EventMagnitude에 저장
-    EventData.EventMagnitude = TotalDuration;
-
-    ASC->HandleGameplayEvent(UGameplayTagsSubsystem::GetEventNotifyHitDetectionStartTag(), &EventData);
+    // HitDetectionStart 이벤트 송신, Duration을 EventMagnitude에 저장
+    UNotifyEventSubsystem::QueueNotifyStateEvent(MeshComp, UGameplayTagsSubsystem::GetEventNotifyHitDetectionStartTag(), EventReference, false, TotalDuration);
 }
 
 void UAnimNotifyState_HitDetection::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
     Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-    DEBUG_LOG(TEXT("HitDetection NotifyEnd: Anim=%s"),
+    AP_DEBUG_LOG(LogAPAnim, TEXT("HitDetection NotifyEnd: Anim=%s"),
         *GetNameSafe(Animation));
 
     if (!MeshComp || !MeshComp->GetOwner())
@@ -75,14 +56,10 @@ void UAnimNotifyState_HitDetection::NotifyEnd(USkeletalMeshComponent* MeshComp,
     if (!IsValid(Owner))
         return;
 
-    UAbilitySystemComponent* ASC = Owner->FindComponentByClass<UAbilitySystemComponent>();
-    if (!ASC || !IsValid(ASC))
-        return;
-
-    FGameplayEventData EventData;
-    EventData.Instigator = Owner;
-    EventData.Target = Owner;
-    EventData.EventTag = UGameplayTagsSubsystem::GetEventNotifyHitDetectionEndTag();
+    if (ABaseCharacter* Character = Cast<ABaseCharacter>(Owner))
+    {
+        Character->PopFullRateAnimation();
+    }
 
-    ASC->HandleGameplayEvent(UGameplayTagsSubsystem::GetEventNotifyHitDetectionEndTag(), &EventData);
+    UNotifyEventSubsystem::QueueNotifyStateEvent(MeshComp, UGameplayTagsSubsystem::GetEventNotifyHitDetectionEndTag(), EventReference, true);
 }
\ No newline at end of file
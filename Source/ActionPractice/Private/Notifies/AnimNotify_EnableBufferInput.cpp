@@ -1,39 +1,14 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
-
 #include "Notifies/AnimNotify_EnableBufferInput.h"
-#include "AbilitySystemBlueprintLibrary.h"
-#include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
 #include "GAS/GameplayTagsSubsystem.h"
+#include "Notifies/NotifyEventSubsystem.h"
+#include "Games/ActionPracticeLog.h"
 
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogAnimNotify_EnableBufferInput, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogAnimNotify_EnableBufferInput, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
 
 void UAnimNotify_EnableBufferInput::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if (!MeshComp || !MeshComp->GetOwner())
-		return;
-
-	AActor* Owner = MeshComp->GetOwner();
-	if (!IsValid(Owner))
-		return;
-
-	UAbilitySystemComponent* ASC = Owner->FindComponentByClass<UAbilitySystemComponent>();
-	if (!ASC || !IsValid(ASC))
-		return;
-
-	FGameplayEventData EventData;
-	EventData.Instigator = Owner;
-	EventData.Target = Owner;
-	EventData.EventTag = UGameplayTagsSubsystem::GetEventNotifyEnableBufferInputTag();
-
-	ASC->HandleGameplayEvent(UGameplayTagsSubsystem::GetEventNotifyEnableBufferInputTag(), &EventData);
-	DEBUG_LOG(TEXT("EnableBufferInput AN"));
+	UNotifyEventSubsystem::QueueNotifyEvent(MeshComp, UGameplayTagsSubsystem::GetEventNotifyEnableBufferInputTag());
+	AP_DEBUG_LOG(LogAPAnim, TEXT("EnableBufferInput AN"));
 }
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include "Notifies/NotifyEventSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemInterface.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "Games/ActionPracticeLog.h"
+
+#pragma region "Dispatch Tick Function"
+void FNotifyEventDispatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->DispatchQueuedEvents();
+	}
+}
+
+FString FNotifyEventDispatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("FNotifyEventDispatchTickFunction");
+}
+#pragma endregion
+
+void UNotifyEventSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	DispatchTickFunction.Subsystem = this;
+	DispatchTickFunction.TickGroup = TG_PrePhysics;
+	DispatchTickFunction.bCanEverTick = true;
+	DispatchTickFunction.bStartWithTickEnabled = true;
+	DispatchTickFunction.bRunOnAnyThread = false;
+	DispatchTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UNotifyEventSubsystem::Deinitialize()
+{
+	if (DispatchTickFunction.IsTickFunctionRegistered())
+	{
+		DispatchTickFunction.UnRegisterTickFunction();
+	}
+	DispatchTickFunction.Subsystem = nullptr;
+
+	{
+		FScopeLock Lock(&PendingEventsLock);
+		PendingEvents.Empty();
+	}
+	DispatchingEvents.Empty();
+	CachedASCs.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UNotifyEventSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNotifyEventSubsystem, STATGROUP_Tickables);
+}
+
+void UNotifyEventSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	//등록되지 않은 메시나 전달 Tick 이후에 쌓인 이벤트
+	DispatchQueuedEvents();
+}
+
+#pragma region "Tick Ordering"
+void UNotifyEventSubsystem::RegisterAnimatedMesh(USkeletalMeshComponent* MeshComp)
+{
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	UNotifyEventSubsystem* Subsystem = World ? World->GetSubsystem<UNotifyEventSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	//병렬 애니메이션 평가의 노티파이 처리도 메시 Tick 완료 전에 끝남
+	Subsystem->DispatchTickFunction.AddPrerequisite(MeshComp, MeshComp->PrimaryComponentTick);
+}
+
+void UNotifyEventSubsystem::UnregisterAnimatedMesh(USkeletalMeshComponent* MeshComp)
+{
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	UNotifyEventSubsystem* Subsystem = World ? World->GetSubsystem<UNotifyEventSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	Subsystem->DispatchTickFunction.RemovePrerequisite(MeshComp, MeshComp->PrimaryComponentTick);
+}
+
+void UNotifyEventSubsystem::AddDispatchPrerequisite(UActorComponent* Component, FTickFunction& TickFunction)
+{
+	UWorld* World = Component ? Component->GetWorld() : nullptr;
+	UNotifyEventSubsystem* Subsystem = World ? World->GetSubsystem<UNotifyEventSubsystem>() : nullptr;
+	if (!Subsystem) return;
+
+	TickFunction.AddPrerequisite(Subsystem, Subsystem->DispatchTickFunction);
+}
+#pragma endregion
+
+#pragma region "Queue Functions"
+void UNotifyEventSubsystem::QueueNotifyEvent(USkeletalMeshComponent* MeshComp, const FGameplayTag& EventTag, float EventMagnitude)
+{
+	FQueuedNotifyEvent Event;
+	Event.MeshComp = MeshComp;
+	Event.EventTag = EventTag;
+	Event.EventMagnitude = EventMagnitude;
+
+	Enqueue(MoveTemp(Event));
+}
+
+void UNotifyEventSubsystem::QueueNotifyStateEvent(USkeletalMeshComponent* MeshComp, const FGameplayTag& EventTag, const FAnimNotifyEventReference& EventReference, bool bIsStateEnd, float EventMagnitude)
+{
+	FQueuedNotifyEvent Event;
+	Event.MeshComp = MeshComp;
+	Event.EventTag = EventTag;
+	Event.EventMagnitude = EventMagnitude;
+	Event.StateNotify = EventReference.GetNotify();
+	Event.bIsStateEnd = bIsStateEnd;
+
+	Enqueue(MoveTemp(Event));
+}
+
+void UNotifyEventSubsystem::Enqueue(FQueuedNotifyEvent&& Event)
+{
+	USkeletalMeshComponent* MeshComp = Event.MeshComp.Get();
+	if (!MeshComp || !IsValid(MeshComp->GetOwner()) || !Event.EventTag.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = MeshComp->GetWorld();
+	UNotifyEventSubsystem* Subsystem = World ? World->GetSubsystem<UNotifyEventSubsystem>() : nullptr;
+
+	//서브시스템이 없는 월드(에디터 프리뷰 등)는 즉시 전달
+	if (!Subsystem)
+	{
+		SendEvent(FindASC(MeshComp), MeshComp->GetOwner(), Event);
+		return;
+	}
+
+	FScopeLock Lock(&Subsystem->PendingEventsLock);
+	Subsystem->PendingEvents.Add(MoveTemp(Event));
+}
+#pragma endregion
+
+#pragma region "Dispatch Functions"
+UAbilitySystemComponent* UNotifyEventSubsystem::FindASC(const USkeletalMeshComponent* MeshComp)
+{
+	AActor* Owner = MeshComp ? MeshComp->GetOwner() : nullptr;
+	if (!Owner) return nullptr;
+
+	if (const IAbilitySystemInterface* AbilitySystemInterface = Cast<IAbilitySystemInterface>(Owner))
+	{
+		return AbilitySystemInterface->GetAbilitySystemComponent();
+	}
+
+	return Owner->FindComponentByClass<UAbilitySystemComponent>();
+}
+
+UAbilitySystemComponent* UNotifyEventSubsystem::ResolveASC(USkeletalMeshComponent* MeshComp)
+{
+	//파괴된 메시 항목 정리
+	if (CachedASCs.Num() > 64)
+	{
+		for (auto It = CachedASCs.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr()) It.RemoveCurrent();
+		}
+	}
+
+	TWeakObjectPtr<UAbilitySystemComponent>& CachedASC = CachedASCs.FindOrAdd(MeshComp);
+	if (!CachedASC.IsValid())
+	{
+		CachedASC = FindASC(MeshComp);
+	}
+
+	return CachedASC.Get();
+}
+
+void UNotifyEventSubsystem::SendEvent(UAbilitySystemComponent* ASC, AActor* Owner, const FQueuedNotifyEvent& Event)
+{
+	if (!IsValid(ASC) || !IsValid(Owner)) return;
+
+	FGameplayEventData EventData;
+	EventData.Instigator = Owner;
+	EventData.Target = Owner;
+	EventData.EventTag = Event.EventTag;
+	EventData.EventMagnitude = Event.EventMagnitude;
+
+	ASC->HandleGameplayEvent(Event.EventTag, &EventData);
+}
+
+void UNotifyEventSubsystem::DispatchQueuedEvents()
+{
+	{
+		FScopeLock Lock(&PendingEventsLock);
+		if (PendingEvents.IsEmpty()) return;
+
+		Swap(PendingEvents, DispatchingEvents);
+	}
+
+	//이번 배치에서 앞선 Begin이 없는 End = 이전 프레임에 시작된 구간의 종료, 새 구간 시작보다 먼저 전달
+	TSet<TPair<const USkeletalMeshComponent*, const FAnimNotifyEvent*>> BegunStates;
+	TArray<uint8, TInlineAllocator<32>> DispatchGroups;
+	DispatchGroups.Reserve(DispatchingEvents.Num());
+
+	for (const FQueuedNotifyEvent& Event : DispatchingEvents)
+	{
+		uint8 Group = 1;
+		if (Event.StateNotify)
+		{
+			const TPair<const USkeletalMeshComponent*, const FAnimNotifyEvent*> Key(Event.MeshComp.Get(), Event.StateNotify);
+			if (!Event.bIsStateEnd) BegunStates.Add(Key);
+			else if (!BegunStates.Contains(Key)) Group = 0;
+		}
+		DispatchGroups.Add(Group);
+	}
+
+	//그룹 0 먼저, 그룹 내에서는 큐에 들어온 순서 유지
+	for (uint8 Group = 0; Group <= 1; ++Group)
+	{
+		for (int32 Index = 0; Index < DispatchingEvents.Num(); ++Index)
+		{
+			if (DispatchGroups[Index] != Group) continue;
+
+			const FQueuedNotifyEvent& Event = DispatchingEvents[Index];
+			USkeletalMeshComponent* MeshComp = Event.MeshComp.Get();
+			if (!MeshComp) continue;
+
+			AP_DEBUG_LOG(LogAPAnim, TEXT("Dispatch: %s -> %s"), *Event.EventTag.ToString(), *GetNameSafe(MeshComp->GetOwner()));
+			SendEvent(ResolveASC(MeshComp), MeshComp->GetOwner(), Event);
+		}
+	}
+
+	DispatchingEvents.Reset();
+}
+#pragma endregion
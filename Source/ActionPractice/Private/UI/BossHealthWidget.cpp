@@ -1,16 +1,12 @@
 ﻿#include "UI/BossHealthWidget.h"
+#include "Components/InvalidationBox.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "GAS/AttributeSet/BossAttributeSet.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogBossHealthWidget, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogBossHealthWidget, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "Games/ActionPracticeLog.h"
 
 void UBossHealthWidget::NativeConstruct()
 {
@@ -26,45 +22,59 @@ void UBossHealthWidget::NativeConstruct()
 		BossHealthDamageBar->SetPercent(1.0f);
 	}
 
-	DEBUG_LOG(TEXT("BossHealthWidget Constructed"));
-}
+	//AddToViewport 전에 AttributeSet이 설정된 경우 현재 값으로 초기화
+	if (BossAttributeSet && BossAttributeSet->GetMaxHealth() > 0.0f)
+	{
+		CurrentBossHealthPercent = BossAttributeSet->GetHealth() / BossAttributeSet->GetMaxHealth();
+		TargetBossHealthDamagePercent = CurrentBossHealthPercent;
 
-void UBossHealthWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-	Super::NativeTick(MyGeometry, InDeltaTime);
+		if (BossHealthBar) BossHealthBar->SetPercent(CurrentBossHealthPercent);
+		if (BossHealthDamageBar) BossHealthDamageBar->SetPercent(CurrentBossHealthPercent);
+	}
 
-	if (BossAttributeSet)
+	//HUD는 입력을 받지 않으므로 히트 테스트 제외
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+
+	//바 값/이름이 바뀔 때만 캐시 무효화
+	if (BossInvalidationBox)
+	{
+		BossInvalidationBox->SetCanCache(true);
+	}
+	else
 	{
-		UpdateBossHealth(BossAttributeSet->GetHealth(), BossAttributeSet->GetMaxHealth());
+		AP_DEBUG_LOG(LogAPUI, TEXT("BossInvalidationBox not bound, HUD is repainted every frame"));
 	}
 
-	UpdateDamageBars(InDeltaTime);
+	AP_DEBUG_LOG(LogAPUI, TEXT("BossHealthWidget Constructed"));
 }
 
 void UBossHealthWidget::SetBossAttributeSet(UBossAttributeSet* InAttributeSet)
 {
 	if (!InAttributeSet)
 	{
-		DEBUG_LOG(TEXT("BossAttributeSet Invalid!"));
+		AP_DEBUG_LOG(LogAPUI, TEXT("BossAttributeSet Invalid!"));
 		return;
 	}
 
+	UnbindAttributeDelegates();
 	BossAttributeSet = InAttributeSet;
-	DEBUG_LOG(TEXT("BossAttributeSet set to BossHealthWidget"));
+	BindAttributeDelegates();
+
+	AP_DEBUG_LOG(LogAPUI, TEXT("BossAttributeSet set to BossHealthWidget"));
 }
 
 void UBossHealthWidget::SetBossName(const FName& InBossName)
 {
 	if (!BossNameText)
 	{
-		DEBUG_LOG(TEXT("BossNameText is nullptr"));
+		AP_DEBUG_LOG(LogAPUI, TEXT("BossNameText is nullptr"));
 		return;
 	}
 
 	FText BossNameAsText = FText::FromName(InBossName);
 	BossNameText->SetText(BossNameAsText);
 
-	DEBUG_LOG(TEXT("Boss name set to: %s"), *InBossName.ToString());
+	AP_DEBUG_LOG(LogAPUI, TEXT("Boss name set to: %s"), *InBossName.ToString());
 }
 
 void UBossHealthWidget::UpdateBossHealth(float CurrentHealth, float MaxHealth)
@@ -82,6 +92,7 @@ void UBossHealthWidget::UpdateBossHealth(float CurrentHealth, float MaxHealth)
 		BossHealthBar->SetPercent(NewHealthPercent);
 		TargetBossHealthDamagePercent = NewHealthPercent;
 		CurrentBossHealthDelayTimer = 0.0f;
+		StartDamageBarAnimation();
 	}
 
 	//Boss HP 증가
@@ -100,25 +111,127 @@ void UBossHealthWidget::UpdateBossHealth(float CurrentHealth, float MaxHealth)
 	CurrentBossHealthPercent = NewHealthPercent;
 }
 
-void UBossHealthWidget::UpdateDamageBars(float DeltaTime)
+void UBossHealthWidget::BindAttributeDelegates()
+{
+	if (!BossAttributeSet)
+	{
+		AP_DEBUG_LOG(LogAPUI, TEXT("No BossAttributeSet"));
+		return;
+	}
+
+	UAbilitySystemComponent* ASC = BossAttributeSet->GetOwningAbilitySystemComponent();
+	if (!ASC)
+	{
+		AP_DEBUG_LOG(LogAPUI, TEXT("Failed to get ASC from BossAttributeSet"));
+		return;
+	}
+
+	HealthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(BossAttributeSet->GetHealthAttribute()).AddUObject(this, &UBossHealthWidget::OnHealthChanged);
+	MaxHealthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(BossAttributeSet->GetMaxHealthAttribute()).AddUObject(this, &UBossHealthWidget::OnMaxHealthChanged);
+
+	//초기 UI 업데이트
+	UpdateBossHealth(BossAttributeSet->GetHealth(), BossAttributeSet->GetMaxHealth());
+}
+
+void UBossHealthWidget::UnbindAttributeDelegates()
 {
-	if (BossHealthDamageBar && BossHealthDamageBar->GetPercent() > TargetBossHealthDamagePercent)
+	if (!BossAttributeSet)
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* ASC = BossAttributeSet->GetOwningAbilitySystemComponent();
+	if (!ASC)
 	{
-		CurrentBossHealthDelayTimer += DeltaTime;
+		return;
+	}
+
+	if (HealthChangedHandle.IsValid())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(BossAttributeSet->GetHealthAttribute()).Remove(HealthChangedHandle);
+		HealthChangedHandle.Reset();
+	}
+
+	if (MaxHealthChangedHandle.IsValid())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(BossAttributeSet->GetMaxHealthAttribute()).Remove(MaxHealthChangedHandle);
+		MaxHealthChangedHandle.Reset();
+	}
+}
 
-		if (CurrentBossHealthDelayTimer >= DamageBarDelayTime)
+void UBossHealthWidget::OnHealthChanged(const FOnAttributeChangeData& Data)
+{
+	if (BossAttributeSet)
+	{
+		UpdateBossHealth(Data.NewValue, BossAttributeSet->GetMaxHealth());
+	}
+}
+
+void UBossHealthWidget::OnMaxHealthChanged(const FOnAttributeChangeData& Data)
+{
+	if (BossAttributeSet)
+	{
+		UpdateBossHealth(BossAttributeSet->GetHealth(), Data.NewValue);
+	}
+}
+
+void UBossHealthWidget::StartDamageBarAnimation()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (!TimerManager.IsTimerActive(DamageBarTimerHandle))
+	{
+		TimerManager.SetTimer(DamageBarTimerHandle, this, &UBossHealthWidget::OnDamageBarTimer, DamageBarUpdateInterval, true);
+	}
+}
+
+void UBossHealthWidget::OnDamageBarTimer()
+{
+	//지연 바가 따라잡으면 타이머 정지
+	if (!UpdateDamageBars(DamageBarUpdateInterval))
+	{
+		if (UWorld* World = GetWorld())
 		{
-			float CurrentPercent = BossHealthDamageBar->GetPercent();
-			float NewPercent = FMath::FInterpTo(CurrentPercent, TargetBossHealthDamagePercent, DeltaTime, DamageBarLerpSpeed);
-			BossHealthDamageBar->SetPercent(NewPercent);
-			DEBUG_LOG(TEXT("Boss HP Lerp Applied: NewPercent=%f"), NewPercent);
+			World->GetTimerManager().ClearTimer(DamageBarTimerHandle);
 		}
 	}
 }
 
+bool UBossHealthWidget::UpdateDamageBars(float DeltaTime)
+{
+	if (!BossHealthDamageBar || BossHealthDamageBar->GetPercent() <= TargetBossHealthDamagePercent)
+	{
+		return false;
+	}
+
+	CurrentBossHealthDelayTimer += DeltaTime;
+
+	if (CurrentBossHealthDelayTimer >= DamageBarDelayTime)
+	{
+		float CurrentPercent = BossHealthDamageBar->GetPercent();
+		float NewPercent = FMath::FInterpTo(CurrentPercent, TargetBossHealthDamagePercent, DeltaTime, DamageBarLerpSpeed);
+
+		//근접하면 목표값으로 맞춰 애니메이션 종료
+		if (NewPercent - TargetBossHealthDamagePercent <= KINDA_SMALL_NUMBER) NewPercent = TargetBossHealthDamagePercent;
+		BossHealthDamageBar->SetPercent(NewPercent);
+		AP_DEBUG_LOG(LogAPUI, TEXT("Boss HP Lerp Applied: NewPercent=%f"), NewPercent);
+	}
+
+	return true;
+}
+
 void UBossHealthWidget::NativeDestruct()
 {
+	UnbindAttributeDelegates();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DamageBarTimerHandle);
+	}
+
 	Super::NativeDestruct();
 
-	DEBUG_LOG(TEXT("BossHealthWidget Destructed"));
+	AP_DEBUG_LOG(LogAPUI, TEXT("BossHealthWidget Destructed"));
 }
\ No newline at end of file
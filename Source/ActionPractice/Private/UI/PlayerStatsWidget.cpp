@@ -1,18 +1,14 @@
 ﻿#include "UI/PlayerStatsWidget.h"
 
 #include "Components/CanvasPanelSlot.h"
+#include "Components/InvalidationBox.h"
 #include "Components/ProgressBar.h"
 #include "Components/VerticalBox.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "GAS/AttributeSet/ActionPracticeAttributeSet.h"
-
-#define ENABLE_DEBUG_LOG 0
-
-#if ENABLE_DEBUG_LOG
-	DEFINE_LOG_CATEGORY_STATIC(LogPlayerStatsWidget, Log, All);
-#define DEBUG_LOG(Format, ...) UE_LOG(LogPlayerStatsWidget, Warning, Format, ##__VA_ARGS__)
-#else
-#define DEBUG_LOG(Format, ...)
-#endif
+#include "Games/ActionPracticeLog.h"
 
 void UPlayerStatsWidget::NativeConstruct()
 {
@@ -38,35 +34,35 @@ void UPlayerStatsWidget::NativeConstruct()
 		StaminaDamageBar->SetPercent(1.0f);
 	}
 
-	DEBUG_LOG(TEXT("PlayerStatsWidget Constructed"));
-}
-
-void UPlayerStatsWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
-{
-	Super::NativeTick(MyGeometry, InDeltaTime);
+	//HUD는 입력을 받지 않으므로 히트 테스트 제외
+	SetVisibility(ESlateVisibility::HitTestInvisible);
 
-	if (AttributeSet)
+	//바 값이 바뀔 때만 캐시 무효화
+	if (StatsInvalidationBox)
 	{
-		UpdateHealth(AttributeSet->GetHealth(), AttributeSet->GetMaxHealth());
-		UpdateStamina(AttributeSet->GetStamina(), AttributeSet->GetMaxStamina());
+		StatsInvalidationBox->SetCanCache(true);
+	}
+	else
+	{
+		AP_DEBUG_LOG(LogAPUI, TEXT("StatsInvalidationBox not bound, HUD is repainted every frame"));
 	}
 
-	UpdateDamageBars(InDeltaTime);
+	AP_DEBUG_LOG(LogAPUI, TEXT("PlayerStatsWidget Constructed"));
 }
 
 void UPlayerStatsWidget::SetAttributeSet(UActionPracticeAttributeSet* InAttributeSet)
 {
 	if (!InAttributeSet)
 	{
-		DEBUG_LOG(TEXT("AttributeSet Invalid!"));
+		AP_DEBUG_LOG(LogAPUI, TEXT("AttributeSet Invalid!"));
 		return;
 	}
 	
-	AttributeSet = InAttributeSet;
 	UnbindAttributeDelegates();
+	AttributeSet = InAttributeSet;
 	BindAttributeDelegates();
 	
-	DEBUG_LOG(TEXT("AttributeSet set to PlayerStatsWidget"));
+	AP_DEBUG_LOG(LogAPUI, TEXT("AttributeSet set to PlayerStatsWidget"));
 }
 
 void UPlayerStatsWidget::UpdateHealth(float CurrentHealth, float MaxHealth)
@@ -84,6 +80,7 @@ void UPlayerStatsWidget::UpdateHealth(float CurrentHealth, float MaxHealth)
 		HealthBar->SetPercent(NewHealthPercent);
 		TargetHealthDamagePercent = NewHealthPercent;
 		CurrentHealthDelayTimer = 0.0f;
+		StartDamageBarAnimation();
 	}
 	
 	//HP 증가
@@ -118,8 +115,9 @@ void UPlayerStatsWidget::UpdateStamina(float CurrentStamina, float MaxStamina)
 
 		//지속 감소일 경우 지연 X, 일반 바와 같이 감소
 		if (NewStaminaPercent < CurrentStaminaPercent - 0.01f) TargetStaminaDamagePercent = NewStaminaPercent;
-		else StaminaDamageBar->SetPercent(NewStaminaPercent);
+		else if (StaminaDamageBar) StaminaDamageBar->SetPercent(NewStaminaPercent);
 		CurrentStaminaDelayTimer = 0.0f;
+		StartDamageBarAnimation();
 	}
 	
 	//스테미나 증가
@@ -150,7 +148,7 @@ void UPlayerStatsWidget::UpdateHealthBarSize(float MaxHealth)
 
 	CanvasSlot->SetSize(FVector2D(BarWidth, CurrentSize.Y));
     
-    DEBUG_LOG(TEXT("Health Bar Size Updated: MaxHP=%.1f, BarWidth=%.1f"), ClampedMaxHealth, BarWidth);
+    AP_DEBUG_LOG(LogAPUI, TEXT("Health Bar Size Updated: MaxHP=%.1f, BarWidth=%.1f"), ClampedMaxHealth, BarWidth);
 }
 
 void UPlayerStatsWidget::UpdateStaminaBarSize(float MaxStamina)
@@ -165,14 +163,14 @@ void UPlayerStatsWidget::UpdateStaminaBarSize(float MaxStamina)
 
 	CanvasSlot->SetSize(FVector2D(BarWidth, CurrentSize.Y));
     
-	DEBUG_LOG(TEXT("Stamina Bar Size Updated: MaxStamina=%.1f, BarWidth=%.1f"), ClampedMaxStamina, BarWidth);
+	AP_DEBUG_LOG(LogAPUI, TEXT("Stamina Bar Size Updated: MaxStamina=%.1f, BarWidth=%.1f"), ClampedMaxStamina, BarWidth);
 }
 
 void UPlayerStatsWidget::BindAttributeDelegates()
 {
 	if (!AttributeSet)
 	{
-		DEBUG_LOG(TEXT("No AttributeSet"));
+		AP_DEBUG_LOG(LogAPUI, TEXT("No AttributeSet"));
 		return;
 	}
 	
@@ -180,18 +178,22 @@ void UPlayerStatsWidget::BindAttributeDelegates()
     
 	if (!ASC)
 	{
-		DEBUG_LOG(TEXT("Failed to get ASC from AttributeSet"));
+		AP_DEBUG_LOG(LogAPUI, TEXT("Failed to get ASC from AttributeSet"));
 		return;
 	}
     
+	HealthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetHealthAttribute()).AddUObject(this, &UPlayerStatsWidget::OnHealthChanged);
 	MaxHealthChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMaxHealthAttribute()).AddUObject(this, &UPlayerStatsWidget::OnMaxHealthChanged);
+	StaminaChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetStaminaAttribute()).AddUObject(this, &UPlayerStatsWidget::OnStaminaChanged);
 	MaxStaminaChangedHandle = ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMaxStaminaAttribute()).AddUObject(this, &UPlayerStatsWidget::OnMaxStaminaChanged);
     
-	DEBUG_LOG(TEXT("Attribute Delegates Bound Successfully"));
+	AP_DEBUG_LOG(LogAPUI, TEXT("Attribute Delegates Bound Successfully"));
     
 	//초기 UI 업데이트
 	UpdateHealthBarSize(AttributeSet->GetMaxHealth());
 	UpdateStaminaBarSize(AttributeSet->GetMaxStamina());
+	UpdateHealth(AttributeSet->GetHealth(), AttributeSet->GetMaxHealth());
+	UpdateStamina(AttributeSet->GetStamina(), AttributeSet->GetMaxStamina());
 }
 
 void UPlayerStatsWidget::UnbindAttributeDelegates()
@@ -207,74 +209,144 @@ void UPlayerStatsWidget::UnbindAttributeDelegates()
 		return;
 	}
     
+	if (HealthChangedHandle.IsValid())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetHealthAttribute()).Remove(HealthChangedHandle);
+		HealthChangedHandle.Reset();
+	}
+
 	if (MaxHealthChangedHandle.IsValid())
 	{
 		ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMaxHealthAttribute()).Remove(MaxHealthChangedHandle);
 		MaxHealthChangedHandle.Reset();
 	}
 	
+	if (StaminaChangedHandle.IsValid())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetStaminaAttribute()).Remove(StaminaChangedHandle);
+		StaminaChangedHandle.Reset();
+	}
+
 	if (MaxStaminaChangedHandle.IsValid())
 	{
 		ASC->GetGameplayAttributeValueChangeDelegate(AttributeSet->GetMaxStaminaAttribute()).Remove(MaxStaminaChangedHandle);
 		MaxStaminaChangedHandle.Reset();
 	}
     
-	DEBUG_LOG(TEXT("Attribute Delegates Unbound Successfully"));
+	AP_DEBUG_LOG(LogAPUI, TEXT("Attribute Delegates Unbound Successfully"));
+}
+
+void UPlayerStatsWidget::OnHealthChanged(const FOnAttributeChangeData& Data)
+{
+	if (AttributeSet)
+	{
+		UpdateHealth(Data.NewValue, AttributeSet->GetMaxHealth());
+	}
 }
 
 void UPlayerStatsWidget::OnMaxHealthChanged(const FOnAttributeChangeData& Data)
 {
-	DEBUG_LOG(TEXT("MaxHealth Changed: Old=%.2f, New=%.2f"), Data.OldValue, Data.NewValue);
+	AP_DEBUG_LOG(LogAPUI, TEXT("MaxHealth Changed: Old=%.2f, New=%.2f"), Data.OldValue, Data.NewValue);
     
 	if (AttributeSet)
 	{
 		UpdateHealthBarSize(Data.NewValue);
+		UpdateHealth(AttributeSet->GetHealth(), Data.NewValue);
+	}
+}
+
+void UPlayerStatsWidget::OnStaminaChanged(const FOnAttributeChangeData& Data)
+{
+	if (AttributeSet)
+	{
+		UpdateStamina(Data.NewValue, AttributeSet->GetMaxStamina());
 	}
 }
 
 void UPlayerStatsWidget::OnMaxStaminaChanged(const FOnAttributeChangeData& Data)
 {
-	DEBUG_LOG(TEXT("MaxStamina Changed: Old=%.2f, New=%.2f"), Data.OldValue, Data.NewValue);
+	AP_DEBUG_LOG(LogAPUI, TEXT("MaxStamina Changed: Old=%.2f, New=%.2f"), Data.OldValue, Data.NewValue);
     
 	if (AttributeSet)
 	{
 		UpdateStaminaBarSize(Data.NewValue);
+		UpdateStamina(AttributeSet->GetStamina(), Data.NewValue);
+	}
+}
+
+void UPlayerStatsWidget::StartDamageBarAnimation()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (!TimerManager.IsTimerActive(DamageBarTimerHandle))
+	{
+		TimerManager.SetTimer(DamageBarTimerHandle, this, &UPlayerStatsWidget::OnDamageBarTimer, DamageBarUpdateInterval, true);
+	}
+}
+
+void UPlayerStatsWidget::OnDamageBarTimer()
+{
+	//모든 지연 바가 따라잡으면 타이머 정지
+	if (!UpdateDamageBars(DamageBarUpdateInterval))
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(DamageBarTimerHandle);
+		}
 	}
 }
 
-void UPlayerStatsWidget::UpdateDamageBars(float DeltaTime)
+bool UPlayerStatsWidget::UpdateDamageBars(float DeltaTime)
 {
+	bool bIsAnimating = false;
+
 	if (HealthDamageBar && HealthDamageBar->GetPercent() > TargetHealthDamagePercent)
 	{
+		bIsAnimating = true;
 		CurrentHealthDelayTimer += DeltaTime;
 
 		if (CurrentHealthDelayTimer >= DamageBarDelayTime)
 		{
 			float CurrentPercent = HealthDamageBar->GetPercent();
 			float NewPercent = FMath::FInterpTo(CurrentPercent, TargetHealthDamagePercent, DeltaTime, DamageBarLerpSpeed);
+
+			//근접하면 목표값으로 맞춰 애니메이션 종료
+			if (NewPercent - TargetHealthDamagePercent <= KINDA_SMALL_NUMBER) NewPercent = TargetHealthDamagePercent;
 			HealthDamageBar->SetPercent(NewPercent);
-			DEBUG_LOG(TEXT("HP Lerp Applied: NewPercent=%f"), NewPercent);
+			AP_DEBUG_LOG(LogAPUI, TEXT("HP Lerp Applied: NewPercent=%f"), NewPercent);
 		}
 	}
 
 	if (StaminaDamageBar && StaminaDamageBar->GetPercent() > TargetStaminaDamagePercent)
 	{
+		bIsAnimating = true;
 		CurrentStaminaDelayTimer += DeltaTime;
 
 		if (CurrentStaminaDelayTimer >= DamageBarDelayTime)
 		{
 			float CurrentPercent = StaminaDamageBar->GetPercent();
 			float NewPercent = FMath::FInterpTo(CurrentPercent, TargetStaminaDamagePercent, DeltaTime, DamageBarLerpSpeed);
+
+			if (NewPercent - TargetStaminaDamagePercent <= KINDA_SMALL_NUMBER) NewPercent = TargetStaminaDamagePercent;
 			StaminaDamageBar->SetPercent(NewPercent);
 			
-			DEBUG_LOG(TEXT("ST Lerp Applied: NewPercent=%f"), NewPercent);
+			AP_DEBUG_LOG(LogAPUI, TEXT("ST Lerp Applied: NewPercent=%f"), NewPercent);
 		}
 	}
+
+	return bIsAnimating;
 }
 
 void UPlayerStatsWidget::NativeDestruct()
 {
 	UnbindAttributeDelegates();
 
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DamageBarTimerHandle);
+	}
+
 	Super::NativeDestruct();
 }
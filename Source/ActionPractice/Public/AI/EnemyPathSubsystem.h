@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "EnemyPathSubsystem.generated.h"
+
+class AAIController;
+class UNavigationSystemV1;
+
+UENUM()
+enum class EEnemyPathStatus : uint8
+{
+	None,
+	Pending,
+	Following,
+	Failed
+};
+
+//이동 중인 에이전트 하나
+struct FEnemyPathAgent
+{
+	TWeakObjectPtr<AAIController> Controller;
+
+	//GoalActor가 있으면 매 프레임 액터 위치, 없으면 GoalLocation 고정
+	TWeakObjectPtr<const AActor> GoalActor;
+	FVector GoalLocation = FVector::ZeroVector;
+	float AcceptanceRadius = 100.0f;
+
+	//현재 경로(또는 실패한 쿼리)를 계산한 목표 위치, 여기서 RepathDistance 이상 벗어나면 재경로
+	FVector PathGoal = FVector::ZeroVector;
+
+	EEnemyPathStatus Status = EEnemyPathStatus::None;
+
+	//경로가 필요해진 시각, 예산 초과 시 오래 기다린 순으로 처리
+	double WaitingSince = -1.0;
+
+	//마지막으로 경로 추적을 시작한 시각, 도착 전에 멈춘 에이전트의 재쿼리 간격 제한
+	double FollowStartTime = -1.0;
+
+	//공유 경로의 첫 구간이 막혔던 멤버, 다음 쿼리는 그룹에 합류하지 않고 자기 위치에서
+	bool bNeedsOwnQuery = false;
+};
+
+//진행 중인 비동기 경로 쿼리, 결과를 그룹 전체가 공유
+struct FEnemyPathQuery
+{
+	TArray<TWeakObjectPtr<AAIController>, TInlineAllocator<8>> Members;
+	FVector Goal = FVector::ZeroVector;
+};
+
+/**
+ * Enemy 경로 탐색 일괄 처리
+ * 이동 요청은 SetAgentGoal로 목표만 등록, 경로는 월드 Tick 이후 비동기 쿼리(FindPathAsync)로 계산
+ * 시작점이 가깝고 목표가 같은 에이전트는 쿼리 하나의 결과를 공유 (리더 외에는 시작점만 자기 위치로 바꾼 사본)
+ * 프레임당 쿼리 수 상한, 넘는 그룹은 다음 프레임으로 (오래 기다린 순)
+ * 목표가 RepathDistance 이상 움직였을 때만 재경로, 경로 추적 중 목표 액터 관찰에 의한 동기 재경로는 사용하지 않음
+ * 도착 전에 경로 추적이 끝난(이전 목표 도착, StopMovement 등) 에이전트는 IdleRetryInterval 간격으로 재쿼리
+ * 공유 경로는 멤버 위치에서 경로 두 번째 점까지 내비 레이캐스트로 확인, 막히면 그 멤버만 따로 쿼리
+ * stat Combat의 Path 카운터로 확인
+ */
+UCLASS()
+class ACTIONPRACTICE_API UEnemyPathSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//이동 Task EnterState/ExitState에서 호출
+	static void SetAgentGoal(AAIController* Controller, const AActor* GoalActor, const FVector& GoalLocation, float AcceptanceRadius);
+	static void ClearAgentGoal(AAIController* Controller);
+
+	static EEnemyPathStatus GetAgentStatus(const AAIController* Controller);
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TArray<FEnemyPathAgent> Agents;
+
+	TMap<uint32, FEnemyPathQuery> PendingQueries;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	FEnemyPathAgent* FindAgent(const AAIController* Controller);
+	static FVector GetAgentGoal(const FEnemyPathAgent& Agent);
+
+	void IssueQueries(UNavigationSystemV1* NavSys);
+	void HandlePathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	//리더가 아닌 멤버용 경로 사본, 시작점만 멤버 위치로 교체
+	//멤버 위치에서 다음 경로 점까지 내비메시로 직선 이동할 수 없으면 nullptr
+	static FNavPathSharedPtr MakeMemberPath(const FNavPathSharedPtr& SourcePath, const AAIController* Controller, const FVector& Start);
+	void FollowPath(FEnemyPathAgent& Agent, const FNavPathSharedPtr& Path) const;
+
+	//Following 상태지만 도착 전에 경로 추적이 멈춘 에이전트인지
+	bool IsStalled(const FEnemyPathAgent& Agent, double Now) const;
+
+#pragma endregion
+};
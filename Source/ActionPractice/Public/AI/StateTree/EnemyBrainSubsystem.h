@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "EnemyBrainSubsystem.generated.h"
+
+class UGASStateTreeAIComponent;
+class UEnemyBrainSubsystem;
+class AEnemyAIController;
+class APawn;
+
+//Evaluator 입력, 게임 스레드에서 수집한 읽기 전용 값 (UObject 참조 없음)
+struct FEnemyBrainSnapshot
+{
+	FVector SourceLocation = FVector::ZeroVector;
+	FVector SourceForward = FVector::ForwardVector;
+	FVector TargetLocation = FVector::ZeroVector;
+	bool bHasTarget = false;
+
+	float Health = 0.0f;
+	float MaxHealth = 0.0f;
+	bool bHasHealth = false;
+};
+
+//Evaluator 출력, 게임 스레드에서 컨트롤러/컴포넌트에 적용
+struct FEnemyBrainResult
+{
+	float DistanceToTarget = -1.0f;
+	float AngleToTarget = 0.0f;
+	bool bTargetDetected = false;
+	float HealthRate = 1.0f;
+};
+
+//에이전트 폰 이동 이후, StateTree 컴포넌트 Tick 이전에 브레인을 갱신하는 Tick 함수
+USTRUCT()
+struct FEnemyBrainUpdateTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UEnemyBrainSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FEnemyBrainUpdateTickFunction> : public TStructOpsTypeTraitsBase2<FEnemyBrainUpdateTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+//트리 Tick 벤치마크 구간 하나 (일괄 갱신 끔/켬)
+struct FEnemyBrainBenchPhase
+{
+	int32 Frames = 0;
+	int64 AgentFrames = 0;
+	double BrainSeconds = 0.0;
+	double TreeSeconds = 0.0;
+};
+
+/**
+ * Enemy StateTree 브레인 일괄 갱신
+ * 에이전트 폰 이동 이후, StateTree 컴포넌트 Tick 이전의 TG_PrePhysics 전용 Tick 함수에서 3단계로 처리
+ *  1. Gather: 모든 에이전트의 액터/ASC 상태를 스냅샷으로 수집
+ *  2. Evaluate: 스냅샷만 읽는 순수 계산(타겟 거리/각도, 체력 비율), 등록 순서대로
+ *  3. Apply: 결과를 AIController의 CurrentTarget과 컴포넌트에 기록
+ * 같은 프레임 StateTree Tick의 Evaluator는 액터를 다시 읽지 않고 결과만 복사
+ * 트리 실행(Task의 어빌리티 활성화, 이동)은 UObject를 변경하므로 모든 단계가 게임 스레드
+ * 에이전트당 평가가 수십 ns 수준이라 작업 스레드 분배는 하지 않음, 이득은 액터/ASC 접근을 Gather 한 번으로 모은 데 있음
+ * 실측: ap.AI.BrainBench Frames=300 (현재 월드 에이전트의 실제 트리 Tick을 일괄 갱신 끔/켬으로 비교)
+ */
+UCLASS()
+class ACTIONPRACTICE_API UEnemyBrainSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//컴포넌트 BeginPlay/EndPlay에서 호출, 컴포넌트 Tick이 브레인 갱신 Tick 이후에 실행
+	static void RegisterAgent(UGASStateTreeAIComponent* Component);
+	static void UnregisterAgent(UGASStateTreeAIComponent* Component);
+
+	//컨트롤러 OnPossess/OnUnPossess에서 호출, 브레인 갱신 Tick이 폰 이동 이후에 실행
+	static void RegisterAgentPawn(APawn* Pawn);
+	static void UnregisterAgentPawn(APawn* Pawn);
+
+	//일괄 갱신이 꺼져 있는지, 꺼져 있으면 Evaluator가 직접 계산
+	static bool IsBatchUpdateEnabled();
+
+	//게임 스레드 전용
+	static bool GatherSnapshot(const AEnemyAIController* AIController, FEnemyBrainSnapshot& OutSnapshot);
+
+	//스냅샷만 읽음
+	static void EvaluateSnapshot(const FEnemyBrainSnapshot& Snapshot, FEnemyBrainResult& OutResult);
+	static void EvaluateSnapshots(TConstArrayView<FEnemyBrainSnapshot> Snapshots, TArrayView<FEnemyBrainResult> OutResults);
+
+	//브레인 갱신 Tick 함수에서 호출
+	void UpdateBrains();
+
+	//===== Benchmark =====
+	//Frames 프레임씩 일괄 갱신 끔 -> 켬 순서로 트리 Tick 시간 측정, 끝나면 로그와 CSV 기록 후 원래 설정 복원
+	bool StartTreeTickBenchmark(int32 Frames);
+	bool IsBenchmarking() const { return bBenchmarking; }
+
+	//UGASStateTreeAIComponent Tick에서 벤치마크 중일 때만 호출
+	void AddTreeTickTime(double Seconds) { FrameTreeSeconds += Seconds; }
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	//등록 순서 유지, 평가/적용 순서
+	TArray<TWeakObjectPtr<UGASStateTreeAIComponent>> Agents;
+
+	//프레임마다 재사용 (Agents와 같은 인덱스)
+	TArray<FEnemyBrainSnapshot> Snapshots;
+	TArray<FEnemyBrainResult> Results;
+	TArray<bool> SnapshotValid;
+
+	FEnemyBrainUpdateTickFunction UpdateTickFunction;
+
+	//===== Benchmark =====
+	bool bBenchmarking = false;
+	bool bBenchSkipFrame = false;
+	bool bBatchBeforeBench = true;
+	int32 BenchFrames = 0;
+	int32 BenchPhaseIndex = 0;
+	FEnemyBrainBenchPhase BenchPhases[2];
+	double FrameBrainSeconds = 0.0;
+	double FrameTreeSeconds = 0.0;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	void GatherSnapshots();
+	void ApplyResults();
+
+	void FinishTreeTickBenchmark();
+
+#pragma endregion
+};
@@ -5,6 +5,7 @@
 #include "HealthRateEvaluator.generated.h"
 
 class UAbilitySystemComponent;
+class AEnemyAIController;
 
 /**
  * Evaluator Instance Data
@@ -20,6 +21,10 @@ struct ACTIONPRACTICE_API FHealthRateEvaluatorInstanceData
 	UPROPERTY(EditAnywhere, Category = "Context")
 	TObjectPtr<UAbilitySystemComponent> AbilitySystemComponent = nullptr;
 
+	//있으면 EnemyBrainSubsystem 일괄 갱신 결과 사용
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<AEnemyAIController> AIController = nullptr;
+
 	//Output: 현재 체력 비율 (0.0 ~ 1.0)
 	UPROPERTY(EditAnywhere, Category = "Output")
 	float HealthRate = 1.0f;
@@ -3,11 +3,13 @@
 #include "CoreMinimal.h"
 #include "Components/StateTreeAIComponent.h"
 #include "GASStateTreeAIComponentSchema.h" // StaticClass 사용을 위해 포함
+#include "AI/StateTree/EnemyBrainSubsystem.h"
 #include "GASStateTreeAIComponent.generated.h"
 
 /**
  * GAS 통합을 위한 커스텀 StateTree AI Component
  * - GetSchema 오버라이드만으로 커스텀 스키마 지정
+ * - EnemyBrainSubsystem에 등록, Tick은 브레인 갱신 이후 실행되고 Evaluator 입력은 같은 프레임 일괄 갱신 결과(BrainResult)를 사용
  */
 UCLASS(ClassGroup = AI, Blueprintable, meta = (BlueprintSpawnableComponent))
 class ACTIONPRACTICE_API UGASStateTreeAIComponent : public UStateTreeAIComponent
@@ -16,4 +18,24 @@ class ACTIONPRACTICE_API UGASStateTreeAIComponent : public UStateTreeAIComponent
 
 public:
 	virtual TSubclassOf<UStateTreeSchema> GetSchema() const override;
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	//EnemyBrainSubsystem Apply 단계에서 호출, Target은 스냅샷을 수집할 때의 타겟
+	void SetBrainResult(const FEnemyBrainResult& InResult, const AActor* InTarget);
+
+	//이번 프레임 일괄 갱신 결과, 없거나(등록 직후, 일괄 갱신 꺼짐) 그 사이 타겟이 바뀌었으면 지금 직접 계산
+	FEnemyBrainResult GetBrainResult() const;
+
+private:
+	//벤치마크 중 트리 Tick 시간 보고용
+	TWeakObjectPtr<UEnemyBrainSubsystem> BrainSubsystem;
+
+	FEnemyBrainResult BrainResult;
+
+	//결과를 기록한 GFrameCounter, 0이면 결과 없음
+	uint64 BrainResultFrame = 0;
+	TWeakObjectPtr<const AActor> BrainResultTarget;
 };
\ No newline at end of file
@@ -4,10 +4,12 @@
 #include "GameplayAbilitySpecHandle.h"
 #include "StateTreeTaskBase.h"
 #include "GameplayTagContainer.h"
+#include "Engine/TimerHandle.h"
 #include "ActivateAbilityTask.generated.h"
 
 class UAbilitySystemComponent;
 class UGameplayAbility;
+struct FStateTreeWeakExecutionContext;
 
 /**
  * Task Instance Data
@@ -45,12 +47,16 @@ struct FActivateAbilityTaskInstanceData
     //어빌리티가 취소되었는지 여부
     bool bAbilityCancelled = false;
 
-    //EndDelay 경과 시간
-    float ElapsedEndDelay = 0.0f;
+    //EnterState 이후 종료 이벤트 대기 중인지 여부
+    bool bWaitingForEnd = false;
+
+    //EndDelay 대기 타이머
+    FTimerHandle EndDelayTimerHandle;
 };
 
 /**
  * GAS Ability를 실행하는 Task
+ * Tick 없이 ASC의 OnAbilityEnded 이벤트와 EndDelay 타이머로 태스크를 종료
  */
 USTRUCT(meta = (DisplayName = "Activate GAS Ability", Category = "GAS"))
 struct ACTIONPRACTICE_API FActivateAbilityTask : public FStateTreeTaskBase
@@ -59,11 +65,17 @@ struct ACTIONPRACTICE_API FActivateAbilityTask : public FStateTreeTaskBase
 
     using FInstanceDataType = FActivateAbilityTaskInstanceData;
 
-    FActivateAbilityTask() = default;
+    FActivateAbilityTask()
+    {
+        bShouldCallTick = false;
+    }
     
     virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
 
     virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
-    virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
     virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+private:
+    //어빌리티 종료 시 즉시 또는 EndDelay 이후 태스크 종료
+    void HandleAbilityEnded(const FStateTreeWeakExecutionContext& WeakContext, FInstanceDataType& InstanceData) const;
 };
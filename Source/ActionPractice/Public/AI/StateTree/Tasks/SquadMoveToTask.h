@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "SquadMoveToTask.generated.h"
+
+class AActor;
+class AAIController;
+
+/**
+ * Task Instance Data
+ * Context: 스키마에서 설정한 Context에서 자동으로 같은 자료형을 찾아 바인딩
+ * Input/Parameter: 에디터에서 설정하는 입력 값 (직접 입력 or 다른 노드의 Output 연결)
+ */
+USTRUCT()
+struct ACTIONPRACTICE_API FSquadMoveToTaskInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<AAIController> AIController = nullptr;
+
+	//있으면 액터를 따라가고, 없으면 TargetLocation으로 이동
+	UPROPERTY(EditAnywhere, Category = "Input", meta = (Optional))
+	TObjectPtr<AActor> TargetActor = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FVector TargetLocation = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	float AcceptanceRadius = 100.0f;
+};
+
+/**
+ * EnemyPathSubsystem을 통한 이동 Task
+ * 경로는 서브시스템이 비동기로 계산하고 같은 목표를 쫓는 주변 에이전트와 공유
+ * 목표 반경(AcceptanceRadius + 폰 충돌 반경) 안에 들어오면 성공, 경로를 찾지 못하면 실패
+ * 현재 BossStateTree에는 포함되지 않음, 다수 에이전트 트리에서 기본 MoveTo 대신 사용
+ */
+USTRUCT(meta = (DisplayName = "Squad Move To"))
+struct ACTIONPRACTICE_API FSquadMoveToTask : public FStateTreeTaskBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FSquadMoveToTaskInstanceData;
+
+	FSquadMoveToTask() = default;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+
+protected:
+
+	bool HasArrived(const FInstanceDataType& InstanceData) const;
+};
@@ -54,6 +54,7 @@ public:
 	AActionPracticeCharacter();
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaSeconds) override;
+	virtual bool HasTickWork() const override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
 	// ===== Getter =====
@@ -86,6 +87,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Input")
 	bool IsBlockInputPressed() const;
 
+	//이동 입력 해제 알림 (어빌리티 코루틴 대기용)
+	FSimpleMulticastDelegate OnMoveInputReleased;
+
 #pragma endregion
 
 protected:
@@ -198,6 +202,7 @@ protected:
 	
 	// ===== Input Handler Functions =====
 	void Move(const FInputActionValue& Value);
+	void MoveCompleted();
 	void Look(const FInputActionValue& Value);
 	void ToggleLockOn();
 	void WeaponSwitch();
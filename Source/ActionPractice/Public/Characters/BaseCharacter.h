@@ -4,6 +4,10 @@
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
 #include "GameplayEffect.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Characters/HitDetection/HurtboxState.h"
+#include "Characters/HitDetection/HitImpactSubsystem.h"
+#include "Engine/TimerHandle.h"
 #include "BaseCharacter.generated.h"
 
 class UAbilitySystemComponent;
@@ -11,6 +15,7 @@ class UAttributeSet;
 class UGameplayAbility;
 class AWeapon;
 class IHitDetectionInterface;
+class UHurtboxSetDataAsset;
 struct FGameplayTag;
 
 UCLASS(abstract)
@@ -21,6 +26,8 @@ class ACTIONPRACTICE_API ABaseCharacter : public ACharacter, public IAbilitySyst
 public:
 #pragma region "Public Variables"
 
+	//이동 모드 변경 알림 (어빌리티 코루틴 대기용)
+	FSimpleMulticastDelegate OnMovementModeChangedNative;
 
 #pragma endregion
 
@@ -30,12 +37,34 @@ public:
 
 	virtual void Tick(float DeltaTime) override;
 
+	//처리할 작업이 있을 때만 Tick 활성화, 자식에서 조건 추가
+	virtual bool HasTickWork() const;
+
 	//===== GAS Interface =====
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
 	//===== Hit Detection Interface =====
 	virtual TScriptInterface<IHitDetectionInterface> GetHitDetectionInterface() const PURE_VIRTUAL(ABaseCharacter::GetHitDetectionInterface, return nullptr;);
 
+	//===== Hurtbox =====
+	const UHurtboxSetDataAsset* GetHurtboxSet() const { return HurtboxSet; }
+
+	//피격 상태 구간, Duration이 0 이하면 Close까지 유지
+	//서버에서는 구간 동안 대응 상태 태그(State.Invincible, State.Ability.JustRolled)를 복제 루즈 태그로 부여
+	void OpenHurtboxWindow(EHurtboxWindow Window, float Duration = -1.0f);
+	void CloseHurtboxWindow(EHurtboxWindow Window);
+	bool IsHurtboxWindowActive(EHurtboxWindow Window) const;
+
+	//===== Hit Impact =====
+	//서버 히트 임팩트를 모든 머신의 UHitImpactSubsystem 큐에 추가 (UHitImpactSubsystem::BroadcastImpact에서 호출)
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastHitImpact(const FHitImpactNetData& Impact);
+
+	//===== Animation Update Rate =====
+	//판정 구간 동안 메시를 풀 레이트로 평가하도록 요청, Push/Pop 짝을 맞춰 호출
+	void PushFullRateAnimation();
+	void PopFullRateAnimation();
+
 #pragma endregion
 
 protected:
@@ -65,11 +94,31 @@ protected:
 	float TotalRotationTime = 0;
 	bool bIsRotatingForAction = false;
 
+	//===== Animation Update Rate Variables =====
+	//평상시 URO로 애니메이션 갱신 빈도를 낮춤 (판정 구간에서는 풀 레이트)
+	UPROPERTY(EditDefaultsOnly, Category = "Animation")
+	bool bUseAnimationUpdateRateOptimization = false;
+
+	//화면 밖일 때 평상시 애니메이션 Tick 옵션
+	UPROPERTY(EditDefaultsOnly, Category = "Animation", meta = (EditCondition = "bUseAnimationUpdateRateOptimization"))
+	EVisibilityBasedAnimTickOption ReducedVisibilityTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesAndRefreshBonesWhenPlayingMontages;
+
+	int32 FullRateAnimationRequestCount = 0;
+
+	//===== Hurtbox Variables =====
+	//본 부착 피격 캡슐 목록, 지정하면 무기 트레이스가 이 캡슐들로 부위 판정
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Hurtbox")
+	TObjectPtr<UHurtboxSetDataAsset> HurtboxSet = nullptr;
+
+	FHurtboxState HurtboxState;
+
 #pragma endregion
 
 #pragma region "Protected Functions"
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
 
 	//===== GAS =====
 	//자식 생성자에서 호출
@@ -88,11 +137,20 @@ protected:
 	void RotateToRotation(const FRotator& TargetRotation, float RotateTime);
 	void RotateToPosition(const FVector& TargetLocation, float RotateTime);
 
+	//HasTickWork 결과로 Tick 활성화 상태 갱신
+	void RefreshTickEnabled();
+
+	//===== Animation Update Rate Functions =====
+	void ApplyAnimationUpdateRateSettings(bool bFullRate);
+
 #pragma endregion
 
 private:
 #pragma region "Private Variables"
 
+	//구간별 태그 제거 타이머와 부여 여부 (서버 전용)
+	FTimerHandle HurtboxWindowTagTimers[static_cast<uint8>(EHurtboxWindow::Max)];
+	bool HurtboxWindowTagGranted[static_cast<uint8>(EHurtboxWindow::Max)] = {};
 
 #pragma endregion
 
@@ -100,5 +158,9 @@ private:
 
 	void UpdateActionRotation(float DeltaTime);
 
+	//구간에 대응하는 상태 태그, 없으면 빈 태그 (Guard는 방어 반응이 Blocking 태그를 따로 부여)
+	static FGameplayTag GetHurtboxWindowTag(EHurtboxWindow Window);
+	void SetHurtboxWindowTag(EHurtboxWindow Window, bool bGranted);
+
 #pragma endregion
 };
\ No newline at end of file
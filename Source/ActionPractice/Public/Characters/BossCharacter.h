@@ -28,7 +28,6 @@ public:
 
 	ABossCharacter();
 
-	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "CameraProbeSpringArmComponent.generated.h"
+
+/**
+ * 카메라 충돌을 CameraQuerySubsystem 비동기 프로브로 처리하는 스프링 암
+ * 엔진 기본 구현은 매 Tick 동기 구 스윕, 여기서는 직전 프레임 결과를 읽어 암 길이 비율로 적용
+ * 막힘이 가까워질 때는 즉시 당기고 풀릴 때만 보간
+ * 비동기 결과는 한 프레임 전 구간 기준이라, 프로브를 제출한 구간에서 임계 거리 이상 벗어난 프레임과 결과가 없는 프레임은 동기 스윕으로 대체
+ * 임계 거리 = SyncProbeMoveSpeed * TargetArmLength * DeltaTime, 동기 스윕한 빠른 프레임은 프로브를 제출하지 않음
+ * 그보다 작게 움직이는 동안 새로 생긴 막힘은 한 프레임 늦게 반영되므로 그 사이 카메라가 벽 표면을 최대 임계 거리만큼 넘을 수 있음
+ * bDoCollisionTest가 꺼져 있으면 충돌 처리 없음 (기존과 동일)
+ */
+UCLASS(ClassGroup=Camera, meta=(BlueprintSpawnableComponent))
+class ACTIONPRACTICE_API UCameraProbeSpringArmComponent : public USpringArmComponent
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Variables"
+
+	//false면 엔진 동기 스윕 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision")
+	bool bUseAsyncProbe = true;
+
+	//막힘이 풀릴 때 암 길이 복원 속도
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision", meta = (ClampMin = "0.0", EditCondition = "bUseAsyncProbe"))
+	float ProbeRecoverySpeed = 10.0f;
+
+	//카메라 목표 위치 이동 속도가 초당 암 길이의 이 배수를 넘으면 해당 프레임은 동기 스윕, 0이면 항상 동기
+	//기본값은 암 길이 400, 60fps 기준 프레임당 약 15cm
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "CameraCollision", meta = (ClampMin = "0.0", EditCondition = "bUseAsyncProbe"))
+	float SyncProbeMoveSpeed = 2.25f;
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual void UpdateDesiredArmLocation(bool bDoTrace, bool bDoLocationLag, bool bDoRotationLag, float DeltaTime) override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	int32 ProbeId = INDEX_NONE;
+
+	//현재 적용 중인 암 길이 비율 (1이면 막힘 없음)
+	float ArmFraction = 1.0f;
+
+	//직전 프레임의 막히지 않은 카메라 목표 위치
+	TOptional<FVector> LastDesiredLocation;
+
+	//마지막으로 프로브를 제출한 카메라 목표 위치 (비동기 결과의 구간)
+	TOptional<FVector> ProbedDesiredLocation;
+
+#pragma endregion
+};
@@ -9,6 +9,7 @@
 #include "EnemyDataAsset.generated.h"
 
 class UAnimMontage;
+class UHitImpactTable;
 
 //FName으로 식별되는 공격 데이터
 USTRUCT(BlueprintType)
@@ -38,6 +39,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attack Definitions")
     TMap<FName, FNamedAttackData> NamedAttackData;
 
+    //히트 시 재생할 이펙트/사운드 (데미지 타입 + 표면)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
+    TObjectPtr<UHitImpactTable> ImpactTable;
+
     //GetOptions용 함수 - HitSocketInfo에서 소켓 그룹 이름들을 반환
     UFUNCTION()
     TArray<FString> GetSocketGroupNames() const
@@ -6,10 +6,17 @@
 #include "Items/AttackData.h"
 #include "Characters/HitDetection/HitDetectionInterface.h"
 #include "GameplayAbilities/Public/GameplayEffectTypes.h"
+#include "Engine/OverlapResult.h"
+#include "Characters/HitDetection/MontagePoseSampler.h"
 #include "AttackTraceComponent.generated.h"
 
 class UAbilitySystemComponent;
 class UMeshComponent;
+class ABaseCharacter;
+class UHurtboxSubsystem;
+class UAnimInstance;
+class UAnimMontage;
+class USkeletalMeshComponent;
 
 USTRUCT()
 struct FHitValidationData
@@ -36,20 +43,59 @@ struct FHitSocketGroupConfig
 	int32 SocketCount = 2;
 	float TraceRadius = 10.0f;
 
-	UPROPERTY()
-	TArray<FName> TraceSocketNames;
-
-	UPROPERTY()
-	TArray<FVector> PreviousSocketPositions;
+	//소켓 수가 이 값 이하면 소켓 배열을 구조체 안에 저장 (공격마다 그룹 복사, 트레이스마다 Swap 시 힙 할당 없음)
+	static constexpr int32 InlineSocketCount = 8;
 
-	UPROPERTY()
-	TArray<FVector> CurrentSocketPositions;
+	TArray<FName, TInlineAllocator<InlineSocketCount>> TraceSocketNames;
+	TArray<FVector, TInlineAllocator<InlineSocketCount>> PreviousSocketPositions;
+	TArray<FVector, TInlineAllocator<InlineSocketCount>> CurrentSocketPositions;
 
 	// ===== Adaptive Trace Settings (소켓 그룹 별로 적용) =====
 	FVector PrevTipSocketLocation = FVector::ZeroVector;
 	float CurrentSecondsPerTrace = 1.0f;
 	int32 CurrentInterpolationPerTrace = 1;
+	int32 CurrentAdaptiveTier = 0;
+	float CurrentSwingSpeed = 0.0f;
+
+	//예산 상한 적용 전 속도로 선택된 단계
+	int32 DesiredAdaptiveTier = 0;
 	float TraceAccumulator = 0.0f;
+
+	// ===== Strike Variables =====
+	//판정 구간 중 타격부(0번 소켓) 최고 속도, 여기서 충분히 감속한 트레이스를 임팩트로 판정
+	float StrikePeakSpeed = 0.0f;
+
+	//판정 구간 당 오버랩 1회, 수행 후 true
+	bool bStrikeResolved = false;
+
+	// ===== Montage Time Variables =====
+	//마지막으로 트레이스한 몽타주 시간
+	float MontageTracedTime = 0.0f;
+
+	//소켓별 구동 본(캐릭터 메시 본 인덱스)과 본 공간 오프셋
+	TArray<int32, TInlineAllocator<InlineSocketCount>> SocketBoneIndices;
+	TArray<FVector, TInlineAllocator<InlineSocketCount>> SocketBoneOffsets;
+};
+
+//몽타주 시간 기준 판정 구간, 소켓 위치는 렌더된 포즈 대신 몽타주를 고정 시간 간격으로 샘플링해 계산
+struct FMontageHitWindow
+{
+	TWeakObjectPtr<UAnimInstance> AnimInstance;
+	TWeakObjectPtr<const UAnimMontage> Montage;
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	//HitDetection 노티파이 스테이트 구간 (몽타주 시간)
+	float StartTime = 0.0f;
+	float EndTime = 0.0f;
+
+	//직전/이번 Tick의 메시 트랜스폼과 몽타주 위치, 서브 프레임 메시 위치는 둘 사이 보간
+	FTransform PrevMeshTransform = FTransform::Identity;
+	FTransform CurrMeshTransform = FTransform::Identity;
+	float PrevTickTime = 0.0f;
+	float CurrTickTime = 0.0f;
+
+	FMontagePoseSampler Sampler;
+	bool bActive = false;
 };
 
 USTRUCT(BlueprintType)
@@ -82,6 +128,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace Settings")
 	float HitCooldownTime = 0.1f;
 
+	//서버 랙 보상 시 공격자 기준으로 되감을 피격자 범위
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace Settings")
+	float LagCompensationRadius = 600.0f;
+
+	//Strike 임팩트 판정, 타격부 속도가 구간 최고 속도의 이 비율 아래로 떨어지면 그 위치에서 오버랩
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float StrikeImpactSpeedRatio = 0.5f;
+
 #pragma endregion
 
 #pragma region "Public Functions"
@@ -106,11 +160,28 @@ public:
 	virtual void HandleHitDetectionEnd(const FGameplayEventData& Payload) override;
 
 	virtual FOnHitDetected& GetOnHitDetected() override { return OnHit; }
+	virtual void CancelHitDetection() override;
 	//=====================================
 
+	//마지막 판정 구간의 최고 스윙 속도 (월드 시간 기준 cm/s), 구간이 실행되지 않았으면 0
+	float GetPeakSwingSpeed() const { return PeakSwingSpeed; }
+
+	bool IsTracing() const { return bIsTracing; }
+
 	UFUNCTION(BlueprintCallable, Category = "Attack Trace")
 	void ResetHitActors();
 
+	// ===== Trace Budget =====
+	//UHitTraceBudgetSubsystem이 설정, MAX_int32면 제한 없음
+	void SetBudgetTierCap(int32 InTierCap) { BudgetTierCap = InTierCap; }
+	int32 GetDesiredAdaptiveTier() const;
+
+	//Tier 단계로 트레이스할 때 프레임당 예상 스윕 수
+	float EstimateSweepsPerFrame(int32 Tier, float DeltaTime) const;
+
+	//현재 단계로 트레이스 한 번에 필요한 스윕 수
+	int32 EstimateSweepsPerTrace() const;
+
 #pragma endregion
 
 protected:
@@ -122,6 +193,10 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UMeshComponent> OwnerMesh = nullptr;
 
+	//피격 캡슐 판정, 에디터 월드 등에서는 nullptr
+	UPROPERTY()
+	TObjectPtr<UHurtboxSubsystem> HurtboxSubsystem = nullptr;
+
 	FFinalAttackData CurrentAttackData;
 
 	// ===== Trace Config Variables =====
@@ -135,6 +210,18 @@ protected:
 	bool bIsTracing = false;
 	bool bIsPrepared = false;
 
+	//프레임 예산에 따른 적응형 단계 상한
+	int32 BudgetTierCap = MAX_int32;
+
+	//PrepareHitDetection 이후 그룹 중 최고 스윙 속도
+	float PeakSwingSpeed = 0.0f;
+
+	//트레이스 중 애니메이션 풀 레이트를 요청한 캐릭터
+	TWeakObjectPtr<ABaseCharacter> FullRateAnimationCharacter;
+
+	//몽타주 시간 샘플링 구간, 비활성이면 Tick 시점 소켓 위치로 트레이스
+	FMontageHitWindow MontageWindow;
+
 	// ===== Adaptive Trace Sweep Variables =====
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Adaptive Trace")
 	TArray<FAdaptiveTraceConfig> AdaptiveConfigs = {
@@ -151,6 +238,13 @@ protected:
 	// ===== Hit Variables =====
 	UPROPERTY()
 	TMap<AActor*, FHitValidationData> HitValidationMap;
+
+	// ===== Trace Scratch Variables =====
+	//트레이스마다 Reset만 하고 용량은 유지, 워밍업 이후 멤버 스크래치 버퍼가 커지지 않음
+	//엔진 스윕 API가 기본 할당자 TArray를 요구하므로 프레임 스택 대신 멤버로 유지
+	TArray<FHitResult> SweepHitScratch;
+	TArray<FHitResult> TraceHitScratch;
+	TArray<FOverlapResult> OverlapScratch;
 	
 	// ===== Event Delegate =====
 	FDelegateHandle HitDetectionStartHandle;
@@ -177,18 +271,57 @@ protected:
 
 	// ===== Execute Trace Functions =====
 	void PerformTrace(float DeltaTime);
-	void PerformSlashTrace(FHitSocketGroupConfig& SocketGroup);
-	void PerformPierceTrace(FHitSocketGroupConfig& SocketGroup);
-	void PerformStrikeTrace(FHitSocketGroupConfig& SocketGroup);
+
+	//공격 타입별 트레이스 한 번 (Previous -> Current 소켓 위치)
+	void PerformGroupTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params);
+	//Slash: 인접 소켓 사이 선분을 보간하며 캡슐 스윕 (소켓 2개 이상)
+	void PerformSlashTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params);
+
+	//Pierce: 찌르는 축을 따라 이전 끝점에서 현재 끝점까지 얇은 구체 스윕 1회
+	void PerformPierceTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params);
+
+	//Strike: 임팩트 트레이스에서만 타격부 구체 오버랩 1회
+	void PerformStrikeTrace(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params);
+	void PerformStrikeOverlap(FHitSocketGroupConfig& SocketGroup, const FCollisionQueryParams& Params);
+
+	//임팩트를 찾지 못하고 판정 구간이 끝난 Strike 그룹은 마지막 위치에서 오버랩
+	void ResolvePendingStrikes();
+
+	//무기 캡슐(Start-End 선분 + Radius)에 닿는 대상 수집
+	//피격 캡슐이 있는 캐릭터는 캡슐 판정으로, 나머지는 물리 스윕(PhysicsShape)으로 검색
+	void SweepWeaponCapsule(const FVector& Start, const FVector& End, float Radius, const FCollisionShape& PhysicsShape, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits);
+
+	//공격 타입별 트레이스 한 번의 스윕/오버랩 수
+	int32 CountSweepsPerTrace(const FHitSocketGroupConfig& SocketGroup, int32 InterpolationPerTrace) const;
 	
 	// ===== Adaptive Trace Sweep Functions =====
 	FVector GetTipSocketLocation(const FHitSocketGroupConfig& SocketGroup) const;
 	float CalculateSwingSpeed(const FHitSocketGroupConfig& SocketGroup) const;
 	void UpdateAdaptiveTraceSettings(FHitSocketGroupConfig& SocketGroup);
+
+	//SwingSpeed로 적응형 단계 선택 (예산 상한 적용)
+	//WorldTimeScale: SwingSpeed의 시간 단위 -> 월드 시간 배율, PeakSwingSpeed 기록에만 사용
+	void ApplyAdaptiveTier(FHitSocketGroupConfig& SocketGroup, float SwingSpeed, float WorldTimeScale = 1.0f);
 	void PerformInterpolationTrace(
 			const FVector& StartPrev, const FVector& StartCurr,
 			const FVector& EndPrev, const FVector& EndCurr,
-			float Radius, int32 InterpolationPerTrace, TArray<FHitResult>& OutHits);
+			float Radius, int32 InterpolationPerTrace, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits);
+
+	// ===== Montage Time Functions =====
+	//재생 중인 몽타주에서 현재 HitDetection 구간을 찾아 샘플링 시작, 조건이 맞지 않으면 false (Tick 샘플링 유지)
+	bool BeginMontageWindow();
+	void EndMontageWindow();
+
+	//이번 Tick의 몽타주 위치와 메시 트랜스폼 기록, 몽타주가 구간을 벗어나 되돌아가면 false
+	bool UpdateMontageWindow();
+
+	//그룹별로 TargetTime까지 고정 간격 트레이스, bFinal이면 간격이 남아도 TargetTime까지 마무리
+	void AdvanceMontageWindow(float TargetTime, bool bFinal);
+
+	//소켓을 구동하는 캐릭터 메시 본과 본 공간 오프셋 계산 (무기는 부착 본)
+	bool ResolveSocketBones(const USkeletalMeshComponent* CharacterMesh);
+	bool SampleSocketPositions(FHitSocketGroupConfig& SocketGroup, float MontageTime, TArray<FVector, TInlineAllocator<FHitSocketGroupConfig::InlineSocketCount>>& OutPositions);
+	FTransform GetMeshTransformAtMontageTime(float MontageTime) const;
 
 	// ===== Hit Functions =====
 	bool ValidateHit(AActor* HitActor, const FHitResult& HitResult, bool bIsMultiHit);
@@ -200,14 +333,23 @@ protected:
 	void UnbindEventCallbacks();
 	
 	// ===== Utility Functions =====
+	//소켓을 움직이는 애니메이션 캐릭터 (Weapon은 Owner 캐릭터)
+	ABaseCharacter* FindAnimatedCharacter() const;
+	void SetFullRateAnimation(bool bEnable);
 	ECollisionChannel GetTraceChannel() const;
+
+	//Visual Logger 기록 대상 (애니메이션 캐릭터, 없으면 Owner)
+	const UObject* GetVisualLogOwner() const;
 	FCollisionQueryParams GetCollisionQueryParams() const;
 
 #pragma endregion
 
 #pragma region "Debug And Profiling"
 public:
+	//스윕 형태, 적응형 단계, 히트/거부 사유는 Visual Logger로 기록 (Rewind Debugger의 Visual Logger 트랙에서도 표시)
+	//녹화 중이 아니면 인자 평가 없음, 녹화: vislog record / Rewind Debugger 녹화 시작
 	
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DebugTrace")
 	bool bDrawDebugTrace = false;
 
@@ -218,6 +360,16 @@ public:
 	FColor DebugTraceColor = FColor::Red;
 
 	int32 DebugSweepTraceCounter = 0;
+
+	//전체 컴포넌트 누적 스윕 횟수 (벤치마크용)
+	static int64 TotalSweepTraceCounter;
+
+	//트레이스 경로 멤버 스크래치 컨테이너가 커진 횟수 (워밍업 이후 0이어야 함)
+	//멤버 버퍼 용량만 비교하므로 엔진 내부 임시 할당은 포함하지 않음, 전체 할당은 -llm + stat LLM / Memory Insights의 Combat/HitTrace 태그로 확인
+	static int64 TotalTraceScratchGrowthCounter;
+
+	//트레이스 경로 멤버 스크래치 컨테이너의 할당 크기 합
+	SIZE_T GetTraceScratchAllocatedSize() const;
 	
 	void DrawDebugSweepTrace(const FVector& StartPrev, const FVector& StartCurr,
 							 const FVector& EndPrev, const FVector& EndCurr,
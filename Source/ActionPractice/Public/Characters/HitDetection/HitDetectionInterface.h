@@ -28,4 +28,7 @@ public:
 	virtual void HandleHitDetectionStart(const FGameplayEventData& Payload) = 0;
 	virtual void HandleHitDetectionEnd(const FGameplayEventData& Payload) = 0;
 	virtual FOnHitDetected& GetOnHitDetected() = 0;
+
+	//준비/진행 중인 판정 해제, 같은 공격에 다른 백엔드가 선택되었을 때 이벤트 중복 수신 방지
+	virtual void CancelHitDetection() {}
 };
\ No newline at end of file
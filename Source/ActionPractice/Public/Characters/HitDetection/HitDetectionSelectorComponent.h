@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "Characters/HitDetection/HitDetectionInterface.h"
+#include "HitDetectionSelectorComponent.generated.h"
+
+class UAttackTraceComponent;
+class UWeaponCCDComponent;
+
+UENUM()
+enum class EHitDetectionBackend : uint8
+{
+	None,
+	Sweep,
+	CCD
+};
+
+//공격(태그 + 콤보) 별로 측정된 무기 끝 최고 속도
+struct FAttackSpeedRecord
+{
+	FGameplayTagContainer AttackTags;
+	int32 ComboIndex = 0;
+	float PeakTipSpeed = 0.0f;
+};
+
+/**
+ * 히트 판정 백엔드 선택 (IHitDetectionInterface 프런트 엔드)
+ * PrepareHitDetection마다 공격별 무기 끝 속도, 주변 대상 수, 트레이스 프레임 예산으로 스윕/CCD 중 하나만 준비
+ * 느린 공격 + 대상이 적은 상황은 CCD 오버랩, 빠른 공격이나 대상이 많은 상황은 스윕
+ * 속도는 같은 공격의 이전 판정 구간에서 측정한 값, 처음 보는 공격은 스윕
+ * 두 백엔드의 히트는 그대로 OnHit으로 전달 (대상별 1회, 부위 배율 포함으로 동일한 이벤트)
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ACTIONPRACTICE_API UHitDetectionSelectorComponent : public UActorComponent, public IHitDetectionInterface
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Variables"
+
+	FOnHitDetected OnHit;
+
+	//false면 자동 선택 없이 FixedBackend만 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Backend Selection")
+	bool bAutoSelect = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Backend Selection")
+	EHitDetectionBackend FixedBackend = EHitDetectionBackend::Sweep;
+
+	//이 속도(cm/s) 이하의 공격만 CCD 사용, 적응형 트레이스 2단계 임계값과 같은 기준
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Backend Selection")
+	float CCDMaxTipSpeed = 1500.0f;
+
+	//주변 대상 수 집계 반경과 CCD를 허용하는 최대 대상 수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Backend Selection")
+	float DensityRadius = 500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Backend Selection")
+	int32 CCDMaxNearbyTargets = 2;
+
+#pragma endregion
+
+#pragma region "Public Functions"
+
+	UHitDetectionSelectorComponent();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	//소유 액터 BeginPlay에서 호출, CCD가 없으면 항상 스윕
+	void SetBackends(UAttackTraceComponent* InSweep, UWeaponCCDComponent* InCCD);
+
+	// ===== HitDetection Interface =====
+	virtual void PrepareHitDetection(const FGameplayTagContainer& AttackTags, const int32 ComboIndex) override;
+	virtual void PrepareHitDetection(const FName& AttackName, const int32 ComboIndex) override;
+	virtual void HandleHitDetectionStart(const FGameplayEventData& Payload) override;
+	virtual void HandleHitDetectionEnd(const FGameplayEventData& Payload) override;
+	virtual FOnHitDetected& GetOnHitDetected() override { return OnHit; }
+	virtual void CancelHitDetection() override;
+	//=====================================
+
+	EHitDetectionBackend GetActiveBackend() const { return ActiveBackend; }
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Variables"
+
+	UPROPERTY()
+	TObjectPtr<UAttackTraceComponent> SweepBackend = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UWeaponCCDComponent> CCDBackend = nullptr;
+
+	EHitDetectionBackend ActiveBackend = EHitDetectionBackend::None;
+
+	//직전에 준비한 공격, 다음 준비 시 측정 속도를 기록
+	FGameplayTagContainer LastAttackTags;
+	int32 LastComboIndex = INDEX_NONE;
+
+	//무기 하나의 공격 수는 적으므로 선형 검색
+	TArray<FAttackSpeedRecord> SpeedRecords;
+
+	FDelegateHandle SweepHitHandle;
+	FDelegateHandle CCDHitHandle;
+
+#pragma endregion
+
+#pragma region "Protected Functions"
+
+	IHitDetectionInterface* GetBackend(EHitDetectionBackend Backend) const;
+
+	//직전 공격의 판정 구간 최고 속도를 기록
+	void RecordLastAttackSpeed();
+	const FAttackSpeedRecord* FindSpeedRecord(const FGameplayTagContainer& AttackTags, int32 ComboIndex) const;
+
+	EHitDetectionBackend SelectBackend(const FGameplayTagContainer& AttackTags, int32 ComboIndex) const;
+	int32 CountNearbyTargets() const;
+
+	//선택한 백엔드로 전환, 이전 백엔드의 준비 상태는 해제
+	void ActivateBackend(EHitDetectionBackend Backend);
+
+	void HandleBackendHit(AActor* HitActor, const FHitResult& HitResult, FFinalAttackData AttackData);
+
+#pragma endregion
+};
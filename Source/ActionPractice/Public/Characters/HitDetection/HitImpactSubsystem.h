@@ -0,0 +1,143 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "Engine/NetSerialization.h"
+#include "Items/AttackData.h"
+#include "HitImpactSubsystem.generated.h"
+
+class ABaseCharacter;
+class UHitImpactTable;
+class UNiagaraComponent;
+class UAudioComponent;
+
+//히트 임팩트 재생 정보, 서버에서 ABaseCharacter 멀티캐스트로 전달
+USTRUCT()
+struct FHitImpactNetData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<const UHitImpactTable> Table = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<const AActor> Target = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Normal = FVector::UpVector;
+
+	UPROPERTY()
+	EAttackDamageType DamageType = EAttackDamageType::None;
+
+	UPROPERTY()
+	TEnumAsByte<EPhysicalSurface> Surface = SurfaceType_Default;
+
+	UPROPERTY()
+	float Damage = 0.0f;
+};
+
+//이번 프레임에 요청된 히트 임팩트 하나
+struct FHitImpactRequest
+{
+	TWeakObjectPtr<const UHitImpactTable> Table;
+	TWeakObjectPtr<const AActor> Target;
+
+	FVector Location = FVector::ZeroVector;
+	FVector Normal = FVector::UpVector;
+
+	EAttackDamageType DamageType = EAttackDamageType::None;
+	EPhysicalSurface Surface = SurfaceType_Default;
+	float Damage = 0.0f;
+
+	//가장 가까운 뷰까지의 제곱 거리, PlanImpacts에서 채움
+	float ViewDistanceSq = 0.0f;
+};
+
+//PlanImpacts 결과 집계
+struct FHitImpactPlanStats
+{
+	int32 Merged = 0;
+	int32 Culled = 0;
+	int32 OverBudget = 0;
+};
+
+/**
+ * 히트 임팩트(이펙트 + 사운드) 프레임 예산 관리
+ * 히트 시점에는 BroadcastImpact로 요청만 쌓고, 월드 Tick 이후 한 번에 처리
+ * 서버 히트는 공격자 멀티캐스트(Unreliable)로 모든 머신에서 로컬 큐에 추가, 예측 중인 소유 클라이언트는 자기 트레이스 결과로 바로 추가
+ * 같은 대상에 대한 같은 프레임의 히트는 데미지가 가장 큰 히트 하나로 병합,
+ * 로컬 뷰에서 먼 히트는 컬링, 남은 히트는 가까운 순으로 프레임 상한까지만 재생
+ * 이펙트/오디오 컴포넌트는 풀에서 재사용 (재생이 끝난 컴포넌트 우선, 풀이 차면 가장 먼저 시작한 것)
+ * 계획(PlanImpacts)은 렌더링과 무관한 정적 함수, 렌더링이 불가능한 프로세스에서는 계획까지만 수행
+ * stat Combat의 Impact 카운터로 확인
+ */
+UCLASS()
+class ACTIONPRACTICE_API UHitImpactSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//히트를 감지한 머신에서 호출
+	//서버: Attacker 멀티캐스트로 모든 머신에 전달, 소유 클라이언트(예측): 로컬 큐에만 추가
+	static void BroadcastImpact(ABaseCharacter* Attacker, const UHitImpactTable* Table, const AActor* Target,
+		const FHitResult& HitResult, const FFinalAttackData& AttackData);
+
+	//로컬 큐에 추가, 데디케이티드 서버에서는 무시
+	static void QueueImpact(const UObject* WorldContext, const FHitImpactNetData& Impact);
+
+	//병합 -> 거리 컬링 -> 가까운 순 정렬 -> 상한 적용, Requests는 재생할 요청만 남김
+	static FHitImpactPlanStats PlanImpacts(TArray<FHitImpactRequest>& Requests, TConstArrayView<FVector> ViewLocations,
+		float CullDistance, int32 MaxImpacts);
+
+	//StartTimes 중 가장 이른 인덱스를 Now로 갱신하고 반환, 비어 있으면 INDEX_NONE
+	static int32 StartOldestPoolEntry(TArray<double>& StartTimes, double Now);
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TArray<FHitImpactRequest> PendingImpacts;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> EffectPool;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> AudioPool;
+
+	//풀 인덱스별 마지막 재생 시작 시간, 풀이 가득 차고 모두 재생 중이면 가장 이른 것을 재시작
+	TArray<double> EffectStartTimes;
+	TArray<double> AudioStartTimes;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	void FlushImpacts();
+	void GatherViewLocations(TArray<FVector, TInlineAllocator<4>>& OutViewLocations) const;
+	void PlayImpact(const FHitImpactRequest& Request);
+
+	//반환한 컴포넌트의 시작 시간을 지금으로 기록
+	UNiagaraComponent* AcquireEffectComponent();
+	UAudioComponent* AcquireAudioComponent();
+
+#pragma endregion
+};
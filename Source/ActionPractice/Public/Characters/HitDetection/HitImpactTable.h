@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "Items/AttackData.h"
+#include "HitImpactTable.generated.h"
+
+class UNiagaraSystem;
+class USoundBase;
+
+//히트 한 번에 재생할 이펙트와 사운드
+USTRUCT(BlueprintType)
+struct FHitImpactEffect
+{
+	GENERATED_BODY()
+
+	//히트 중 로드 히치를 피하기 위해 하드 참조 (테이블과 함께 로드)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	TObjectPtr<UNiagaraSystem> Effect = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	TObjectPtr<USoundBase> Sound = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact", meta = (ClampMin = "0.01"))
+	float EffectScale = 1.0f;
+
+	bool IsEmpty() const { return !Effect && !Sound; }
+};
+
+//데미지 타입 + 표면 키, None / SurfaceType_Default는 와일드카드
+USTRUCT(BlueprintType)
+struct FHitImpactEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	EAttackDamageType DamageType = EAttackDamageType::None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	TEnumAsByte<EPhysicalSurface> Surface = SurfaceType_Default;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	FHitImpactEffect Impact;
+};
+
+/**
+ * 히트 임팩트 테이블 (WeaponDataAsset / EnemyDataAsset에서 참조)
+ * 조회 순서: 타입+표면 > 타입만 > 표면만 > DefaultImpact
+ * 표면은 히트한 콜리전의 PhysicalMaterial SurfaceType
+ */
+UCLASS(BlueprintType)
+class ACTIONPRACTICE_API UHitImpactTable : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	TArray<FHitImpactEntry> Entries;
+
+	//어떤 항목에도 맞지 않을 때
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Impact")
+	FHitImpactEffect DefaultImpact;
+
+	//항목 수가 적으므로 선형 검색, 재생할 것이 없으면 nullptr
+	const FHitImpactEffect* FindImpact(EAttackDamageType DamageType, EPhysicalSurface Surface) const;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HitTraceBudgetSubsystem.generated.h"
+
+class UAttackTraceComponent;
+
+//트레이스 중인 컴포넌트 하나의 예산 상태
+struct FHitTraceBudgetEntry
+{
+	TWeakObjectPtr<UAttackTraceComponent> Component;
+	TWeakObjectPtr<const AActor> Attacker;
+
+	//플레이어 공격 또는 플레이어를 때릴 수 있는 거리의 공격
+	bool bThreat = false;
+	float DistanceToPlayer = 0.0f;
+
+	//계획상 예산 안에 들어온 항목, 런타임 검사에서 지연되지 않음
+	bool bProtected = true;
+};
+
+/**
+ * 전투 트레이스 프레임 예산 관리
+ * 매 프레임 끝에 트레이스 중인 공격을 우선순위(플레이어 위협 여부 > 플레이어와의 거리)로 정렬하고
+ * 스윕 예산을 앞에서부터 배분, 예산을 넘는 공격은 적응형 단계 상한을 낮춤
+ * 그래도 초과하면 트레이스를 지연하고 누적 시간을 유지 (다음 트레이스가 이전 소켓 위치부터 스윕하므로 빠지는 구간 없음)
+ * stat Combat의 Budget 카운터로 예산이 적용된 횟수 확인
+ */
+UCLASS()
+class ACTIONPRACTICE_API UHitTraceBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//StartTrace/StopTrace에서 호출
+	static void RegisterTracer(UAttackTraceComponent* Component, const AActor* Attacker);
+	static void UnregisterTracer(UAttackTraceComponent* Component);
+
+	//트레이스 실행 전 호출, false면 이번 프레임은 건너뛰고 AccumulatedSeconds 유지
+	static bool TryConsume(UAttackTraceComponent* Component, float AccumulatedSeconds);
+
+	//트레이스 실행 후 실제 스윕 수와 소요 시간 보고
+	static void ReportTraceTime(UAttackTraceComponent* Component, int32 NumSweeps, double Seconds);
+
+	//직전 프레임 스윕 수 / 프레임 스윕 예산, 예산이 꺼져 있거나 상한이 없으면 0
+	static float GetSweepLoad(const UWorld* World);
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TArray<FHitTraceBudgetEntry> Entries;
+
+	int32 SweepsThisFrame = 0;
+	double TraceSecondsThisFrame = 0.0;
+	int32 SweepsLastFrame = 0;
+
+	//최근 프레임 기준 스윕 1회 평균 비용 (ms), ms 예산을 스윕 수로 환산
+	double AverageMsPerSweep = 0.0;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	FHitTraceBudgetEntry* FindEntry(const UAttackTraceComponent* Component);
+	void UpdatePriorities();
+	void PlanBudget(float DeltaTime);
+	int32 GetEffectiveMaxSweeps() const;
+
+#pragma endregion
+};
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/HitResult.h"
+#include "HurtboxSetDataAsset.generated.h"
+
+class USkeleton;
+
+UENUM(BlueprintType)
+enum class EHurtboxRegion : uint8
+{
+	Body UMETA(DisplayName = "Body"),
+	Head UMETA(DisplayName = "Head"),
+	Arm UMETA(DisplayName = "Arm"),
+	Leg UMETA(DisplayName = "Leg")
+};
+
+//본에 부착되는 피격 캡슐, Start/End는 본 로컬 좌표
+USTRUCT(BlueprintType)
+struct FHurtboxCapsule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	FName BoneName = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	FVector Start = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	FVector End = FVector(0.0f, 0.0f, 20.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox", meta = (ClampMin = "0.0"))
+	float Radius = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	EHurtboxRegion Region = EHurtboxRegion::Body;
+
+	//부위 데미지 배율
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox", meta = (ClampMin = "0.0"))
+	float DamageMultiplier = 1.0f;
+};
+
+/**
+ * 스켈레톤 별 피격 캡슐 목록
+ * ABaseCharacter에 지정하면 무기 트레이스가 물리 씬 대신 이 캡슐들과 직접 거리 판정 (UHurtboxSubsystem)
+ * 몸통 6~12개 정도의 작은 목록을 권장
+ */
+UCLASS(BlueprintType)
+class ACTIONPRACTICE_API UHurtboxSetDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	//작성 기준 스켈레톤 (참고용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	TSoftObjectPtr<USkeleton> Skeleton;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hurtbox")
+	TArray<FHurtboxCapsule> Capsules;
+
+	//BoneName에 부착된 캡슐의 데미지 배율, 없으면 1
+	float GetDamageMultiplier(FName BoneName) const
+	{
+		for (const FHurtboxCapsule& Capsule : Capsules)
+		{
+			if (Capsule.BoneName == BoneName)
+			{
+				return Capsule.DamageMultiplier;
+			}
+		}
+		return 1.0f;
+	}
+
+	//피격 캡슐 히트는 캡슐 인덱스(Hit.Item)로, 물리 히트는 BoneName으로 배율 조회
+	float GetDamageMultiplier(const FHitResult& Hit, bool bHurtboxHit) const
+	{
+		if (bHurtboxHit && Capsules.IsValidIndex(Hit.Item))
+		{
+			return Capsules[Hit.Item].DamageMultiplier;
+		}
+		return Hit.BoneName != NAME_None ? GetDamageMultiplier(Hit.BoneName) : 1.0f;
+	}
+};
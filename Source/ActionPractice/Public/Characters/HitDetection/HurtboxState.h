@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+//캐릭터 피격 상태 구간 종류
+enum class EHurtboxWindow : uint8
+{
+	//피격 판정 자체를 거부 (구르기 무적)
+	Invulnerable,
+	//구르기 직후 짧은 구간
+	JustRolled,
+	//방어 중
+	Guard,
+	Max
+};
+
+//월드 시간 기준 구간, EndTime이 음수면 Close까지 유지
+struct FHurtboxWindowInterval
+{
+	double StartTime = -1.0;
+	double EndTime = -1.0;
+};
+
+/**
+ * 캐릭터의 가벼운 피격 상태
+ * 구르기 무적/JustRolled/방어를 GE 스펙 대신 시간 구간으로 기록
+ * 피격 판정(AttackTraceComponent, WeaponCCDComponent)이 대미지 스펙 생성 전에 조회
+ * 상태 태그가 필요한 에셋을 위해 ABaseCharacter가 서버에서 구간 동안 복제 루즈 태그를 함께 부여
+ */
+struct FHurtboxState
+{
+	//Duration이 0 이하면 Close까지 유지
+	void Open(EHurtboxWindow Window, double Now, float Duration = -1.0f)
+	{
+		FHurtboxWindowInterval& Interval = Windows[static_cast<uint8>(Window)];
+		Interval.StartTime = Now;
+		Interval.EndTime = Duration > 0.0f ? Now + Duration : -1.0;
+	}
+
+	void Close(EHurtboxWindow Window, double Now)
+	{
+		if (IsActive(Window, Now))
+		{
+			Windows[static_cast<uint8>(Window)].EndTime = Now;
+		}
+	}
+
+	bool IsActive(EHurtboxWindow Window, double Now) const
+	{
+		const FHurtboxWindowInterval& Interval = Windows[static_cast<uint8>(Window)];
+		return Interval.StartTime >= 0.0 && Now >= Interval.StartTime && (Interval.EndTime < 0.0 || Now < Interval.EndTime);
+	}
+
+private:
+	FHurtboxWindowInterval Windows[static_cast<uint8>(EHurtboxWindow::Max)];
+};
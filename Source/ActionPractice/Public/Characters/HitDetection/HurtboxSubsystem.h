@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "HurtboxSubsystem.generated.h"
+
+class ABaseCharacter;
+class UHurtboxSetDataAsset;
+class USkeletalMesh;
+struct FCollisionQueryParams;
+
+//캡슐 끝점 목록 (HurtboxSet 캡슐 순서)
+using FHurtboxPoints = TArray<FVector, TInlineAllocator<16>>;
+
+//캐릭터 하나의 피격 캡슐 런타임 캐시
+struct FHurtboxRuntime
+{
+	TWeakObjectPtr<ABaseCharacter> Character;
+	TWeakObjectPtr<const UHurtboxSetDataAsset> HurtboxSet;
+
+	//메시가 바뀌면 본 인덱스 다시 조회, 본이 없는 캡슐은 INDEX_NONE으로 판정에서 제외
+	TWeakObjectPtr<const USkeletalMesh> CachedMesh;
+	TArray<int32, TInlineAllocator<16>> BoneIndices;
+
+	//컴포넌트 공간 캡슐 끝점, 프레임당 한 번만 갱신
+	FHurtboxPoints ComponentStarts;
+	FHurtboxPoints ComponentEnds;
+	uint64 CachedFrame = MAX_uint64;
+
+	//랙 보상 중 판정에 사용할 과거 액터 트랜스폼과 액터 공간 캡슐 끝점 (과거 포즈)
+	//설정 중에는 현재 포즈 대신 이 캡슐로 판정, 끝점이 비어 있으면 현재 포즈를 과거 트랜스폼으로 옮겨 사용
+	TOptional<FTransform> RewoundActorTransform;
+	FHurtboxPoints RewoundStarts;
+	FHurtboxPoints RewoundEnds;
+};
+
+/**
+ * 본 부착 피격 캡슐 판정
+ * 무기 스윕 캡슐(선분 + 반경)을 메시 바운드로 1차 거른 뒤 피격 캡슐과 선분-선분 거리로 직접 판정 (4개씩 SIMD)
+ * 물리 씬 쿼리 없이 부위 정보(BoneName)와 부위 배율이 포함된 FHitResult 생성
+ * 기본은 물리 스윕 생략, 피격 캡슐이 없는 대상도 맞춰야 하면 ap.HitDetection.Hurtbox.PhysicsSweep 1
+ */
+UCLASS()
+class ACTIONPRACTICE_API UHurtboxSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Deinitialize() override;
+
+	//BeginPlay/EndPlay에서 호출, HurtboxSet이 없는 캐릭터는 등록되지 않음
+	static void RegisterCharacter(ABaseCharacter* Character);
+	static void UnregisterCharacter(ABaseCharacter* Character);
+
+	//피격 캡슐 판정 사용 여부 (ap.HitDetection.Hurtbox.Enable)
+	static bool IsEnabled();
+
+	//물리 스윕을 함께 수행할지 여부 (ap.HitDetection.Hurtbox.PhysicsSweep)
+	static bool ShouldSweepPhysics();
+
+	//피격 캡슐로 판정되는 액터인지, 물리 스윕 결과에서 중복 제외용
+	bool IsHurtboxActor(const AActor* Actor) const;
+
+	//Start-End 선분 + Radius 캡슐과 겹치는 피격 캡슐 검색, 액터당 가장 깊이 겹친 캡슐 하나만 추가
+	//Params의 무시 액터 목록 적용, 메시 콜리전이 꺼져 있거나 Channel을 무시하는 캐릭터는 제외, 추가한 히트 수 반환
+	int32 QueryCapsule(const FVector& Start, const FVector& End, float Radius, ECollisionChannel Channel, const FCollisionQueryParams& Params, TArray<FHitResult>& OutHits);
+
+	//현재 포즈의 액터 공간 캡슐 끝점, 랙 보상 기록용 (월드 Tick 이후 호출)
+	bool CaptureActorSpaceCapsules(const ABaseCharacter* Character, FHurtboxPoints& OutStarts, FHurtboxPoints& OutEnds);
+
+	//랙 보상용 판정 포즈 덮어쓰기, 액터는 움직이지 않음 (ULagCompensationSubsystem에서 Rewind/Restore 시 호출)
+	void SetRewoundPose(const ABaseCharacter* Character, const FTransform& ActorTransform, const FHurtboxPoints& ActorSpaceStarts, const FHurtboxPoints& ActorSpaceEnds);
+	void ClearRewoundPoses();
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TMap<FObjectKey, FHurtboxRuntime> Runtimes;
+
+	//월드 공간 SoA 스크래치 (4개 단위로 패딩), 용량 유지
+	TArray<float> SoAScratch;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	//컴포넌트 공간 캡슐 끝점 갱신, 실패 시 false
+	bool RefreshRuntime(FHurtboxRuntime& Runtime) const;
+
+#pragma endregion
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Characters/HitDetection/HurtboxSubsystem.h"
+#include "LagCompensationSubsystem.generated.h"
+
+class ABaseCharacter;
+class UPrimitiveComponent;
+struct FBodyInstance;
+
+//특정 시점의 피격 판정 상태 (루트 트랜스폼 + 피격 캡슐 포즈), Time은 실제 시간
+struct FHurtboxSnapshot
+{
+	double Time = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+
+	//액터 공간 피격 캡슐 끝점, HurtboxSet이 없는 캐릭터는 비어 있음
+	FHurtboxPoints CapsuleStarts;
+	FHurtboxPoints CapsuleEnds;
+};
+
+//캐릭터별 고정 길이 링 버퍼
+struct FHurtboxHistory
+{
+	TWeakObjectPtr<ABaseCharacter> Character;
+	TArray<FHurtboxSnapshot> Samples;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	//가장 오래된 슬롯을 최신 샘플로 바꿔 반환, 슬롯의 캡슐 배열 용량 재사용 (Samples가 비어 있으면 호출 금지)
+	FHurtboxSnapshot& Record();
+
+	//Index 0 = 가장 오래된 샘플
+	const FHurtboxSnapshot& Get(int32 Index) const { return Samples[(Head - Count + Index + Samples.Num()) % Samples.Num()]; }
+
+	//Time 시점의 트랜스폼 보간, 기록 범위 밖이면 양 끝으로 클램프
+	bool Sample(double Time, FHurtboxSnapshot& OutSnapshot) const;
+};
+
+//Rewind 중 옮긴 물리 바디와 원래 트랜스폼
+struct FRewoundBody
+{
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+	FBodyInstance* Body = nullptr;
+	FTransform Original;
+};
+
+/**
+ * 서버 랙 보상
+ * 서버에서 ABaseCharacter의 트랜스폼과 피격 캡슐 포즈를 짧은 링 버퍼로 기록하고, 원격 플레이어의 공격 판정 동안 주변 피격자를 공격자 시점으로 되돌림
+ * 액터/컴포넌트는 움직이지 않고 판정 데이터만 되감음 (오버랩 이벤트, 이동 갱신 없음)
+ * - 피격 캡슐: UHurtboxSubsystem에 과거 트랜스폼과 과거 포즈의 캡슐 끝점 전달
+ * - 물리 스윕: 쿼리 가능한 물리 바디만 루트 이동량만큼 텔레포트 후 복원 (포즈는 현재 그대로)
+ * 공격자 시점 = 현재 서버 실제 시간 - (RTT + 보간 지연), 최대 기록 길이로 클램프
+ * 핑은 실제 시간이므로 기록도 실제 시간 기준 (월드 시간 배율과 무관)
+ * 로컬 테스트: 리슨 서버 + 클라이언트 PIE에서 Network Emulation 설정 (또는 NetEmulation.PktLag) 후 ap.LagComp.Debug 1
+ */
+UCLASS()
+class ACTIONPRACTICE_API ULagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//서버에서만 기록, BeginPlay/EndPlay에서 호출
+	static void RegisterCharacter(ABaseCharacter* Character);
+	static void UnregisterCharacter(ABaseCharacter* Character);
+
+	//Attacker가 원격 플레이어면 되감을 실제 시간(초) 반환, 되감기 대상이 아니면 0
+	float GetRewindSeconds(const ABaseCharacter* Attacker) const;
+
+	//Center 반경 내 피격자의 판정 데이터를 실제 시간 Time 시점으로 되감음, Restore에서 복원
+	//프레임당 되감기 횟수 상한을 넘으면 남은 피격자는 현재 위치 유지
+	int32 Rewind(const ABaseCharacter* Attacker, double Time, const FVector& Center, float Radius);
+	void Restore();
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TMap<TObjectKey<ABaseCharacter>, FHurtboxHistory> Histories;
+
+	//Rewind 중 옮긴 물리 바디, 피격 캡슐 덮어쓰기는 UHurtboxSubsystem이 보관
+	TArray<FRewoundBody> RewoundBodies;
+	bool bHurtboxesRewound = false;
+
+	double LastRecordTime = -1.0;
+	int32 RewindsThisFrame = 0;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	void RecordSnapshots(double Now);
+
+	//Victim의 쿼리 가능한 물리 바디를 CurrentTransform -> RewoundTransform만큼 옮김
+	void RewindBodies(ABaseCharacter* Victim, const FTransform& CurrentTransform, const FTransform& RewoundTransform);
+
+#pragma endregion
+};
+
+/**
+ * 스코프 동안 피격자를 공격자 시점으로 되감음
+ * 서버 + 원격 플레이어 공격일 때만 동작, 그 외에는 아무것도 하지 않음
+ */
+struct ACTIONPRACTICE_API FScopedLagCompensation
+{
+	FScopedLagCompensation(const ABaseCharacter* Attacker, float Radius);
+	~FScopedLagCompensation();
+
+	FScopedLagCompensation(const FScopedLagCompensation&) = delete;
+	FScopedLagCompensation& operator=(const FScopedLagCompensation&) = delete;
+
+private:
+	ULagCompensationSubsystem* Subsystem = nullptr;
+};
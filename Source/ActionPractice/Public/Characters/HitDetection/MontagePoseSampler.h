@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimMontage;
+class UAnimSequence;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+
+/**
+ * 몽타주 시간 기준 본 트랜스폼 샘플러
+ * 렌더된 포즈 대신 몽타주의 슬롯 트랙(첫 번째)을 임의의 서브 프레임 시간으로 직접 샘플링해 컴포넌트 공간 트랜스폼 계산
+ * 레이어 블렌드/IK/애디티브는 반영하지 않음 (무기 판정에 필요한 본 체인만 계산)
+ * 루트 모션 몽타주는 루트 본을 레퍼런스 포즈로 고정 (이동은 메시 트랜스폼 보간이 담당)
+ */
+class ACTIONPRACTICE_API FMontagePoseSampler
+{
+public:
+	//Mesh의 스켈레톤으로 Montage를 샘플링하도록 설정, 슬롯 트랙이 없으면 false
+	bool Initialize(const UAnimMontage* InMontage, const USkeletalMeshComponent* Mesh);
+	void Reset();
+
+	bool IsValid() const { return Montage.IsValid() && MeshAsset.IsValid(); }
+
+	//몽타주 시간 Time에서 메시 본 BoneIndex의 컴포넌트 공간 트랜스폼, 시퀀스가 아닌 구간이면 false
+	bool GetComponentSpaceTransform(int32 BoneIndex, float Time, FTransform& OutTransform);
+
+private:
+	TWeakObjectPtr<const UAnimMontage> Montage;
+	TWeakObjectPtr<const USkeletalMesh> MeshAsset;
+	bool bLockRoot = false;
+
+	//같은 시간의 공통 부모 체인은 한 번만 계산
+	float CachedTime = -1.0f;
+	TWeakObjectPtr<const UAnimSequence> CachedSequence;
+	float CachedAnimTime = 0.0f;
+	TMap<int32, FTransform> CachedComponentSpace;
+
+	//시퀀스 별 애니메이션 트랙이 있는 스켈레톤 본
+	TWeakObjectPtr<const UAnimSequence> TrackMapSequence;
+	TBitArray<> AnimatedSkeletonBones;
+
+	bool ResolveSequence(float Time);
+	FTransform GetLocalTransform(int32 BoneIndex);
+};
@@ -9,6 +9,7 @@
 #include "WeaponCCDComponent.generated.h"
 
 class UAbilitySystemComponent;
+class UHurtboxSubsystem;
 class AWeapon;
 struct FWeaponDataAsset;
 struct FFinalAttackData;
@@ -34,10 +35,6 @@ public:
 #pragma region "Public Variables"
     FOnHitDetected OnWeaponHit;
     
-    //히트 설정
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hit Settings")
-    float HitCooldownTime = 0.1f;
-    
     //캡슐 크기 조정
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Capsule Settings")
     float DefaultCapsuleRadius = 10.0f;
@@ -65,6 +62,12 @@ public:
     virtual void HandleHitDetectionEnd(const FGameplayEventData& Payload) override;
 
     virtual FOnHitDetected& GetOnHitDetected() override { return OnWeaponHit; }
+    virtual void CancelHitDetection() override;
+
+    //마지막 판정 구간의 캡슐 끝 최고 속도 (월드 시간 기준 cm/s), 구간이 실행되지 않았으면 0
+    float GetPeakTipSpeed() const { return PeakTipSpeed; }
+
+    bool IsDetecting() const { return bIsDetecting; }
     
     UFUNCTION(BlueprintCallable, Category = "Weapon Collision")
     void ResetHitActors();
@@ -77,6 +80,10 @@ protected:
     
     UPROPERTY()
     TObjectPtr<UAbilitySystemComponent> CachedASC = nullptr;
+
+    //오버랩 히트의 부위 판정, 에디터 월드 등에서는 nullptr
+    UPROPERTY()
+    TObjectPtr<UHurtboxSubsystem> HurtboxSubsystem = nullptr;
     
     //현재 공격 정보
     int32 CurrentComboIndex = 0;
@@ -97,6 +104,10 @@ protected:
     //디버그용 이전 위치 (CCD 궤적 표시)
     FVector PreviousCapsuleLocation;
     FQuat PreviousCapsuleRotation;
+
+    //캡슐 끝 속도 측정, PrepareHitDetection에서 초기화
+    FVector PreviousTipLocation = FVector::ZeroVector;
+    float PeakTipSpeed = 0.0f;
 #pragma endregion
 
 #pragma region "Protected Functions"
@@ -111,7 +122,12 @@ protected:
                                bool bFromSweep, const FHitResult& SweepResult);
     
     bool ValidateHit(AActor* HitActor);
-    void ProcessHit(AActor* HitActor, const FHitResult& HitResult);
+    //bHurtboxHit: ResolveHurtboxHit 결과, 부위 배율을 캡슐 인덱스로 조회
+    void ProcessHit(AActor* HitActor, const FHitResult& HitResult, bool bHurtboxHit);
+
+    //오버랩 대상에 피격 캡슐이 있으면 캡슐 선분으로 부위 판정해 OutHit 채움, 스윕 백엔드와 같은 히트 정보
+    bool ResolveHurtboxHit(AActor* HitActor, FHitResult& OutHit) const;
+    FVector GetTipLocation() const;
     
     //캡슐 설정
     void UpdateCapsuleSize(EAttackDamageType DamageType);
@@ -131,5 +147,8 @@ public:
     FColor DebugCCDColor = FColor::Red;
 
     void DrawDebugCCDTrajectory();
+
+    //Visual Logger 기록 대상 (무기 소유 캐릭터, 없으면 Owner)
+    const UObject* GetVisualLogOwner() const;
 #pragma endregion
 };
\ No newline at end of file
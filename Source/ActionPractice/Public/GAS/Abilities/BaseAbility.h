@@ -3,11 +3,13 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "GameplayTagContainer.h"
+#include "GAS/Abilities/Latent/AbilityCoroutine.h"
 #include "BaseAbility.generated.h"
 
 class UBaseAttributeSet;
 class ABaseCharacter;
 class UBaseAbilitySystemComponent;
+class UAbilityMontageDriver;
 
 UCLASS()
 class ACTIONPRACTICE_API UBaseAbility : public UGameplayAbility
@@ -24,6 +26,7 @@ public:
 	UBaseAbility();
 
 	virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+	virtual void OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
 
 	// 어빌리티 활성화 가능 여부 확인 (이 함수에서 호출하는 함수는 무조건 파라미터 ActorInfo를 넘겨받아 사용해야 함, Instance Policing에 따라 에러날 수 있음)
 	virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags = nullptr, const FGameplayTagContainer* TargetTags = nullptr, OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
@@ -63,6 +66,10 @@ protected:
 	FGameplayTag EffectStaminaCostTag;
 	FGameplayTag EffectCooldownDurationTag;
 
+	//몽타주 드라이버, GetMontageDriver에서 처음 생성 후 어빌리티 인스턴스와 함께 유지
+	UPROPERTY()
+	TObjectPtr<UAbilityMontageDriver> MontageDriver = nullptr;
+
 #pragma endregion
 
 #pragma region "Protected Functions"
@@ -87,5 +94,18 @@ protected:
 	//멤버변수 Actor Info 활성화 전 사용 (CanActivateAbility 등)
 	const UBaseAttributeSet* GetBaseAttributeSetFromActorInfo(const FGameplayAbilityActorInfo* ActorInfo) const;
 
+	//코루틴 잠재 흐름 실행, 이전 흐름은 취소되며 EndAbility에서 자동 취소
+	void RunLatent(FAbilityCoroutine&& Flow);
+
+	//몽타주 드라이버, 처음 호출 시 생성하고 IMontageAbilityInterface::BindEventsAndReadyMontageTask로 콜백/노티파이 태그를 한 번 등록
+	UAbilityMontageDriver* GetMontageDriver();
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	FAbilityCoroutine LatentFlow;
+
 #pragma endregion
 };
\ No newline at end of file
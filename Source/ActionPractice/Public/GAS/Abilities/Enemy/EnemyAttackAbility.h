@@ -7,7 +7,6 @@
 #include "AI/EnemyAIController.h"
 #include "EnemyAttackAbility.generated.h"
 
-class UAbilityTask_PlayMontageWithEvents;
 struct FFinalAttackData;
 struct FNamedAttackData;
 
@@ -38,10 +37,6 @@ public:
 protected:
 #pragma region "Protected Variables"
 
-	//PlayMontageWithEvents 태스크
-	UPROPERTY()
-	TObjectPtr<UAbilityTask_PlayMontageWithEvents> PlayMontageWithEventsTask;
-
 	//HitDetection 관련
 	UPROPERTY()
 	FHitDetectionSetter HitDetectionSetter;
@@ -68,9 +63,6 @@ protected:
 	//다음 콤보를 이어갈지 여부 체크
 	bool bPerformNextCombo = true;
 
-	//ExecuteMontageTask 파라미터
-	bool bCreateTask = false;
-
 	//Ability 시작 시 캐싱된 Target 정보
 	FCurrentTarget CachedTargetInfo;
 
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Abilities/GameplayAbilityTypes.h"
+#include "AttributeSet.h"
+#include "Engine/TimerHandle.h"
+#include <coroutine>
+#include <tuple>
+
+class UGameplayAbility;
+class UAbilitySystemComponent;
+class UAnimInstance;
+class UAnimMontage;
+
+/**
+ * 어빌리티 잠재 실행용 C++20 코루틴
+ * UAbilityTask/타이머 콜백 체인 대신 co_await로 흐름을 순서대로 작성
+ * 코루틴 프레임은 크기별 풀에서 재사용 (게임 스레드 전용), 어빌리티 종료 시 UBaseAbility가 자동 취소
+ * 취소 시 프레임이 파괴되며 대기 중인 타이머/델리게이트는 각 대기 객체 소멸자에서 해제
+ *
+ * 사용: RunLatent(MyFlow());
+ *       FAbilityCoroutine UMyAbility::MyFlow() { co_await AbilityLatent::WaitSeconds(this, 0.2f); ... }
+ */
+class ACTIONPRACTICE_API FAbilityCoroutine
+{
+public:
+	struct promise_type
+	{
+		//코루틴을 소유한 객체, 취소(분리)되면 nullptr
+		FAbilityCoroutine* Owner = nullptr;
+
+		//Resume 호출 스택 안에서 실행 중인지 여부
+		bool bRunning = false;
+
+		//실행 중 취소 요청, 다음 대기 지점(또는 종료)에서 프레임 파괴
+		bool bCancelRequested = false;
+
+		FAbilityCoroutine get_return_object() { return FAbilityCoroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { check(false); }
+
+		//코루틴 프레임 풀
+		static void* operator new(size_t Size);
+		static void operator delete(void* Ptr, size_t Size);
+	};
+
+	using FHandle = std::coroutine_handle<promise_type>;
+
+	FAbilityCoroutine() = default;
+	FAbilityCoroutine(FAbilityCoroutine&& Other) noexcept;
+	FAbilityCoroutine& operator=(FAbilityCoroutine&& Other) noexcept;
+	~FAbilityCoroutine();
+
+	FAbilityCoroutine(const FAbilityCoroutine&) = delete;
+	FAbilityCoroutine& operator=(const FAbilityCoroutine&) = delete;
+
+	//첫 co_await까지 실행
+	void Start();
+
+	//대기 중이면 즉시 파괴, 코루틴 자신 안에서 호출되면 다음 대기 지점에서 파괴
+	void Cancel();
+
+	bool IsActive() const { return static_cast<bool>(Handle); }
+
+	//대기 객체가 완료 시 호출, 완료/취소된 코루틴은 여기서 파괴
+	static void Resume(FHandle InHandle);
+
+private:
+	explicit FAbilityCoroutine(FHandle InHandle);
+
+	FHandle Handle;
+};
+
+namespace AbilityLatent
+{
+	//대기 객체 공통 처리
+	struct ACTIONPRACTICE_API FAwaiterBase
+	{
+		bool await_ready() const { return false; }
+
+	protected:
+		FAbilityCoroutine::FHandle Continuation;
+
+		//취소 요청된 코루틴은 등록 없이 정지, Resume이 프레임을 파괴
+		bool BeginSuspend(FAbilityCoroutine::FHandle InHandle);
+		void Complete();
+	};
+
+	//시간 대기, 0 이하면 다음 틱
+	struct ACTIONPRACTICE_API FWaitSecondsAwaiter : FAwaiterBase
+	{
+		FWaitSecondsAwaiter(UWorld* InWorld, float InSeconds) : World(InWorld), Seconds(InSeconds) {}
+		~FWaitSecondsAwaiter();
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		void await_resume() const {}
+
+	private:
+		TWeakObjectPtr<UWorld> World;
+		float Seconds = 0.0f;
+		FTimerHandle TimerHandle;
+	};
+
+	//GameplayEvent 대기, 수신한 Payload 반환
+	struct ACTIONPRACTICE_API FWaitGameplayEventAwaiter : FAwaiterBase
+	{
+		FWaitGameplayEventAwaiter(UAbilitySystemComponent* InASC, const FGameplayTag& InTag) : ASC(InASC), Tag(InTag) {}
+		~FWaitGameplayEventAwaiter();
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		FGameplayEventData await_resume() const { return Payload; }
+
+	private:
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FGameplayTag Tag;
+		FDelegateHandle DelegateHandle;
+		FGameplayEventData Payload;
+
+		void Unbind();
+	};
+
+	//태그 부착/제거 대기, 이미 원하는 상태면 대기 없이 진행
+	struct ACTIONPRACTICE_API FWaitTagAwaiter : FAwaiterBase
+	{
+		FWaitTagAwaiter(UAbilitySystemComponent* InASC, const FGameplayTag& InTag, bool bInWaitForAdded) : ASC(InASC), Tag(InTag), bWaitForAdded(bInWaitForAdded) {}
+		~FWaitTagAwaiter();
+
+		bool await_ready() const;
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		void await_resume() const {}
+
+	private:
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FGameplayTag Tag;
+		bool bWaitForAdded = true;
+		FDelegateHandle DelegateHandle;
+
+		void Unbind();
+	};
+
+	//어빌리티 몽타주 재생 후 종료 대기, 중단 여부 반환 (재생 실패 시 true)
+	struct ACTIONPRACTICE_API FPlayMontageAwaiter : FAwaiterBase
+	{
+		FPlayMontageAwaiter(UGameplayAbility* InAbility, UAnimMontage* InMontage, float InPlayRate, FName InStartSection)
+			: Ability(InAbility), Montage(InMontage), PlayRate(InPlayRate), StartSection(InStartSection) {}
+		~FPlayMontageAwaiter();
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		bool await_resume() const { return bInterrupted; }
+
+	private:
+		TWeakObjectPtr<UGameplayAbility> Ability;
+		TWeakObjectPtr<UAnimMontage> Montage;
+		TWeakObjectPtr<UAnimInstance> AnimInstance;
+		float PlayRate = 1.0f;
+		FName StartSection;
+		bool bInterrupted = true;
+
+		void Unbind();
+	};
+
+	//어트리뷰트 값 변경 대기, 변경된 값 반환
+	struct ACTIONPRACTICE_API FWaitAttributeChangeAwaiter : FAwaiterBase
+	{
+		FWaitAttributeChangeAwaiter(UAbilitySystemComponent* InASC, const FGameplayAttribute& InAttribute) : ASC(InASC), Attribute(InAttribute) {}
+		~FWaitAttributeChangeAwaiter();
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		float await_resume() const { return NewValue; }
+
+	private:
+		TWeakObjectPtr<UAbilitySystemComponent> ASC;
+		FGameplayAttribute Attribute;
+		FDelegateHandle DelegateHandle;
+		float NewValue = 0.0f;
+
+		void Unbind();
+	};
+
+	//액터가 소유한 네이티브 델리게이트 발생 대기 (이동 모드 변경, 이동 입력 해제 등)
+	struct ACTIONPRACTICE_API FWaitActorDelegateAwaiter : FAwaiterBase
+	{
+		FWaitActorDelegateAwaiter(AActor* InOwner, FSimpleMulticastDelegate* InDelegate) : Owner(InOwner), Delegate(InDelegate) {}
+		~FWaitActorDelegateAwaiter();
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle);
+		void await_resume() const {}
+
+	private:
+		//델리게이트는 Owner 멤버, Owner가 유효할 때만 접근
+		TWeakObjectPtr<AActor> Owner;
+		FSimpleMulticastDelegate* Delegate = nullptr;
+		FDelegateHandle DelegateHandle;
+
+		void Unbind();
+	};
+
+	//여러 대기 중 하나가 먼저 완료되면 진행, 나머지는 소멸 시 해제
+	//어느 대기가 완료됐는지는 반환하지 않으므로 재개 후 조건을 다시 확인
+	template <typename... TAwaiters>
+	struct TWaitAnyAwaiter : FAwaiterBase
+	{
+		explicit TWaitAnyAwaiter(TAwaiters&&... InAwaiters) : Awaiters(MoveTemp(InAwaiters)...) {}
+
+		bool await_ready() const
+		{
+			return std::apply([](auto&... Awaiter) { return (Awaiter.await_ready() || ...); }, Awaiters);
+		}
+
+		bool await_suspend(FAbilityCoroutine::FHandle InHandle)
+		{
+			if (!BeginSuspend(InHandle)) return true;
+
+			//하위 대기 하나라도 즉시 진행이면 대기하지 않음
+			return std::apply([InHandle](auto&... Awaiter) { return (Awaiter.await_suspend(InHandle) && ...); }, Awaiters);
+		}
+
+		void await_resume() const {}
+
+	private:
+		std::tuple<TAwaiters...> Awaiters;
+	};
+
+	ACTIONPRACTICE_API FWaitSecondsAwaiter WaitSeconds(const UObject* WorldContext, float Seconds);
+	ACTIONPRACTICE_API FWaitSecondsAwaiter WaitNextTick(const UObject* WorldContext);
+	ACTIONPRACTICE_API FWaitGameplayEventAwaiter WaitGameplayEvent(const UGameplayAbility* Ability, const FGameplayTag& EventTag);
+	ACTIONPRACTICE_API FWaitTagAwaiter WaitTagAdded(const UGameplayAbility* Ability, const FGameplayTag& Tag);
+	ACTIONPRACTICE_API FWaitTagAwaiter WaitTagRemoved(const UGameplayAbility* Ability, const FGameplayTag& Tag);
+	ACTIONPRACTICE_API FPlayMontageAwaiter PlayMontageAndWait(UGameplayAbility* Ability, UAnimMontage* Montage, float PlayRate = 1.0f, FName StartSection = NAME_None);
+	ACTIONPRACTICE_API FWaitAttributeChangeAwaiter WaitAttributeChange(const UGameplayAbility* Ability, const FGameplayAttribute& Attribute);
+
+	//아바타가 ABaseCharacter가 아니면 대기 없이 진행
+	ACTIONPRACTICE_API FWaitActorDelegateAwaiter WaitMovementModeChanged(const UGameplayAbility* Ability);
+
+	//아바타가 AActionPracticeCharacter가 아니면 대기 없이 진행
+	ACTIONPRACTICE_API FWaitActorDelegateAwaiter WaitMoveInputReleased(const UGameplayAbility* Ability);
+
+	template <typename... TAwaiters>
+	TWaitAnyAwaiter<TAwaiters...> WaitAny(TAwaiters... Awaiters)
+	{
+		return TWaitAnyAwaiter<TAwaiters...>(MoveTemp(Awaiters)...);
+	}
+}
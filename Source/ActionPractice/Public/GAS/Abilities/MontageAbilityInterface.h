@@ -19,6 +19,7 @@ public:
 
 	virtual UAnimMontage* SetMontageToPlayTask() = 0;
 
+	//몽타주 드라이버 생성 시 한 번 호출, 드라이버 콜백과 노티파이 태그 등록
 	virtual void BindEventsAndReadyMontageTask() = 0;
 	
 	virtual void ExecuteMontageTask() = 0;
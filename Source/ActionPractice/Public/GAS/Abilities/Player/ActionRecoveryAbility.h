@@ -5,8 +5,6 @@
 #include "GAS/Abilities/Player/ActionPracticeAbility.h"
 #include "ActionRecoveryAbility.generated.h"
 
-class UAbilityTask_PlayMontageWithEvents;
-class UAbilityTask_WaitDelay;
 class UAbilityTask_PlayMontageAndWait;
 class UAbilityTask_WaitGameplayEvent;
 
@@ -42,14 +40,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Rotate")
 	float RotateTime = 0.1f;
 
-	//PlayMontageWithEvents 태스크
-	UPROPERTY()
-	TObjectPtr<UAbilityTask_PlayMontageWithEvents> PlayMontageWithEventsTask;
-
-	//딜레이 태스크
-	UPROPERTY()
-	TObjectPtr<UAbilityTask_WaitDelay> WaitDelayTask;
-	
 	//이벤트 대기 태스크
 	UPROPERTY()
 	TObjectPtr<UAbilityTask_WaitGameplayEvent> WaitInputByBufferEventTask;
@@ -87,6 +77,9 @@ protected:
 
 	UFUNCTION()
 	virtual void ExecuteMontageTask() override;
+
+	//회전 대기 후 몽타주 태스크 실행
+	FAbilityCoroutine ExecuteMontageAfterDelay(float DelayTime);
 	
 	virtual void BindEventsAndReadyMontageTask() override;
 
@@ -7,7 +7,6 @@
 #include "BaseAttackAbility.generated.h"
 
 struct FFinalAttackData;
-class UAbilityTask_PlayMontageWithEvents;
 class UAbilityTask_WaitGameplayEvent;
 
 struct FTaggedAttackData;
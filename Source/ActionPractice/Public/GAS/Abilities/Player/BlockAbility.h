@@ -6,7 +6,6 @@
 #include "BlockAbility.generated.h"
 
 struct FBlockActionData;
-class UAbilityTask_PlayMontageWithEvents;
 
 UCLASS()
 class ACTIONPRACTICE_API UBlockAbility : public UActionPracticeAbility, public IMontageAbilityInterface
@@ -30,9 +29,6 @@ protected:
 
 	const FBlockActionData* WeaponBlockData = nullptr;
 	
-	UPROPERTY()
-	TObjectPtr<UAbilityTask_PlayMontageWithEvents> PlayMontageWithEventsTask = nullptr;
-	
 	UPROPERTY()
 	float BlockAngle = 120.0f; // 정면 120도
 
@@ -50,9 +46,6 @@ protected:
 
 	UPROPERTY()
 	bool bIsBlocking = false;
-
-	//ExecuteMontageTask 파라미터
-	bool bCreateTask = false;
 	
 #pragma endregion
 
@@ -34,10 +34,6 @@ protected:
 	UPROPERTY()
 	bool bNoCharge = false;
 
-	//PlayAction, ExecuteMontageTask 파라미터
-	UPROPERTY()
-	bool bCreateTask = false;
-
 	UPROPERTY()
 	bool bIsAttackMontage = false;
 
@@ -54,7 +50,6 @@ protected:
 	virtual void SetStaminaCost(float InStaminaCost) override;
 	virtual bool RotateCharacter() override;
 	virtual UAnimMontage* SetMontageToPlayTask() override;
-	virtual void ExecuteMontageTask() override;
 	virtual void BindEventsAndReadyMontageTask() override;
 	
 	UFUNCTION()
@@ -24,10 +24,6 @@ public:
 protected:
 #pragma region "Protected Vriables" //================================================
 
-	//PlayAction, ExecuteMontageTask 파라미터
-	UPROPERTY()
-	bool bCreateTask = false;
-
 	//사용되는 태그들
 	FGameplayTag EventNotifyResetComboTag;
 	
@@ -36,7 +32,6 @@ protected:
 #pragma region "Protected Functions" //================================================
 
 	virtual void ActivateInitSettings() override;
-	virtual void ExecuteMontageTask() override;
 	virtual void BindEventsAndReadyMontageTask() override;
 	
 	UFUNCTION()
@@ -25,24 +25,24 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roll")
 	class UAnimMontage* RollMontage = nullptr;
 
-	//무적 상태 Gameplay Effect
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roll")
-	TSubclassOf<UGameplayEffect> InvincibilityEffect;
-
+	//무적/JustRolled는 GE 대신 캐릭터 피격 상태 구간으로 기록 (ABaseCharacter::OpenHurtboxWindow)
+	//State.Invincible, State.Ability.JustRolled 태그는 구간 동안 서버에서 복제 루즈 태그로 부여
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roll")
 	float InvincibilityDuration = 0.5f;
 
-	//JustRolled 태그 부여용 Effect
-	UPROPERTY(EditDefaultsOnly, Category="Roll")
-	TSubclassOf<UGameplayEffect> JustRolledWindowEffect;
-
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roll")
 	float JustRolledWindowDuration = 0.1f;
 
+	//더 이상 적용하지 않음, 기존 블루프린트 값 보존용
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Roll|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Invincibility is a hurtbox window now. State.Invincible is granted as a replicated loose tag."))
+	TSubclassOf<UGameplayEffect> InvincibilityEffect;
+
+	//더 이상 적용하지 않음, 기존 블루프린트 값 보존용
+	UPROPERTY(EditDefaultsOnly, Category = "Roll|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "JustRolled is a hurtbox window now. State.Ability.JustRolled is granted as a replicated loose tag."))
+	TSubclassOf<UGameplayEffect> JustRolledWindowEffect;
+
 	//사용되는 태그들
 	FGameplayTag EventNotifyInvincibleStartTag;
-	FGameplayTag EffectInvincibilityDurationTag;
-	FGameplayTag EffectJustRolledDurationTag;
 #pragma endregion
 
 #pragma region "Protected Functions"
@@ -63,8 +63,6 @@ protected:
 private:
 #pragma region "Private Variables"
 
-	FActiveGameplayEffectHandle InvincibilityEffectHandle;
-	
 #pragma endregion
 
 #pragma region "Private Functions"
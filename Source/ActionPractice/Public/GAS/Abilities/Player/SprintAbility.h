@@ -56,9 +56,8 @@ protected:
 	virtual void StopStaminaDrainEffect();
 
 private:
-	FTimerHandle SprintCheckTimer;
-
 	float OriginalMaxWalkSpeed = 0.0f;
 
-	void CheckSprintConditions();
+	//스프린트 조건을 이벤트마다 확인, 조건이 깨지면 어빌리티 종료
+	FAbilityCoroutine SprintConditionFlow();
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "GameplayTagContainer.h"
+#include "Abilities/GameplayAbilityTypes.h"
+#include "Animation/AnimInstance.h"
+#include "AbilityMontageDriver.generated.h"
+
+class UAbilitySystemComponent;
+class UAnimMontage;
+class UGameplayAbility;
+
+DECLARE_DELEGATE(FMontageDriverDelegate);
+DECLARE_DELEGATE_OneParam(FMontageDriverEventDelegate, FGameplayEventData);
+
+/**
+ * 어빌리티 인스턴스가 소유하는 재사용 몽타주 드라이버 (UBaseAbility::GetMontageDriver)
+ * 어빌리티 태스크와 달리 EndAbility에서 파괴되지 않으므로 활성화마다 태스크 생성, 콜백/노티파이 재바인딩이 없음
+ * 재생 중에 다시 Play하면 이전 몽타주의 종료 콜백만 떼어내고 제자리에서 전환 (콤보, 차지 -> 공격, 리커버리)
+ * 노티파이 이벤트는 처음 재생할 때 ASC에 한 번 바인딩, 재생 중이 아니거나 어빌리티가 비활성이면 무시
+ */
+UCLASS()
+class ACTIONPRACTICE_API UAbilityMontageDriver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Variables"
+
+	//어빌리티 콜백, 드라이버 생성 시 한 번 바인딩
+	FMontageDriverDelegate OnMontageCompleted;
+	FMontageDriverDelegate OnMontageInterrupted;
+	FMontageDriverEventDelegate OnNotifyEventReceived;
+
+	//다음 Stop에서 몽타주도 정지, Stop 후 초기화
+	bool bStopMontageWhenAbilityCancelled = false;
+
+#pragma endregion
+
+#pragma region "Public Functions"
+
+	void Initialize(UGameplayAbility* InAbility);
+
+	//수신할 노티파이 이벤트 태그 추가, 이미 ASC에 바인딩되어 있으면 즉시 바인딩
+	void BindNotifyEventTag(const FGameplayTag& EventTag);
+
+	//몽타주 재생, 재생 중인 몽타주가 있으면 종료 콜백 없이 전환
+	bool Play(UAnimMontage* Montage, float Rate = 1.0f, FName StartSection = NAME_None, float AnimRootMotionTranslationScale = 1.0f);
+
+	//재생 중인 몽타주의 섹션 전환
+	bool JumpToSection(FName SectionName);
+
+	//EndAbility에서 호출, 몽타주 콜백 해제 (노티파이 바인딩은 유지)
+	void Stop();
+
+	//어빌리티 제거 시 ASC 노티파이 바인딩 해제
+	void ReleaseBindings();
+
+	bool IsPlaying() const { return bPlaying; }
+	UAnimMontage* GetCurrentMontage() const { return CurrentMontage; }
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Variables"
+
+	TWeakObjectPtr<UGameplayAbility> OwningAbility;
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	TWeakObjectPtr<UAnimInstance> CurrentAnimInstance;
+
+	UPROPERTY()
+	TObjectPtr<UAnimMontage> CurrentMontage = nullptr;
+
+	bool bPlaying = false;
+
+	//수신할 태그와 ASC 이벤트 핸들
+	FGameplayTagContainer EventTagsToReceive;
+	TArray<TPair<FGameplayTag, FDelegateHandle>, TInlineAllocator<4>> EventHandles;
+
+	//몽타주 인스턴스 콜백, Initialize에서 한 번 생성
+	FOnMontageBlendingOutStarted BlendingOutDelegate;
+	FOnMontageEnded MontageEndedDelegate;
+
+#pragma endregion
+
+#pragma region "Protected Functions"
+
+	void BindEventCallback(const FGameplayTag& EventTag);
+	void ClearMontageCallbacks();
+	void SetRootMotionTranslationScale(float Scale) const;
+	bool ShouldBroadcast() const;
+
+	void HandleBlendingOut(UAnimMontage* Montage, bool bInterrupted);
+	void HandleMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+	void HandleNotifyEvent(const FGameplayEventData* Payload);
+
+#pragma endregion
+};
@@ -3,9 +3,11 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "Engine/TimerHandle.h"
 #include "BaseAttributeSet.generated.h"
 
 struct FFinalAttackData;
+struct FDoRepLifetimeParams;
 
 //Source Actor(공격 행위자)와 FFinalAttackData를 인자로 받는 델리게이트
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnDamagedPreResolve, AActor* /*SourceActor*/, const FFinalAttackData& /*FinalAttackData*/);
@@ -80,6 +82,16 @@ public:
 	FGameplayAttributeData IncomingHealing;
 	ATTRIBUTE_ACCESSORS(UBaseAttributeSet, IncomingHealing)
 
+	// ===== Quantized Replication =====
+	//Owner가 아닌 클라이언트에는 비율 값만 전송 (체력바/강인도바 표시용)
+	//강인도는 계속 회복되므로 uint8로 더 거칠게 양자화해서 작은 회복마다 더티 처리되지 않도록
+
+	UPROPERTY(ReplicatedUsing = OnRep_HealthPercentQuantized)
+	uint16 HealthPercentQuantized = MAX_uint16;
+
+	UPROPERTY(ReplicatedUsing = OnRep_PoisePercentQuantized)
+	uint8 PoisePercentQuantized = MAX_uint8;
+
 #pragma endregion
 
 #pragma region "Public Functions"
@@ -96,6 +108,13 @@ public:
 	//GE 직후 Instant, Periodic에서 수행
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
+	//값 변경 후 Push Model 더티 처리
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
+	//ap.Net.CompactAttributeReplication (시작 시 고정)
+	static bool IsCompactReplicationEnabled();
+
 	//Helper functions for calculations
 	UFUNCTION(BlueprintPure, Category = "Attributes")
 	float GetHealthPercent() const;
@@ -140,8 +159,40 @@ protected:
 	UFUNCTION()
 	virtual void OnRep_MovementSpeed(const FGameplayAttributeData& OldMovementSpeed);
 
+	UFUNCTION()
+	virtual void OnRep_HealthPercentQuantized();
+
+	UFUNCTION()
+	virtual void OnRep_PoisePercentQuantized();
+
+	// ===== Replication Helpers =====
+	//Push Model 복제 파라미터, bOwnerOnly면 Owner 클라이언트에만 전송
+	static FDoRepLifetimeParams MakeAttributeRepParams(bool bOwnerOnly);
+
+	//이 값 미만의 변화는 복제하지 않음 (0이면 모든 변화 복제)
+	virtual float GetReplicationThreshold(const FGameplayAttribute& Attribute) const;
+
+	//임계값을 넘거나 경계값(0, Max)에 도달하면 더티 처리, 생략된 변화는 타이머로 마지막 값 전송
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute, float NewValue) const;
+	void FlushThresholdedAttributes() const;
+
+	//비율 값 양자화 및 Owner가 아닌 클라이언트에서 복원
+	void UpdateQuantizedPercents();
+	void ApplyQuantizedPercent(const FGameplayAttribute& Attribute, float Percent, float MaxValue) const;
+
 	//Helper function to adjust attributes when max value changes
 	void AdjustAttributeForMaxChange(const FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty) const;
 	
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	//마지막으로 더티 처리된 값 (임계값 비교용)
+	mutable TMap<FGameplayAttribute, float> LastDirtyValues;
+
+	//임계값 미만으로 생략된 변화가 있을 때 마지막 값을 보내는 타이머
+	mutable FTimerHandle ThresholdFlushTimer;
+
 #pragma endregion
 };
\ No newline at end of file
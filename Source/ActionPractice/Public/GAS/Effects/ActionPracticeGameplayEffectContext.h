@@ -10,7 +10,7 @@ struct ACTIONPRACTICE_API FActionPracticeGameplayEffectContext : public FGamepla
 {
 	GENERATED_BODY()
 
-	FActionPracticeGameplayEffectContext(): Super(), AttackDamageType(EAttackDamageType::None), PoiseDamage(0.0f) {}
+	FActionPracticeGameplayEffectContext(): Super(), AttackDamageType(EAttackDamageType::None), PoiseDamage(0.0f), bReplicateHitResult(false), bReplicateWorldOrigin(false) {}
 	virtual ~FActionPracticeGameplayEffectContext()	{}
 
 	//오버라이드 필수 Functions
@@ -26,6 +26,10 @@ struct ACTIONPRACTICE_API FActionPracticeGameplayEffectContext : public FGamepla
 	void SetAttackDamageType(EAttackDamageType InAttackDamageType) { AttackDamageType = InAttackDamageType;	}
 	void SetPoiseDamage(float InPoiseDamage) { PoiseDamage = InPoiseDamage; }
 
+	//HitResult, WorldOrigin은 플래그를 켠 경우에만 복제 (기본: 서버 전용)
+	void SetReplicateHitResult(bool bInReplicate) { bReplicateHitResult = bInReplicate; }
+	void SetReplicateWorldOrigin(bool bInReplicate) { bReplicateWorldOrigin = bInReplicate; }
+
 	//다운캐스팅 헬퍼 함수
 	static FActionPracticeGameplayEffectContext* GetActionPracticeEffectContext(FGameplayEffectContextHandle& Handle);
 	static const FActionPracticeGameplayEffectContext* GetActionPracticeEffectContext(const FGameplayEffectContextHandle& Handle);
@@ -38,6 +42,12 @@ protected:
 	UPROPERTY()
 	float PoiseDamage;
 
+	UPROPERTY()
+	bool bReplicateHitResult;
+
+	UPROPERTY()
+	bool bReplicateWorldOrigin;
+
 };
 
 template<>
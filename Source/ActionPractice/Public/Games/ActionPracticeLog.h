@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * 모듈 공용 로그 카테고리
+ * 디버그 로그는 AP_DEBUG_LOG(서브시스템 카테고리, ...)로 Verbose 기록
+ * 기본 수준이 Log라서 Verbose는 꺼져 있고, 꺼진 카테고리는 포맷 인자도 평가하지 않음
+ * 런타임 활성화: log LogAPHitDetection Verbose (시작 시: -LogCmds="LogAPHitDetection Verbose")
+ * 활성화된 LogAP* 출력은 메모리 링 버퍼에도 기록, ap.Log.Dump [Count] [File]로 출력
+ */
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPAbility, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPHitDetection, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPCharacter, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPAI, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPAnim, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPInput, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPUI, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPNet, Log, All);
+ACTIONPRACTICE_API DECLARE_LOG_CATEGORY_EXTERN(LogAPGame, Log, All);
+
+//UE_LOG와 동일, 카테고리가 꺼져 있으면 인자 평가 없음 (NO_LOGGING 빌드에서는 제거)
+#define AP_LOG(Category, Verbosity, Format, ...) UE_LOG(Category, Verbosity, Format, ##__VA_ARGS__)
+
+//개발용 상세 로그, 기본 수준에서는 꺼져 있음
+#define AP_DEBUG_LOG(Category, Format, ...) AP_LOG(Category, Verbose, Format, ##__VA_ARGS__)
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "CameraQuerySubsystem.generated.h"
+
+//카메라 프로브 요청, 소유자가 매 프레임 갱신
+struct FCameraProbeDesc
+{
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+
+	//0이면 라인 트레이스, 아니면 구 스윕
+	float Radius = 0.0f;
+
+	ECollisionChannel Channel = ECC_Camera;
+	TWeakObjectPtr<const AActor> IgnoredActor;
+};
+
+//등록된 프로브 하나
+struct FCameraProbe
+{
+	FCameraProbeDesc Desc;
+
+	//마지막으로 제출한 구간, 이후 움직이지 않았으면 재제출 생략
+	FVector SubmittedStart = FVector::ZeroVector;
+	FVector SubmittedEnd = FVector::ZeroVector;
+	double SubmittedTime = -1.0;
+	bool bPending = false;
+
+	bool bHasResult = false;
+	bool bHit = false;
+
+	//Start -> End 중 막힌 지점 비율 (막히지 않았으면 1)
+	float HitFraction = 1.0f;
+
+	//소유자가 마지막으로 갱신한 프레임, 오래 갱신되지 않은 프로브는 제거
+	uint64 LastUpdateFrame = 0;
+};
+
+/**
+ * 카메라 씬 쿼리 일괄 비동기 처리
+ * 소유자(카메라 매니저, 스프링 암 등)는 매 프레임 UpdateProbe로 구간만 갱신하고 GetProbeResult로 직전 결과를 읽음
+ * 월드 Tick 이후 갱신된 프로브를 한 번에 비동기 트레이스로 제출, 결과는 다음 프레임 델리게이트에서 기록
+ * 구간이 움직이지 않은 프로브는 RefreshInterval 동안 재제출하지 않음
+ * 결과가 한 프레임 늦으므로 보간은 소유자가 처리 (가까워질 때 즉시, 멀어질 때 보간)
+ * stat Combat의 Camera Probe 카운터로 확인
+ */
+UCLASS()
+class ACTIONPRACTICE_API UCameraQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//InOutProbeId가 INDEX_NONE이거나 제거된 프로브면 새로 등록하고 ID를 기록
+	static void UpdateProbe(UWorld* World, int32& InOutProbeId, const FCameraProbeDesc& Desc);
+
+	//결과가 아직 없으면 false
+	static bool GetProbeResult(const UWorld* World, int32 ProbeId, bool& bOutHit, float& OutHitFraction);
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TMap<int32, FCameraProbe> Probes;
+	int32 NextProbeId = 0;
+
+	FTraceDelegate TraceDelegate;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	void SubmitProbes();
+	void HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Data);
+
+#pragma endregion
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "CombatBenchmarkSubsystem.generated.h"
+
+class ABaseCharacter;
+
+//벤치마크 실행 설정, 콘솔 인자(Key=Value)로 덮어씀
+struct FCombatBenchmarkSettings
+{
+	int32 NumBosses = 1;
+	int32 NumPlayerBots = 4;
+	float WarmupSeconds = 3.0f;
+	float DurationSeconds = 30.0f;
+	float ActionInterval = 1.2f;
+	float BlockHoldSeconds = 0.6f;
+	float SpawnRadius = 1200.0f;
+	FString BossClassPath = TEXT("/Game/Characters/WoodGiant/BP_WoodGiant.BP_WoodGiant_C");
+	FString PlayerClassPath = TEXT("/Game/Characters/Player/BP_PlayerCharacter.BP_PlayerCharacter_C");
+	FString OutputName = TEXT("CombatBench");
+
+	//회귀 임계값, 0이면 검사하지 않음
+	float MaxP95FrameMs = 0.0f;
+	float MaxP99FrameMs = 0.0f;
+	float MaxAvgGameThreadMs = 0.0f;
+	float MaxSweepsPerFrame = 0.0f;
+	float MaxQueriesPerFrame = 0.0f;
+	float MaxTotalGCMs = 0.0f;
+
+	//측정 구간 중 트레이스 멤버 스크래치 버퍼가 커지는 것을 허용하는 횟수, -1이면 검사하지 않음
+	int32 MaxTraceScratchGrowth = -1;
+
+	//종료 시 결과에 따라 프로세스 종료 (실패 시 종료 코드 1), 참가자 스폰 실패 시에도 종료 코드 1
+	bool bExitOnFinish = false;
+
+	void Parse(const TCHAR* Params);
+};
+
+//측정 구간 누적 씬 쿼리 수 (무기 스윕 + 피격 캡슐 + 카메라 + 경로)
+struct FCombatBenchmarkQueries
+{
+	int64 WeaponSweeps = 0;
+	int64 HurtboxQueries = 0;
+	int64 CameraProbesAsync = 0;
+	int64 CameraProbesSync = 0;
+	int64 PathQueries = 0;
+
+	static FCombatBenchmarkQueries Capture();
+
+	FCombatBenchmarkQueries operator-(const FCombatBenchmarkQueries& Other) const;
+	int64 GetTotal() const { return WeaponSweeps + HurtboxQueries + CameraProbesAsync + CameraProbesSync + PathQueries; }
+};
+
+//벤치마크 봇 한 명의 스크립트 상태
+struct FCombatBenchmarkBot
+{
+	TWeakObjectPtr<ABaseCharacter> Character;
+	double NextActionTime = 0.0;
+	double BlockReleaseTime = 0.0;
+	int32 ActionIndex = 0;
+};
+
+/**
+ * 개발 빌드 전용 전투 성능 벤치마크
+ * 보스/플레이어 봇을 스폰하고 공격, 구르기, 가드 루프를 기존 어빌리티로 반복 실행하며 프레임 지표를 수집
+ * 씬 쿼리 지표는 무기 스윕, 피격 캡슐 판정, 카메라 프로브(비동기/동기), 경로 쿼리를 모두 포함
+ * 결과는 Saved/Profiling/CombatBench에 JSON + CSV로 저장, 임계값 초과 또는 참가자 스폰 실패 시 실패 처리
+ * 헤드리스: UnrealEditor-Cmd <Project> <Map> -game -nullrhi -unattended -nosound -ExecCmds="ap.CombatBench Bosses=2 Players=8 MaxP95Ms=20 Exit=1"
+ */
+UCLASS()
+class ACTIONPRACTICE_API UCombatBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	void StartBenchmark(const FCombatBenchmarkSettings& InSettings);
+	void CancelBenchmark();
+
+	bool IsRunning() const { return bIsRunning; }
+
+#pragma endregion
+
+protected:
+#pragma region "Protected Functions"
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	FCombatBenchmarkSettings Settings;
+
+	bool bIsRunning = false;
+	bool bIsMeasuring = false;
+	double StartTime = 0.0;
+
+	TArray<FCombatBenchmarkBot> Bots;
+	TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+
+	// ===== Samples =====
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadTimesMs;
+	FCombatBenchmarkQueries QueriesAtStart;
+	int64 TraceScratchGrowthAtStart = 0;
+	double GCTimeMs = 0.0;
+	int32 GCCount = 0;
+	uint64 UsedPhysicalAtStart = 0;
+	uint64 PeakUsedPhysical = 0;
+
+	double WorldTickStartTime = 0.0;
+	double GCStartTime = 0.0;
+
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle WorldPostActorTickHandle;
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	//요청한 수만큼 스폰하지 못하면 false
+	bool SpawnParticipants();
+	void TickBots(double Now);
+
+	//실제 입력과 같이 누름 -> (bHold가 아니면) 뗌, 홀드 어빌리티는 ReleaseAbilityByTag로 뗌
+	void ActivateAbilityByTag(ABaseCharacter* Character, const FGameplayTag& Tag, bool bHold) const;
+	void ReleaseAbilityByTag(ABaseCharacter* Character, const FGameplayTag& Tag) const;
+
+	//Error 로그 후 정리, Exit=1이면 종료 코드 1로 종료
+	void FailBenchmark(const FString& Reason);
+
+	void BindMeasurementDelegates();
+	void UnbindMeasurementDelegates();
+
+	void FinishBenchmark();
+	void Cleanup();
+
+#pragma endregion
+};
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * 전투 시스템 프로파일링 마커
+ * stat Combat: 사이클/프레임 카운터 (STATS가 꺼진 빌드에서는 매크로가 비어 있음)
+ * Insights: -trace=default,Combat 또는 콘솔 Trace.Enable Combat 으로 CombatChannel 활성화
+ * Shipping은 COMBAT_TRACE_ENABLED = 0 이므로 트레이스 매크로와 인자 평가가 모두 제거됨
+ */
+
+#define COMBAT_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+DECLARE_STATS_GROUP(TEXT("Combat"), STATGROUP_Combat, STATCAT_Advanced);
+
+//===== Cycle =====
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ability CanActivate"), STAT_CombatAbilityCanActivate, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ability Activate"), STAT_CombatAbilityActivate, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Trace Tick"), STAT_CombatTraceTick, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sweep"), STAT_CombatSweep, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hit Validation"), STAT_CombatHitValidation, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Process Hit"), STAT_CombatProcessHit, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Resolution"), STAT_CombatDamageResolution, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hit Reaction"), STAT_CombatHitReaction, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Short Duration Tags"), STAT_CombatShortDurationTags, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hurtbox Query"), STAT_CombatHurtboxQuery, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Impact Flush"), STAT_CombatImpactFlush, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Gather"), STAT_CombatBrainGather, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Evaluate"), STAT_CombatBrainEvaluate, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Apply"), STAT_CombatBrainApply, STATGROUP_Combat, ACTIONPRACTICE_API);
+
+//===== Counter (프레임마다 초기화) =====
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Abilities Activated"), STAT_CombatAbilitiesActivated, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Abilities Failed"), STAT_CombatAbilitiesFailed, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sweeps"), STAT_CombatSweeps, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits Validated"), STAT_CombatHitsValidated, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits Rejected"), STAT_CombatHitsRejected, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Resolved"), STAT_CombatDamageResolved, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hit Reactions"), STAT_CombatHitReactions, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Short Duration Tag Changes"), STAT_CombatShortDurationTagChanges, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Trace Scratch Growth"), STAT_CombatTraceScratchGrowth, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Tier Degraded"), STAT_CombatBudgetDegraded, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Traces Deferred"), STAT_CombatBudgetDeferred, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Budget Overrun"), STAT_CombatBudgetOverrun, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Latent Frame Allocations"), STAT_CombatLatentFrameAllocations, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hurtbox Capsule Tests"), STAT_CombatHurtboxTests, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Backend Sweep Selected"), STAT_CombatBackendSweep, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Backend CCD Selected"), STAT_CombatBackendCCD, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impacts Queued"), STAT_CombatImpactsQueued, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impacts Merged"), STAT_CombatImpactsMerged, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impacts Culled"), STAT_CombatImpactsCulled, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impacts Played"), STAT_CombatImpactsPlayed, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Impact Pool Allocations"), STAT_CombatImpactPoolAllocations, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Brain Agents"), STAT_CombatBrainAgents, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Queries"), STAT_CombatPathQueries, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests Shared"), STAT_CombatPathShared, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests Deferred"), STAT_CombatPathDeferred, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes Submitted"), STAT_CombatCameraProbesSubmitted, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes Skipped"), STAT_CombatCameraProbesSkipped, STATGROUP_Combat, ACTIONPRACTICE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Probes Sync"), STAT_CombatCameraProbesSync, STATGROUP_Combat, ACTIONPRACTICE_API);
+
+/**
+ * 벤치마크용 누적 씬 쿼리 수 (게임 스레드에서만 증가)
+ * 스탯 카운터는 프레임마다 초기화되고 STATS가 꺼진 빌드에서는 비어 있으므로 별도로 집계
+ * 무기 스윕은 UAttackTraceComponent::TotalSweepTraceCounter
+ */
+struct ACTIONPRACTICE_API FCombatQueryCounters
+{
+	//피격 캡슐 판정 (물리 스윕을 대신하는 캐릭터 판정 1회)
+	static int64 HurtboxQueries;
+
+	static int64 CameraProbesAsync;
+	static int64 CameraProbesSync;
+	static int64 PathQueries;
+};
+
+#if COMBAT_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(CombatChannel, ACTIONPRACTICE_API);
+
+//Insights 타이밍 스코프
+#define COMBAT_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, CombatChannel)
+
+//이름이 동적인 순간 이벤트 (실패/거부 사유 등), 채널이 꺼져 있으면 인자를 평가하지 않음
+#define COMBAT_TRACE_EVENT(Format, ...) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CombatChannel)) \
+		{ \
+			TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*FString::Printf(Format, ##__VA_ARGS__), CombatChannel); \
+		} \
+	} while (0)
+#else
+#define COMBAT_TRACE_SCOPE(Name)
+#define COMBAT_TRACE_EVENT(Format, ...)
+#endif
+
+//사이클 스탯 + Insights 스코프
+#define COMBAT_SCOPE(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	COMBAT_TRACE_SCOPE(Stat)
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TickAuditSubsystem.generated.h"
+
+/**
+ * 개발 빌드 전용 Tick 감사
+ * Tick이 켜진 액터/컴포넌트 수와 할 일 없이 돈 Tick을 클래스별로 집계해 로그로 출력
+ * 유휴 Tick은 두 경로로 수집
+ * - 작업 조건을 아는 클래스 (캐릭터, 히트 판정 컴포넌트)는 Tick에서 직접 ReportIdleTick
+ * - 그 외 액터/컴포넌트는 주기 감사 중 매 프레임 Tick 함수가 켜진 것을 순회해 일반 조건으로 판정
+ *   (스크립트 Tick 없는 엔진 기본 클래스, 비활성/미등록 컴포넌트, 움직일 대상이 없거나 멈춘 이동 컴포넌트)
+ * 콘솔: ap.TickAudit (즉시 출력), ap.TickAudit.Interval (주기 출력 + 프레임 샘플링, 0이면 비활성)
+ */
+UCLASS()
+class ACTIONPRACTICE_API UTickAuditSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	//Tick이 작업 없이 호출됐을 때 호출, Shipping에서는 아무것도 하지 않음
+	static void ReportIdleTick(const UObject* Ticker);
+
+	//현재 월드의 Tick 상태를 집계해 로그 출력, 유휴 Tick이 있으면 경고
+	void RunAudit();
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	//클래스별 유휴 Tick 누적 횟수 (RunAudit 후 초기화)
+	TMap<FName, int32> IdleTickCounts;
+
+	FTimerHandle AuditTimerHandle;
+
+	//주기 감사 중에만 매 프레임 유휴 Tick 샘플링
+	bool bSampling = false;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	//스스로 보고하지 않는 액터/컴포넌트의 유휴 Tick을 일반 조건으로 집계
+	void SampleIdleTicks(TMap<FName, int32>& OutCounts) const;
+
+#pragma endregion
+};
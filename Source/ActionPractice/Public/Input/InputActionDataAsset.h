@@ -6,6 +6,7 @@
 #include "InputAction.h"
 #include "Engine/StreamableManager.h"
 #include "Engine/AssetManager.h"
+#include "Games/ActionPracticeLog.h"
 #include "InputActionDataAsset.generated.h"
 
 USTRUCT(BlueprintType)
@@ -39,7 +40,7 @@ public:
     {
         if (!InputAction)
         {
-            UE_LOG(LogTemp, Warning, TEXT("FindRuleByAction: InAction is null"));
+            UE_LOG(LogAPInput, Warning, TEXT("FindRuleByAction: InAction is null"));
             return nullptr;
         }
 
@@ -48,7 +49,7 @@ public:
             return Found;
         }
 
-        UE_LOG(LogTemp, Warning, TEXT("FindRuleByAction: Rule not found for Action=%s"), *GetNameSafe(InputAction));
+        UE_LOG(LogAPInput, Warning, TEXT("FindRuleByAction: Rule not found for Action=%s"), *GetNameSafe(InputAction));
         return nullptr;
     }
 };
\ No newline at end of file
@@ -14,6 +14,7 @@ class UWeaponDataAsset;
 class UStaticMeshComponent;
 class UPrimitiveComponent;
 class UWeaponAttackComponent;  
+class UHitDetectionSelectorComponent;
 struct FGameplayTag;
 struct FBlockActionData;
 struct FTaggedAttackData;
@@ -26,7 +27,11 @@ class AWeapon : public AActor
 public:
 #pragma region "Public Variables"
 
-	//HitDetection에 WeaponTraceComponent를 사용할지, WeaponCCDComponent를 사용할지
+	//HitDetection 백엔드를 공격마다 자동 선택할지 (HitDetectionSelector), 무기 데이터에서 켠 경우에만 사용
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "HitDetection")
+	bool bAutoSelectHitDetection = false;
+
+	//자동 선택을 끈 경우 WeaponTraceComponent를 사용할지, WeaponCCDComponent를 사용할지
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Debug")
 	bool bIsTraceDetectionOrNot = true;
 	
@@ -34,7 +39,6 @@ public:
 
 #pragma region "Public Functions"
 	AWeapon();
-	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
@@ -61,9 +65,6 @@ public:
 	
 	UFUNCTION(BlueprintCallable, Category = "Weapon")
 	virtual void EquipWeapon();	
-
-	UFUNCTION()
-	void OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
 	
 #pragma endregion
 
@@ -78,6 +79,10 @@ protected:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<UWeaponCCDComponent> CCDComponent;
+
+	//어빌리티가 사용하는 HitDetection 프런트 엔드, 공격마다 Trace/CCD 중 하나를 준비
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UHitDetectionSelectorComponent> HitDetectionSelector;
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon Stats")
 	FString WeaponName;
@@ -10,6 +10,7 @@
 #include "WeaponDataAsset.generated.h"
 
 class UAnimMontage;
+class UHitImpactTable;
 
 //TMap 대신 사용할 구조체
 USTRUCT(BlueprintType)
@@ -82,6 +83,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Block Definitions")
     FBlockActionData BlockData;
 
+    //히트 시 재생할 이펙트/사운드 (데미지 타입 + 표면)
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
+    TObjectPtr<UHitImpactTable> ImpactTable;
+
     //GetOptions용 함수 - HitSocketInfo에서 소켓 그룹 이름들을 반환
     UFUNCTION()
     TArray<FString> GetSocketGroupNames() const
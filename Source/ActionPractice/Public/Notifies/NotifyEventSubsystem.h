@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineBaseTypes.h"
+#include "NotifyEventSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+class UActorComponent;
+class USkeletalMeshComponent;
+class UNotifyEventSubsystem;
+struct FAnimNotifyEvent;
+struct FAnimNotifyEventReference;
+
+//노티파이 처리 중 큐에 쌓이는 이벤트
+struct FQueuedNotifyEvent
+{
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComp;
+	FGameplayTag EventTag;
+	float EventMagnitude = 0.0f;
+
+	//NotifyState 짝 판별용 (일반 노티파이는 nullptr)
+	const FAnimNotifyEvent* StateNotify = nullptr;
+	bool bIsStateEnd = false;
+};
+
+//등록된 메시 애니메이션 이후, 판정 컴포넌트 Tick 이전에 큐를 전달하는 Tick 함수
+USTRUCT()
+struct FNotifyEventDispatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UNotifyEventSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FNotifyEventDispatchTickFunction> : public TStructOpsTypeTraitsBase2<FNotifyEventDispatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * AnimNotify -> GameplayEvent 일괄 전달
+ * 노티파이 처리 중에는 이벤트를 큐에 쌓기만 하고, 애니메이션 직후 순서대로 ASC에 전달
+ * 전달 시점: 등록된 캐릭터 메시 Tick(애니메이션 갱신) 이후, 판정 컴포넌트 Tick 이전의 TG_PrePhysics 전용 Tick 함수
+ *  (HitDetectionStart/End가 같은 프레임 판정에 반영), 등록되지 않은 메시의 이벤트는 프레임 끝 Tick에서 전달
+ * 메시별 ASC는 IAbilitySystemInterface로 한 번만 찾아 캐싱
+ * 같은 배치에서 이전 구간의 NotifyState End는 새 구간 Begin보다 먼저 전달 (End-Start 역전 방지)
+ */
+UCLASS()
+class ACTIONPRACTICE_API UNotifyEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+#pragma region "Public Functions"
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//일반 노티파이 이벤트 큐잉
+	static void QueueNotifyEvent(USkeletalMeshComponent* MeshComp, const FGameplayTag& EventTag, float EventMagnitude = 0.0f);
+
+	//NotifyState Begin/End 이벤트 큐잉
+	static void QueueNotifyStateEvent(USkeletalMeshComponent* MeshComp, const FGameplayTag& EventTag, const FAnimNotifyEventReference& EventReference, bool bIsStateEnd, float EventMagnitude = 0.0f);
+
+	//캐릭터 BeginPlay/EndPlay에서 호출, 전달 Tick이 이 메시의 애니메이션 갱신 이후에 실행
+	static void RegisterAnimatedMesh(USkeletalMeshComponent* MeshComp);
+	static void UnregisterAnimatedMesh(USkeletalMeshComponent* MeshComp);
+
+	//판정 컴포넌트 BeginPlay에서 호출, 이 Tick 함수가 전달 Tick 이후에 실행
+	static void AddDispatchPrerequisite(UActorComponent* Component, FTickFunction& TickFunction);
+
+	void DispatchQueuedEvents();
+
+#pragma endregion
+
+private:
+#pragma region "Private Variables"
+
+	TArray<FQueuedNotifyEvent> PendingEvents;
+
+	//Tick 중 전달용 배열 (재할당 방지를 위해 재사용)
+	TArray<FQueuedNotifyEvent> DispatchingEvents;
+
+	TMap<TObjectKey<USkeletalMeshComponent>, TWeakObjectPtr<UAbilitySystemComponent>> CachedASCs;
+
+	FCriticalSection PendingEventsLock;
+
+	FNotifyEventDispatchTickFunction DispatchTickFunction;
+
+#pragma endregion
+
+#pragma region "Private Functions"
+
+	static void Enqueue(FQueuedNotifyEvent&& Event);
+
+	UAbilitySystemComponent* ResolveASC(USkeletalMeshComponent* MeshComp);
+	static UAbilitySystemComponent* FindASC(const USkeletalMeshComponent* MeshComp);
+	static void SendEvent(UAbilitySystemComponent* ASC, AActor* Owner, const FQueuedNotifyEvent& Event);
+
+#pragma endregion
+};
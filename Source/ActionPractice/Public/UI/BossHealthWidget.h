@@ -5,10 +5,17 @@
 #include "BossHealthWidget.generated.h"
 
 class UBossAttributeSet;
+struct FOnAttributeChangeData;
 class UProgressBar;
 class UTextBlock;
-
-UCLASS()
+class UInvalidationBox;
+
+/**
+ * 보스 체력 HUD
+ * 값은 Attribute 변경 델리게이트로만 갱신, 지연 바 애니메이션 중에만 타이머로 갱신
+ * 바와 이름을 BossInvalidationBox로 감싸면 값이 바뀔 때만 다시 그림
+ */
+UCLASS(meta = (DisableNativeTick))
 class ACTIONPRACTICE_API UBossHealthWidget : public UUserWidget
 {
 	GENERATED_BODY()
@@ -25,12 +32,15 @@ public:
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UTextBlock> BossNameText;
 
+	//바와 이름을 감싸는 캐싱 박스, 없으면 캐싱 없이 동작
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UInvalidationBox> BossInvalidationBox;
+
 #pragma endregion
 
 #pragma region "Public Functions"
 
 	virtual void NativeConstruct() override;
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	virtual void NativeDestruct() override;
 
 	UFUNCTION(BlueprintCallable, Category = "UI")
@@ -54,11 +64,31 @@ protected:
 	float TargetBossHealthDamagePercent = 1.0f;
 	float CurrentBossHealthDelayTimer = 0.0f;
 
+	//Attribute Change Delegate
+	FDelegateHandle HealthChangedHandle;
+	FDelegateHandle MaxHealthChangedHandle;
+
+	//지연 바 애니메이션 타이머, 따라잡는 중에만 동작
+	FTimerHandle DamageBarTimerHandle;
+
 #pragma endregion
 
 #pragma region "Protected Functions"
 
-	void UpdateDamageBars(float DeltaTime);
+	//지연 바 감소, 아직 따라잡는 중이면 true
+	bool UpdateDamageBars(float DeltaTime);
+
+	//지연 바 애니메이션 타이머 시작/갱신
+	void StartDamageBarAnimation();
+	void OnDamageBarTimer();
+
+	//델리게이트 바인드
+	void BindAttributeDelegates();
+	void UnbindAttributeDelegates();
+
+	//콜백 함수
+	void OnHealthChanged(const FOnAttributeChangeData& Data);
+	void OnMaxHealthChanged(const FOnAttributeChangeData& Data);
 
 #pragma endregion
 
@@ -73,6 +103,10 @@ private:
 	UPROPERTY(EditAnywhere, Category = "UI Settings", meta = (AllowPrivateAccess = "true"))
 	float DamageBarDelayTime = 0.5f;
 
+	//지연 바 애니메이션 갱신 간격
+	UPROPERTY(EditAnywhere, Category = "UI Settings", meta = (AllowPrivateAccess = "true"))
+	float DamageBarUpdateInterval = 1.0f / 60.0f;
+
 #pragma endregion
 
 #pragma region "Private Functions"
@@ -7,9 +7,15 @@
 struct FOnAttributeChangeData;
 class UVerticalBox;
 class UProgressBar;
+class UInvalidationBox;
 class UActionPracticeAttributeSet;
 
-UCLASS()
+/**
+ * 플레이어 체력/스테미나 HUD
+ * 값은 Attribute 변경 델리게이트로만 갱신, 지연 바 애니메이션 중에만 타이머로 갱신
+ * 바 전체를 StatsInvalidationBox로 감싸면 값이 바뀔 때만 다시 그리고 나머지 프레임은 캐시된 위젯을 사용
+ */
+UCLASS(meta = (DisableNativeTick))
 class ACTIONPRACTICE_API UPlayerStatsWidget : public UUserWidget
 {
 	GENERATED_BODY()
@@ -34,13 +40,16 @@ public:
 
 	UPROPERTY(meta = (BindWidget))
 	TObjectPtr<UProgressBar> StaminaDamageBar;
+
+	//바를 감싸는 캐싱 박스, 없으면 캐싱 없이 동작
+	UPROPERTY(meta = (BindWidgetOptional))
+	TObjectPtr<UInvalidationBox> StatsInvalidationBox;
 	
 #pragma endregion
 
 #pragma region "Public Functions"
 	
 	virtual void NativeConstruct() override;
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	virtual void NativeDestruct() override;
 	
 	UFUNCTION(BlueprintCallable, Category = "UI")
@@ -73,14 +82,23 @@ protected:
 	float CurrentStaminaDelayTimer = 0.0f;
 
 	//Attribute Change Delegate
+	FDelegateHandle HealthChangedHandle;
 	FDelegateHandle MaxHealthChangedHandle;
+	FDelegateHandle StaminaChangedHandle;
 	FDelegateHandle MaxStaminaChangedHandle;
+
+	//지연 바 애니메이션 타이머, 따라잡는 중에만 동작
+	FTimerHandle DamageBarTimerHandle;
 #pragma endregion
 
 #pragma region "Protected Functions"
 	
-	//지연 바 감소
-	void UpdateDamageBars(float DeltaTime);
+	//지연 바 감소, 아직 따라잡는 중이면 true
+	bool UpdateDamageBars(float DeltaTime);
+
+	//지연 바 애니메이션 타이머 시작/갱신
+	void StartDamageBarAnimation();
+	void OnDamageBarTimer();
 
 	void UpdateHealthBarSize(float MaxHealth);
 	void UpdateStaminaBarSize(float MaxStamina);
@@ -90,7 +108,9 @@ protected:
 	void UnbindAttributeDelegates();
 
 	//콜백 함수
+	void OnHealthChanged(const FOnAttributeChangeData& Data);
 	void OnMaxHealthChanged(const FOnAttributeChangeData& Data);
+	void OnStaminaChanged(const FOnAttributeChangeData& Data);
 	void OnMaxStaminaChanged(const FOnAttributeChangeData& Data);
 #pragma endregion
 
@@ -105,6 +125,10 @@ private:
 	UPROPERTY(EditAnywhere, Category = "UI Settings", meta = (AllowPrivateAccess = "true"))
 	float DamageBarDelayTime = 0.5f;
 
+	//지연 바 애니메이션 갱신 간격
+	UPROPERTY(EditAnywhere, Category = "UI Settings", meta = (AllowPrivateAccess = "true"))
+	float DamageBarUpdateInterval = 1.0f / 60.0f;
+
 	//체력 1당 바 길이
 	UPROPERTY(EditAnywhere, Category = "UI Settings", meta = (AllowPrivateAccess = "true"))
 	float BarWidthPerHealth = 0.5f;
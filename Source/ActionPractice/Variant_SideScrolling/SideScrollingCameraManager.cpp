@@ -3,9 +3,8 @@
 
 #include "SideScrollingCameraManager.h"
 #include "GameFramework/Pawn.h"
-#include "Engine/HitResult.h"
-#include "CollisionQueryParams.h"
 #include "Engine/World.h"
+#include "Games/CameraQuerySubsystem.h"
 
 void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
 {
@@ -57,16 +56,23 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 
 		} else {
 
-			// run a trace below the character to determine if we need to do a height update
-			FHitResult OutHit;
+			// probe below the character to determine if we need to do a height update
+			// the probe runs asynchronously, so we read the result traced on the previous frame
+			FCameraProbeDesc Probe;
+			Probe.Start = CurrentActorLocation;
+			Probe.End = CurrentActorLocation + FVector(0.0f, 0.0f, -1000.0f);
+			Probe.Channel = ECC_Visibility;
+			Probe.IgnoredActor = TargetPawn;
 
-			const FVector End = CurrentActorLocation + FVector(0.0f, 0.0f, -1000.0f);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(TargetPawn);
+			UCameraQuerySubsystem::UpdateProbe(GetWorld(), GroundProbeId, Probe);
 
 			// only update height if we're not about to hit ground
-			bZUpdate = !GetWorld()->LineTraceSingleByChannel(OutHit, CurrentActorLocation, End, ECC_Visibility, QueryParams);
+			// until the first result arrives, assume we are and keep blending
+			bool bGroundHit = true;
+			float GroundFraction = 1.0f;
+			UCameraQuerySubsystem::GetProbeResult(GetWorld(), GroundProbeId, bGroundHit, GroundFraction);
+
+			bZUpdate = !bGroundHit;
 
 		}
 
@@ -44,4 +44,7 @@ protected:
 
 	/** First-time update camera setup flag */
 	bool bSetup = true;
+
+	/** Camera query service probe used to look for ground below the falling target */
+	int32 GroundProbeId = INDEX_NONE;
 };
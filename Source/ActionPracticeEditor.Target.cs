@@ -11,5 +11,8 @@ public class ActionPracticeEditorTarget : TargetRules
 		DefaultBuildSettings = BuildSettingsVersion.V6;
 		IncludeOrderVersion = EngineIncludeOrderVersion.Unreal5_7;
 		ExtraModuleNames.Add("ActionPractice");
+
+		// Attribute sets replicate through the push model (net.IsPushModelEnabled=1 in DefaultEngine.ini)
+		bWithPushModel = true;
 	}
 }